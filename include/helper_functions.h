@@ -32,6 +32,7 @@
 #include "libmtkahypartypes.h"
 
 #include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/session.h"
 
 using namespace mt_kahypar;
 
@@ -91,18 +92,34 @@ bool check_if_all_relavant_parameters_are_set(Context& context) {
   return success;
 }
 
-void prepare_context(Context& context) {
-  context.shared_memory.original_num_threads = mt_kahypar::TBBInitializer::instance().total_number_of_threads();
-  context.shared_memory.num_threads = mt_kahypar::TBBInitializer::instance().total_number_of_threads();
-  context.utility_id = mt_kahypar::utils::Utilities::instance().registerNewUtilityObjects();
-  mt_kahypar::utils::Randomize::instance().setSeed(context.partition.seed);
+void prepare_context(Context& context, const Session* session = nullptr) {
+  if ( session ) {
+    session->prepare(context);
+  } else {
+    context.shared_memory.original_num_threads = mt_kahypar::TBBInitializer::instance().total_number_of_threads();
+    context.shared_memory.num_threads = mt_kahypar::TBBInitializer::instance().total_number_of_threads();
+    context.utility_id = mt_kahypar::utils::Utilities::instance().registerNewUtilityObjects();
+    // Sessions seed the random number generators once they execute the call
+    mt_kahypar::utils::Randomize::instance().setSeed(context.partition.seed);
+  }
 
+  context.partition.predicted_peak_memory = 0;
   context.partition.perfect_balance_part_weights.clear();
   if ( !context.partition.use_individual_part_weights ) {
     context.partition.max_part_weights.clear();
   }
 }
 
+// ! Executes f inside the task arena of the session (if any)
+template<typename F>
+auto execute(Session* session, const Context& context, F&& f) -> decltype(f()) {
+  if ( session ) {
+    return session->execute(context, std::forward<F>(f));
+  } else {
+    return f();
+  }
+}
+
 InstanceType get_instance_type(mt_kahypar_hypergraph_t hypergraph) {
   switch ( hypergraph.type ) {
     case STATIC_GRAPH:
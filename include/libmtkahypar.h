@@ -100,6 +100,30 @@ MT_KAHYPAR_API void mt_kahypar_set_individual_target_block_weights(mt_kahypar_co
 MT_KAHYPAR_API void mt_kahypar_initialize_thread_pool(const size_t num_threads,
                                                       const bool interleaved_allocations);
 
+// ####################### Sessions #######################
+
+/**
+ * Creates a new session. A session owns a task arena with the given number of threads
+ * as well as its own timer and statistics. Sessions can be used from different threads
+ * without interfering with each other. Since the random number generators are shared by
+ * all sessions and reseeded for each call, the partitioning calls of all sessions are
+ * serialized such that each call is reproducible for a fixed seed.
+ *
+ * \note The number of threads of a session is bounded by the number of threads
+ *       of the thread pool (see mt_kahypar_initialize_thread_pool(...)).
+ */
+MT_KAHYPAR_API mt_kahypar_session_t* mt_kahypar_session_new(const size_t num_threads);
+
+/**
+ * Deletes the session object.
+ */
+MT_KAHYPAR_API void mt_kahypar_free_session(mt_kahypar_session_t* session);
+
+/**
+ * Returns the number of threads used by the session.
+ */
+MT_KAHYPAR_API size_t mt_kahypar_session_num_threads(const mt_kahypar_session_t* session);
+
 // ####################### Load/Construct Hypergraph #######################
 
 /**
@@ -218,6 +242,25 @@ MT_KAHYPAR_API bool mt_kahypar_check_compatibility(mt_kahypar_hypergraph_t hyper
 MT_KAHYPAR_API mt_kahypar_partitioned_hypergraph_t mt_kahypar_partition(mt_kahypar_hypergraph_t hypergraph,
                                                                         mt_kahypar_context_t* context);
 
+/**
+ * Partitions several (hyper)graphs with the configuration specified in the partitioning context.
+ * The instances are distributed across the threads of the thread pool and each instance is
+ * partitioned sequentially by a single thread. This gives a much higher throughput than calling
+ * mt_kahypar_partition(...) for each instance if the (hyper)graphs are small.
+ * The partition of hypergraphs[i] is stored in partitioned_hgs[i], which must point to an array
+ * of size num_hypergraphs. The context is not modified.
+ *
+ * \note If one of the (hyper)graphs is not compatible with the preset, no instance is partitioned
+ *       and all entries of partitioned_hgs are set to a nullptr partition.
+ * \note Logging is disabled for the individual instances.
+ * \note Partitioning temporarily modifies a (hyper)graph, so the same object must not occur
+ *       several times in the batch.
+ */
+MT_KAHYPAR_API void mt_kahypar_partition_batch(const mt_kahypar_hypergraph_t* hypergraphs,
+                                               const size_t num_hypergraphs,
+                                               const mt_kahypar_context_t* context,
+                                               mt_kahypar_partitioned_hypergraph_t* partitioned_hgs);
+
 /**
  * Maps a (hyper)graph onto a target graph with the configuration specified in the partitioning context.
  * The number of blocks of the output mapping/partition is the same as the number of nodes in the target graph
@@ -267,6 +310,51 @@ MT_KAHYPAR_API void mt_kahypar_improve_mapping(mt_kahypar_partitioned_hypergraph
                                                mt_kahypar_context_t* context,
                                                const size_t num_vcycles);
 
+/**
+ * Partitions a (hyper)graph within the given session (see mt_kahypar_partition(...)).
+ * The context is not modified, so that the same context can be shared by several sessions.
+ */
+MT_KAHYPAR_API mt_kahypar_partitioned_hypergraph_t mt_kahypar_session_partition(mt_kahypar_session_t* session,
+                                                                                mt_kahypar_hypergraph_t hypergraph,
+                                                                                const mt_kahypar_context_t* context);
+
+/**
+ * Partitions several (hyper)graphs within the given session (see mt_kahypar_partition_batch(...)).
+ */
+MT_KAHYPAR_API void mt_kahypar_session_partition_batch(mt_kahypar_session_t* session,
+                                                       const mt_kahypar_hypergraph_t* hypergraphs,
+                                                       const size_t num_hypergraphs,
+                                                       const mt_kahypar_context_t* context,
+                                                       mt_kahypar_partitioned_hypergraph_t* partitioned_hgs);
+
+/**
+ * Maps a (hyper)graph onto a target graph within the given session (see mt_kahypar_map(...)).
+ * The context is not modified, so that the same context can be shared by several sessions.
+ */
+MT_KAHYPAR_API mt_kahypar_partitioned_hypergraph_t mt_kahypar_session_map(mt_kahypar_session_t* session,
+                                                                          mt_kahypar_hypergraph_t hypergraph,
+                                                                          mt_kahypar_target_graph_t* target_graph,
+                                                                          const mt_kahypar_context_t* context);
+
+/**
+ * Improves a given partition within the given session (see mt_kahypar_improve_partition(...)).
+ * The context is not modified, so that the same context can be shared by several sessions.
+ */
+MT_KAHYPAR_API void mt_kahypar_session_improve_partition(mt_kahypar_session_t* session,
+                                                         mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                                         const mt_kahypar_context_t* context,
+                                                         const size_t num_vcycles);
+
+/**
+ * Improves a given mapping within the given session (see mt_kahypar_improve_mapping(...)).
+ * The context is not modified, so that the same context can be shared by several sessions.
+ */
+MT_KAHYPAR_API void mt_kahypar_session_improve_mapping(mt_kahypar_session_t* session,
+                                                       mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                                       mt_kahypar_target_graph_t* target_graph,
+                                                       const mt_kahypar_context_t* context,
+                                                       const size_t num_vcycles);
+
 /**
  * Constructs a partitioned (hyper)graph out of the given partition.
  */
@@ -22,6 +22,8 @@ struct mt_kahypar_context_s;
 typedef struct mt_kahypar_context_s mt_kahypar_context_t;
 struct mt_kahypar_target_graph_s;
 typedef struct mt_kahypar_target_graph_s mt_kahypar_target_graph_t;
+struct mt_kahypar_session_s;
+typedef struct mt_kahypar_session_s mt_kahypar_session_t;
 
 struct mt_kahypar_hypergraph_s;
 typedef struct {
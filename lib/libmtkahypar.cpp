@@ -34,6 +34,7 @@
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/context.h"
 #include "mt-kahypar/partition/partitioner_facade.h"
+#include "mt-kahypar/partition/session.h"
 #include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/partition/conversion.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
@@ -71,6 +72,79 @@ namespace {
     return PresetType::UNDEFINED;
   }
 
+  mt_kahypar_partitioned_hypergraph_t partition(mt_kahypar_hypergraph_t hypergraph,
+                                                Context& c,
+                                                TargetGraph* target,
+                                                Session* session) {
+    if ( lib::check_if_all_relavant_parameters_are_set(c) ) {
+      if ( lib::check_compatibility(hypergraph, lib::get_preset_c_type(c.partition.preset_type)) ) {
+        c.partition.instance_type = lib::get_instance_type(hypergraph);
+        c.partition.partition_type = to_partition_c_type(
+          c.partition.preset_type, c.partition.instance_type);
+        lib::prepare_context(c, session);
+        c.partition.num_vcycles = 0;
+        if ( target ) {
+          c.partition.objective = Objective::steiner_tree;
+        }
+        return lib::execute(session, c, [&] {
+          return PartitionerFacade::partition(hypergraph, c, target);
+        });
+      } else {
+        WARNING(lib::incompatibility_description(hypergraph));
+      }
+    }
+    return mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
+  }
+
+  void partition_batch(const mt_kahypar_hypergraph_t* hypergraphs,
+                       const size_t num_hypergraphs,
+                       Context& c,
+                       mt_kahypar_partitioned_hypergraph_t* partitioned_hgs,
+                       Session* session) {
+    for ( size_t i = 0; i < num_hypergraphs; ++i ) {
+      partitioned_hgs[i] = mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
+    }
+    if ( lib::check_if_all_relavant_parameters_are_set(c) ) {
+      const mt_kahypar_preset_type_t preset = lib::get_preset_c_type(c.partition.preset_type);
+      for ( size_t i = 0; i < num_hypergraphs; ++i ) {
+        if ( !lib::check_compatibility(hypergraphs[i], preset) ) {
+          WARNING("Hypergraph" << i << "of the batch:" << lib::incompatibility_description(hypergraphs[i]));
+          return;
+        }
+      }
+      lib::prepare_context(c, session);
+      c.partition.num_vcycles = 0;
+      lib::execute(session, c, [&] {
+        PartitionerFacade::partitionBatch(hypergraphs, num_hypergraphs, c, partitioned_hgs);
+      });
+    }
+  }
+
+  void improve(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+               Context& c,
+               TargetGraph* target,
+               const size_t num_vcycles,
+               Session* session) {
+    if ( lib::check_if_all_relavant_parameters_are_set(c) ) {
+      if ( lib::check_compatibility(
+            partitioned_hg, lib::get_preset_c_type(c.partition.preset_type)) ) {
+        c.partition.instance_type = lib::get_instance_type(partitioned_hg);
+        c.partition.partition_type = to_partition_c_type(
+          c.partition.preset_type, c.partition.instance_type);
+        lib::prepare_context(c, session);
+        c.partition.num_vcycles = num_vcycles;
+        if ( target ) {
+          c.partition.objective = Objective::steiner_tree;
+        }
+        lib::execute(session, c, [&] {
+          PartitionerFacade::improve(partitioned_hg, c, target);
+        });
+      } else {
+        WARNING(lib::incompatibility_description(partitioned_hg));
+      }
+    }
+  }
+
 }
 
 
@@ -205,6 +279,21 @@ void mt_kahypar_initialize_thread_pool(const size_t num_threads,
   }
 }
 
+mt_kahypar_session_t* mt_kahypar_session_new(const size_t num_threads) {
+  return reinterpret_cast<mt_kahypar_session_t*>(new Session(num_threads));
+}
+
+void mt_kahypar_free_session(mt_kahypar_session_t* session) {
+  if (session == nullptr) {
+    return;
+  }
+  delete reinterpret_cast<Session*>(session);
+}
+
+size_t mt_kahypar_session_num_threads(const mt_kahypar_session_t* session) {
+  return reinterpret_cast<const Session*>(session)->numThreads();
+}
+
 mt_kahypar_hypergraph_t mt_kahypar_read_hypergraph_from_file(const char* file_name,
                                                              const mt_kahypar_preset_type_t preset,
                                                              const mt_kahypar_file_format_type_t file_format) {
@@ -229,16 +318,7 @@ mt_kahypar_hypergraph_t mt_kahypar_create_hypergraph(const mt_kahypar_preset_typ
                                                      const mt_kahypar_hyperedge_id_t* hyperedges,
                                                      const mt_kahypar_hyperedge_weight_t* hyperedge_weights,
                                                      const mt_kahypar_hypernode_weight_t* vertex_weights) {
-  // Transform adjacence array into adjacence list
-  vec<vec<HypernodeID>> edge_vector(num_hyperedges);
-  tbb::parallel_for<HyperedgeID>(0, num_hyperedges, [&](const mt_kahypar::HyperedgeID& he) {
-    const size_t num_pins = hyperedge_indices[he + 1] - hyperedge_indices[he];
-    edge_vector[he].resize(num_pins);
-    for ( size_t i = 0; i < num_pins; ++i ) {
-      edge_vector[he][i] = hyperedges[hyperedge_indices[he] + i];
-    }
-  });
-
+  // The factories consume the adjacence array directly
   switch ( preset ) {
     case DETERMINISTIC:
     case LARGE_K:
@@ -247,12 +327,12 @@ mt_kahypar_hypergraph_t mt_kahypar_create_hypergraph(const mt_kahypar_preset_typ
       return mt_kahypar_hypergraph_t {
         reinterpret_cast<mt_kahypar_hypergraph_s*>(new ds::StaticHypergraph(
           StaticHypergraphFactory::construct(num_vertices, num_hyperedges,
-            edge_vector, hyperedge_weights, vertex_weights))), STATIC_HYPERGRAPH };
+            hyperedge_indices, hyperedges, hyperedge_weights, vertex_weights))), STATIC_HYPERGRAPH };
     case HIGHEST_QUALITY:
       return mt_kahypar_hypergraph_t {
         reinterpret_cast<mt_kahypar_hypergraph_s*>(new ds::DynamicHypergraph(
           DynamicHypergraphFactory::construct(num_vertices, num_hyperedges,
-            edge_vector, hyperedge_weights, vertex_weights))), DYNAMIC_HYPERGRAPH };
+            hyperedge_indices, hyperedges, hyperedge_weights, vertex_weights))), DYNAMIC_HYPERGRAPH };
   }
   return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
 }
@@ -263,12 +343,6 @@ mt_kahypar_hypergraph_t mt_kahypar_create_graph(const mt_kahypar_preset_type_t p
                                                 const mt_kahypar_hypernode_id_t* edges,
                                                 const mt_kahypar_hyperedge_weight_t* edge_weights,
                                                 const mt_kahypar_hypernode_weight_t* vertex_weights) {
-  // Transform adjacence array into adjacence list
-  vec<std::pair<mt_kahypar::HypernodeID, mt_kahypar::HypernodeID>> edge_vector(num_edges);
-  tbb::parallel_for<mt_kahypar::HyperedgeID>(0, num_edges, [&](const mt_kahypar::HyperedgeID& he) {
-    edge_vector[he] = std::make_pair(edges[2*he], edges[2*he + 1]);
-  });
-
   switch ( preset ) {
     case DETERMINISTIC:
     case LARGE_K:
@@ -277,12 +351,19 @@ mt_kahypar_hypergraph_t mt_kahypar_create_graph(const mt_kahypar_preset_type_t p
       return mt_kahypar_hypergraph_t {
         reinterpret_cast<mt_kahypar_hypergraph_s*>(new ds::StaticGraph(
           StaticGraphFactory::construct_from_graph_edges(num_vertices, num_edges,
-            edge_vector, edge_weights, vertex_weights))), STATIC_GRAPH };
+            edges, edge_weights, vertex_weights))), STATIC_GRAPH };
     case HIGHEST_QUALITY:
+    {
+      // Transform adjacence array into adjacence list
+      vec<std::pair<mt_kahypar::HypernodeID, mt_kahypar::HypernodeID>> edge_vector(num_edges);
+      tbb::parallel_for<mt_kahypar::HyperedgeID>(0, num_edges, [&](const mt_kahypar::HyperedgeID& he) {
+        edge_vector[he] = std::make_pair(edges[2*he], edges[2*he + 1]);
+      });
       return mt_kahypar_hypergraph_t {
         reinterpret_cast<mt_kahypar_hypergraph_s*>(new ds::DynamicGraph(
           DynamicGraphFactory::construct_from_graph_edges(num_vertices, num_edges,
             edge_vector, edge_weights, vertex_weights))), DYNAMIC_GRAPH };
+    }
   }
   return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
 }
@@ -291,14 +372,8 @@ mt_kahypar_target_graph_t* mt_kahypar_create_target_graph(const mt_kahypar_hyper
                                                           const mt_kahypar_hyperedge_id_t num_edges,
                                                           const mt_kahypar_hypernode_id_t* edges,
                                                           const mt_kahypar_hyperedge_weight_t* edge_weights) {
-  // Transform adjacence array into adjacence list
-  vec<std::pair<mt_kahypar::HypernodeID, mt_kahypar::HypernodeID>> edge_vector(num_edges);
-  tbb::parallel_for<mt_kahypar::HyperedgeID>(0, num_edges, [&](const mt_kahypar::HyperedgeID& he) {
-    edge_vector[he] = std::make_pair(edges[2*he], edges[2*he + 1]);
-  });
-
   ds::StaticGraph graph = StaticGraphFactory::construct_from_graph_edges(
-    num_vertices, num_edges, edge_vector, edge_weights, nullptr);
+    num_vertices, num_edges, edges, edge_weights, nullptr);
   TargetGraph* target_graph = new TargetGraph(std::move(graph));
   return reinterpret_cast<mt_kahypar_target_graph_t*>(target_graph);
 }
@@ -369,41 +444,22 @@ MT_KAHYPAR_API bool mt_kahypar_check_compatibility(mt_kahypar_hypergraph_t hyper
 
 mt_kahypar_partitioned_hypergraph_t mt_kahypar_partition(mt_kahypar_hypergraph_t hypergraph,
                                                          mt_kahypar_context_t* context) {
-  Context& c = *reinterpret_cast<Context*>(context);
-  if ( lib::check_if_all_relavant_parameters_are_set(c) ) {
-    if ( mt_kahypar_check_compatibility(hypergraph, lib::get_preset_c_type(c.partition.preset_type)) ) {
-      c.partition.instance_type = lib::get_instance_type(hypergraph);
-      c.partition.partition_type = to_partition_c_type(
-        c.partition.preset_type, c.partition.instance_type);
-      lib::prepare_context(c);
-      c.partition.num_vcycles = 0;
-      return PartitionerFacade::partition(hypergraph, c);
-    } else {
-      WARNING(lib::incompatibility_description(hypergraph));
-    }
-  }
-  return mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
+  return partition(hypergraph, *reinterpret_cast<Context*>(context), nullptr, nullptr);
+}
+
+void mt_kahypar_partition_batch(const mt_kahypar_hypergraph_t* hypergraphs,
+                                const size_t num_hypergraphs,
+                                const mt_kahypar_context_t* context,
+                                mt_kahypar_partitioned_hypergraph_t* partitioned_hgs) {
+  Context c(*reinterpret_cast<const Context*>(context));
+  partition_batch(hypergraphs, num_hypergraphs, c, partitioned_hgs, nullptr);
 }
 
 mt_kahypar_partitioned_hypergraph_t mt_kahypar_map(mt_kahypar_hypergraph_t hypergraph,
                                                    mt_kahypar_target_graph_t* target_graph,
                                                    mt_kahypar_context_t* context) {
-  Context& c = *reinterpret_cast<Context*>(context);
-  if ( lib::check_if_all_relavant_parameters_are_set(c) ) {
-    if ( mt_kahypar_check_compatibility(hypergraph, lib::get_preset_c_type(c.partition.preset_type)) ) {
-      c.partition.instance_type = lib::get_instance_type(hypergraph);
-      c.partition.partition_type = to_partition_c_type(
-        c.partition.preset_type, c.partition.instance_type);
-      lib::prepare_context(c);
-      c.partition.num_vcycles = 0;
-      c.partition.objective = Objective::steiner_tree;
-      TargetGraph* target = reinterpret_cast<TargetGraph*>(target_graph);
-      return PartitionerFacade::partition(hypergraph, c, target);
-    } else {
-      WARNING(lib::incompatibility_description(hypergraph));
-    }
-  }
-  return mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
+  return partition(hypergraph, *reinterpret_cast<Context*>(context),
+    reinterpret_cast<TargetGraph*>(target_graph), nullptr);
 }
 
 MT_KAHYPAR_API bool mt_kahypar_check_partition_compatibility(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
@@ -414,42 +470,58 @@ MT_KAHYPAR_API bool mt_kahypar_check_partition_compatibility(mt_kahypar_partitio
 void mt_kahypar_improve_partition(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                                   mt_kahypar_context_t* context,
                                   const size_t num_vcycles) {
-  Context& c = *reinterpret_cast<Context*>(context);
-  if ( lib::check_if_all_relavant_parameters_are_set(c) ) {
-    if ( mt_kahypar_check_partition_compatibility(
-          partitioned_hg, lib::get_preset_c_type(c.partition.preset_type)) ) {
-      c.partition.instance_type = lib::get_instance_type(partitioned_hg);
-      c.partition.partition_type = to_partition_c_type(
-        c.partition.preset_type, c.partition.instance_type);
-      lib::prepare_context(c);
-      c.partition.num_vcycles = num_vcycles;
-      PartitionerFacade::improve(partitioned_hg, c);
-    } else {
-      WARNING(lib::incompatibility_description(partitioned_hg));
-    }
-  }
+  improve(partitioned_hg, *reinterpret_cast<Context*>(context), nullptr, num_vcycles, nullptr);
 }
 
 void mt_kahypar_improve_mapping(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                                                mt_kahypar_target_graph_t* target_graph,
                                                mt_kahypar_context_t* context,
                                                const size_t num_vcycles) {
-  Context& c = *reinterpret_cast<Context*>(context);
-  if ( lib::check_if_all_relavant_parameters_are_set(c) ) {
-    if ( mt_kahypar_check_partition_compatibility(
-          partitioned_hg, lib::get_preset_c_type(c.partition.preset_type)) ) {
-      c.partition.instance_type = lib::get_instance_type(partitioned_hg);
-      c.partition.partition_type = to_partition_c_type(
-        c.partition.preset_type, c.partition.instance_type);
-      lib::prepare_context(c);
-      c.partition.num_vcycles = num_vcycles;
-      c.partition.objective = Objective::steiner_tree;
-      TargetGraph* target = reinterpret_cast<TargetGraph*>(target_graph);
-      PartitionerFacade::improve(partitioned_hg, c, target);
-    } else {
-      WARNING(lib::incompatibility_description(partitioned_hg));
-    }
-  }
+  improve(partitioned_hg, *reinterpret_cast<Context*>(context),
+    reinterpret_cast<TargetGraph*>(target_graph), num_vcycles, nullptr);
+}
+
+mt_kahypar_partitioned_hypergraph_t mt_kahypar_session_partition(mt_kahypar_session_t* session,
+                                                                 mt_kahypar_hypergraph_t hypergraph,
+                                                                 const mt_kahypar_context_t* context) {
+  Context c(*reinterpret_cast<const Context*>(context));
+  return partition(hypergraph, c, nullptr, reinterpret_cast<Session*>(session));
+}
+
+void mt_kahypar_session_partition_batch(mt_kahypar_session_t* session,
+                                        const mt_kahypar_hypergraph_t* hypergraphs,
+                                        const size_t num_hypergraphs,
+                                        const mt_kahypar_context_t* context,
+                                        mt_kahypar_partitioned_hypergraph_t* partitioned_hgs) {
+  Context c(*reinterpret_cast<const Context*>(context));
+  partition_batch(hypergraphs, num_hypergraphs, c, partitioned_hgs, reinterpret_cast<Session*>(session));
+}
+
+mt_kahypar_partitioned_hypergraph_t mt_kahypar_session_map(mt_kahypar_session_t* session,
+                                                           mt_kahypar_hypergraph_t hypergraph,
+                                                           mt_kahypar_target_graph_t* target_graph,
+                                                           const mt_kahypar_context_t* context) {
+  Context c(*reinterpret_cast<const Context*>(context));
+  return partition(hypergraph, c, reinterpret_cast<TargetGraph*>(target_graph),
+    reinterpret_cast<Session*>(session));
+}
+
+void mt_kahypar_session_improve_partition(mt_kahypar_session_t* session,
+                                          mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                          const mt_kahypar_context_t* context,
+                                          const size_t num_vcycles) {
+  Context c(*reinterpret_cast<const Context*>(context));
+  improve(partitioned_hg, c, nullptr, num_vcycles, reinterpret_cast<Session*>(session));
+}
+
+void mt_kahypar_session_improve_mapping(mt_kahypar_session_t* session,
+                                        mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                        mt_kahypar_target_graph_t* target_graph,
+                                        const mt_kahypar_context_t* context,
+                                        const size_t num_vcycles) {
+  Context c(*reinterpret_cast<const Context*>(context));
+  improve(partitioned_hg, c, reinterpret_cast<TargetGraph*>(target_graph),
+    num_vcycles, reinterpret_cast<Session*>(session));
 }
 
 mt_kahypar_partitioned_hypergraph_t mt_kahypar_create_partitioned_hypergraph(mt_kahypar_hypergraph_t hypergraph,
@@ -36,6 +36,7 @@
 #include "tbb//parallel_invoke.h"
 
 #include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/huge_page_allocator.h"
 #include "mt-kahypar/parallel/memory_pool.h"
 #include "mt-kahypar/parallel/stl/scalable_unique_ptr.h"
 
@@ -359,7 +360,7 @@ class Array {
 
  private:
   void allocate_data(const size_type size) {
-    _data = parallel::make_unique<value_type>(size);
+    _data = parallel::make_huge_page_unique<value_type>(size);
     _underlying_data = _data.get();
     _size = size;
   }
@@ -367,7 +368,7 @@ class Array {
   std::string _group;
   std::string _key;
   size_type _size;
-  parallel::tbb_unique_ptr<value_type> _data;
+  parallel::huge_page_unique_ptr<value_type> _data;
   value_type* _underlying_data;
 };
 
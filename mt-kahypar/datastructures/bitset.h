@@ -31,6 +31,7 @@
 
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
+#include "mt-kahypar/utils/bit_ops.h"
 
 namespace mt_kahypar {
 namespace ds {
@@ -99,6 +100,18 @@ class Bitset {
     _bitset[block_idx] |= (static_cast<Block>(1) << idx);
   }
 
+  // ! Atomically sets the bit at position pos and returns true,
+  // ! if the bit was not set before
+  bool atomicSet(const size_t pos) {
+    ASSERT(pos < _size);
+    const size_t block_idx = pos >> DIV_SHIFT; // pos / BITS_PER_BLOCK;
+    const Block mask = static_cast<Block>(1) << (pos & MOD_MASK);
+    if ( __atomic_load_n(&_bitset[block_idx], __ATOMIC_RELAXED) & mask ) {
+      return false;
+    }
+    return !( __atomic_fetch_or(&_bitset[block_idx], mask, __ATOMIC_RELAXED) & mask );
+  }
+
   void unset(const size_t pos) {
     ASSERT(pos < _size);
     const size_t block_idx = pos >> DIV_SHIFT; // pos / BITS_PER_BLOCK;
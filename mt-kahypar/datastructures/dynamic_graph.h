@@ -414,12 +414,12 @@ class DynamicGraph {
   }
 
   // ! Initial number of pins
-  HypernodeID initialNumPins() const {
+  size_t initialNumPins() const {
     return _num_edges;
   }
 
   // ! Initial sum of the degree of all vertices
-  HypernodeID initialTotalVertexDegree() const {
+  size_t initialTotalVertexDegree() const {
     return _num_edges;
   }
 
@@ -428,6 +428,17 @@ class DynamicGraph {
     return _total_weight;
   }
 
+  // ! Unit weights are not tracked for dynamic graphs since
+  // ! weights change with each contraction
+  bool hasUnitNodeWeights() const {
+    return false;
+  }
+
+  // ! Unit weights are not tracked for dynamic graphs
+  bool hasUnitEdgeWeights() const {
+    return false;
+  }
+
   // ! Recomputes the total weight of the hypergraph (parallel)
   void updateTotalWeight(parallel_tag_t);
 
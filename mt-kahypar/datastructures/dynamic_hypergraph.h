@@ -520,20 +520,38 @@ class DynamicHypergraph {
   }
 
   // ! Initial number of pins
-  HypernodeID initialNumPins() const {
+  size_t initialNumPins() const {
     return _num_pins;
   }
 
   // ! Initial sum of the degree of all vertices
-  HypernodeID initialTotalVertexDegree() const {
+  size_t initialTotalVertexDegree() const {
     return _total_degree;
   }
 
+  // ! Only for testing
+  void setInitialNumPinsAndTotalVertexDegree(const size_t num_pins,
+                                             const size_t total_degree) {
+    _num_pins = num_pins;
+    _total_degree = total_degree;
+  }
+
   // ! Total weight of hypergraph
   HypernodeWeight totalWeight() const {
     return _total_weight;
   }
 
+  // ! Unit weights are not tracked for dynamic hypergraphs since
+  // ! weights change with each contraction
+  bool hasUnitNodeWeights() const {
+    return false;
+  }
+
+  // ! Unit weights are not tracked for dynamic hypergraphs
+  bool hasUnitEdgeWeights() const {
+    return false;
+  }
+
   // ! Recomputes the total weight of the hypergraph (parallel)
   void updateTotalWeight(parallel_tag_t);
 
@@ -1072,9 +1090,9 @@ class DynamicHypergraph {
   // ! Maximum size of a hyperedge
   HypernodeID _max_edge_size;
   // ! Number of pins
-  HypernodeID _num_pins;
+  size_t _num_pins;
   // ! Total degree of all vertices
-  HypernodeID _total_degree;
+  size_t _total_degree;
   // ! Total weight of hypergraph
   HypernodeWeight _total_weight;
   // ! Version of the hypergraph, each time we remove a single-pin and parallel nets,
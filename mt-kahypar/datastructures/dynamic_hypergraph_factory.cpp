@@ -46,6 +46,38 @@ DynamicHypergraph DynamicHypergraphFactory::construct(
         const HyperedgeWeight* hyperedge_weight,
         const HypernodeWeight* hypernode_weight,
         const bool) {
+  return construct_impl(num_hypernodes, num_hyperedges,
+    edge_vector, hyperedge_weight, hypernode_weight);
+}
+
+template<typename PinID>
+DynamicHypergraph DynamicHypergraphFactory::construct(
+        const HypernodeID num_hypernodes,
+        const HyperedgeID num_hyperedges,
+        const size_t* hyperedge_indices,
+        const PinID* hyperedges,
+        const HyperedgeWeight* hyperedge_weight,
+        const HypernodeWeight* hypernode_weight,
+        const bool) {
+  return construct_impl(num_hypernodes, num_hyperedges,
+    HyperedgeVectorView<PinID>(num_hyperedges, hyperedge_indices, hyperedges),
+    hyperedge_weight, hypernode_weight);
+}
+
+#define DYNAMIC_HYPERGRAPH_CSR_CONSTRUCT(PIN_TYPE)                              \
+  template DynamicHypergraph DynamicHypergraphFactory::construct<PIN_TYPE>(    \
+    const HypernodeID, const HyperedgeID, const size_t*, const PIN_TYPE*,      \
+    const HyperedgeWeight*, const HypernodeWeight*, const bool);
+
+MT_KAHYPAR_INSTANTIATE_FOR_PIN_TYPES(DYNAMIC_HYPERGRAPH_CSR_CONSTRUCT)
+
+template<typename EdgeVector>
+DynamicHypergraph DynamicHypergraphFactory::construct_impl(
+        const HypernodeID num_hypernodes,
+        const HyperedgeID num_hyperedges,
+        const EdgeVector& edge_vector,
+        const HyperedgeWeight* hyperedge_weight,
+        const HypernodeWeight* hypernode_weight) {
   DynamicHypergraph hypergraph;
   hypergraph._num_hypernodes = num_hypernodes;
   hypergraph._num_hyperedges = num_hyperedges;
@@ -103,7 +135,7 @@ DynamicHypergraph DynamicHypergraphFactory::construct(
 
       size_t incidence_array_pos = hyperedge.firstEntry();
       size_t hash = kEdgeHashSeed;
-      for ( const HypernodeID& pin : edge_vector[pos] ) {
+      for ( const HypernodeID pin : edge_vector[pos] ) {
         ASSERT(incidence_array_pos < hyperedge.firstInvalidEntry());
         ASSERT(pin < num_hypernodes);
         // Compute hash of hyperedge
@@ -31,6 +31,7 @@
 
 
 #include "mt-kahypar/datastructures/dynamic_hypergraph.h"
+#include "mt-kahypar/datastructures/edge_vector_views.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
 
@@ -55,6 +56,18 @@ class DynamicHypergraphFactory {
                                     const HypernodeWeight* hypernode_weight = nullptr,
                                     const bool stable_construction_of_incident_edges = false);
 
+  // ! Constructs the hypergraph directly from an adjacency array (CSR format) without
+  // ! building an intermediate edge vector. The pins of hyperedge e are stored in
+  // ! hyperedges[hyperedge_indices[e]], ..., hyperedges[hyperedge_indices[e + 1] - 1].
+  template<typename PinID>
+  static DynamicHypergraph construct(const HypernodeID num_hypernodes,
+                                     const HyperedgeID num_hyperedges,
+                                     const size_t* hyperedge_indices,
+                                     const PinID* hyperedges,
+                                     const HyperedgeWeight* hyperedge_weight = nullptr,
+                                     const HypernodeWeight* hypernode_weight = nullptr,
+                                     const bool stable_construction_of_incident_edges = false);
+
   /**
    * Compactifies a given hypergraph such that it only contains enabled vertices and hyperedges within
    * a consecutive range of IDs.
@@ -64,6 +77,13 @@ class DynamicHypergraphFactory {
 
  private:
   DynamicHypergraphFactory() { }
+
+  template<typename EdgeVector>
+  static DynamicHypergraph construct_impl(const HypernodeID num_hypernodes,
+                                          const HyperedgeID num_hyperedges,
+                                          const EdgeVector& edge_vector,
+                                          const HyperedgeWeight* hyperedge_weight,
+                                          const HypernodeWeight* hypernode_weight);
 };
 
 } // namespace ds
@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <utility>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+
+namespace mt_kahypar {
+namespace ds {
+
+/*!
+ * Non-owning view of hyperedges stored in an adjacency array (CSR format).
+ * The pins of hyperedge e are stored in hyperedges[hyperedge_indices[e]], ...,
+ * hyperedges[hyperedge_indices[e + 1] - 1]. The view provides the same interface
+ * as a vector of pin vectors such that the hypergraph factories can consume
+ * the arrays without materializing a separate vector for each hyperedge.
+ */
+template<typename PinID>
+class HyperedgeVectorView {
+
+ public:
+  class Pins {
+   public:
+    Pins(const PinID* begin, const PinID* end) :
+      _begin(begin),
+      _end(end) { }
+
+    const PinID* begin() const {
+      return _begin;
+    }
+
+    const PinID* end() const {
+      return _end;
+    }
+
+    size_t size() const {
+      return _end - _begin;
+    }
+
+   private:
+    const PinID* _begin;
+    const PinID* _end;
+  };
+
+  HyperedgeVectorView(const HyperedgeID num_hyperedges,
+                      const size_t* hyperedge_indices,
+                      const PinID* hyperedges) :
+    _num_hyperedges(num_hyperedges),
+    _hyperedge_indices(hyperedge_indices),
+    _hyperedges(hyperedges) { }
+
+  size_t size() const {
+    return _num_hyperedges;
+  }
+
+  Pins operator[](const size_t he) const {
+    ASSERT(he < _num_hyperedges);
+    return Pins(_hyperedges + _hyperedge_indices[he],
+                _hyperedges + _hyperedge_indices[he + 1]);
+  }
+
+ private:
+  const HyperedgeID _num_hyperedges;
+  const size_t* _hyperedge_indices;
+  const PinID* _hyperedges;
+};
+
+/*!
+ * Non-owning view of the edges of a graph stored in a flat array, where
+ * edge e connects edges[2 * e] and edges[2 * e + 1]. The view provides the
+ * same interface as a vector of node pairs.
+ */
+template<typename PinID>
+class GraphEdgeVectorView {
+
+ public:
+  GraphEdgeVectorView(const HyperedgeID num_edges,
+                      const PinID* edges) :
+    _num_edges(num_edges),
+    _edges(edges) { }
+
+  size_t size() const {
+    return _num_edges;
+  }
+
+  std::pair<HypernodeID, HypernodeID> operator[](const size_t e) const {
+    ASSERT(e < _num_edges);
+    return std::make_pair(static_cast<HypernodeID>(_edges[2 * e]),
+                          static_cast<HypernodeID>(_edges[2 * e + 1]));
+  }
+
+ private:
+  const HyperedgeID _num_edges;
+  const PinID* _edges;
+};
+
+// Pin types for which the factories provide construction from flat arrays
+#define MT_KAHYPAR_INSTANTIATE_FOR_PIN_TYPES(MACRO)                                  \
+  MACRO(unsigned int)                                                                \
+  MACRO(unsigned long)                                                               \
+  MACRO(unsigned long long)
+
+}  // namespace ds
+}  // namespace mt_kahypar
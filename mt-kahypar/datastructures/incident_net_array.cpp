@@ -26,6 +26,7 @@
  ******************************************************************************/
 
 #include "mt-kahypar/datastructures/incident_net_array.h"
+#include "mt-kahypar/datastructures/edge_vector_views.h"
 
 #include "mt-kahypar/parallel/parallel_prefix_sum.h"
 
@@ -363,7 +364,8 @@ void IncidentNetArray::removeEmptyIncidentNetList(const HypernodeID u) {
   head->it_prev = u;
 }
 
-void IncidentNetArray::construct(const HyperedgeVector& edge_vector) {
+template<typename EdgeVector>
+void IncidentNetArray::construct(const EdgeVector& edge_vector) {
   // Accumulate degree of each vertex thread local
   const HyperedgeID num_hyperedges = edge_vector.size();
   ThreadLocalCounter local_incident_nets_per_vertex(_num_hypernodes + 1, 0);
@@ -372,7 +374,7 @@ void IncidentNetArray::construct(const HyperedgeVector& edge_vector) {
     tbb::parallel_for(ID(0), num_hyperedges, [&](const size_t pos) {
       parallel::scalable_vector<size_t>& num_incident_nets_per_vertex =
         local_incident_nets_per_vertex.local();
-      for ( const HypernodeID& pin : edge_vector[pos] ) {
+      for ( const HypernodeID pin : edge_vector[pos] ) {
         ASSERT(pin < _num_hypernodes, V(pin) << V(_num_hypernodes));
         ++num_incident_nets_per_vertex[pin + 1];
       }
@@ -401,7 +403,7 @@ void IncidentNetArray::construct(const HyperedgeVector& edge_vector) {
 
   // Insert incident nets into incidence array
   tbb::parallel_for(ID(0), num_hyperedges, [&](const HyperedgeID he) {
-    for ( const HypernodeID& pin : edge_vector[he] ) {
+    for ( const HypernodeID pin : edge_vector[he] ) {
       Entry* entry = firstEntry(pin) + current_incident_net_pos[pin]++;
       entry->e = he;
       entry->version = 0;
@@ -422,6 +424,13 @@ void IncidentNetArray::construct(const HyperedgeVector& edge_vector) {
   });
 }
 
+template void IncidentNetArray::construct(const HyperedgeVector& edge_vector);
+
+#define INCIDENT_NET_ARRAY_CSR_CONSTRUCT(PIN_TYPE)                                \
+  template void IncidentNetArray::construct(const HyperedgeVectorView<PIN_TYPE>& edge_vector);
+
+MT_KAHYPAR_INSTANTIATE_FOR_PIN_TYPES(INCIDENT_NET_ARRAY_CSR_CONSTRUCT)
+
 bool IncidentNetArray::verifyIteratorPointers(const HypernodeID u) const {
   HypernodeID current_u = u;
   HypernodeID last_non_empty_entry = kInvalidHypernode;
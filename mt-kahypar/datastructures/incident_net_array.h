@@ -158,8 +158,9 @@ class IncidentNetArray {
     _index_array(),
     _incident_net_array(nullptr) { }
 
+  template<typename EdgeVector = HyperedgeVector>
   IncidentNetArray(const HypernodeID num_hypernodes,
-                   const HyperedgeVector& edge_vector) :
+                   const EdgeVector& edge_vector) :
     _num_hypernodes(num_hypernodes),
     _size_in_bytes(0),
     _index_array(),
@@ -295,7 +296,8 @@ class IncidentNetArray {
 
   void removeEmptyIncidentNetList(const HypernodeID u);
 
-  void construct(const HyperedgeVector& edge_vector);
+  template<typename EdgeVector>
+  void construct(const EdgeVector& edge_vector);
 
   bool verifyIteratorPointers(const HypernodeID u) const;
 
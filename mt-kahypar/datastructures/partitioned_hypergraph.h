@@ -204,12 +204,12 @@ class PartitionedHypergraph {
   }
 
   // ! Initial number of pins
-  HypernodeID initialNumPins() const {
+  size_t initialNumPins() const {
     return _hg->initialNumPins();
   }
 
   // ! Initial sum of the degree of all vertices
-  HypernodeID initialTotalVertexDegree() const {
+  size_t initialTotalVertexDegree() const {
     return _hg->initialTotalVertexDegree();
   }
 
@@ -218,6 +218,16 @@ class PartitionedHypergraph {
     return _hg->totalWeight();
   }
 
+  // ! Returns true, if all vertices of the underlying hypergraph have weight one
+  bool hasUnitNodeWeights() const {
+    return _hg->hasUnitNodeWeights();
+  }
+
+  // ! Returns true, if all hyperedges of the underlying hypergraph have weight one
+  bool hasUnitEdgeWeights() const {
+    return _hg->hasUnitEdgeWeights();
+  }
+
   // ! Number of blocks this hypergraph is partitioned into
   PartitionID k() const {
     return _k;
@@ -305,7 +315,9 @@ class PartitionedHypergraph {
 
   // ! Weight of a vertex
   HypernodeWeight nodeWeight(const HypernodeID u) const {
-    return _hg->nodeWeight(u);
+    // Avoids loading the vertex on unweighted inputs, e.g. for the balance
+    // checks in changeNodePart(...)
+    return _hg->hasUnitNodeWeights() ? 1 : _hg->nodeWeight(u);
   }
 
   // ! Sets the weight of a vertex
@@ -535,6 +547,11 @@ class PartitionedHypergraph {
     return _part_ids[u];
   }
 
+  // ! Block IDs of all vertices (indexed by vertex ID)
+  const PartitionID* partIDs() const {
+    return _part_ids.data();
+  }
+
   void extractPartIDs(Array<PartitionID>& part_ids) {
     // If we pass the input hypergraph to initial partitioning, then initial partitioning
     // will pass an part ID vector of size |V'|, where V' are the number of nodes of
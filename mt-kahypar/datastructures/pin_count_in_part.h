@@ -31,6 +31,7 @@
 #include <cmath>
 
 #include "tbb/enumerable_thread_specific.h"
+#include "tbb/concurrent_vector.h"
 
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/datastructures/hypergraph_common.h"
@@ -49,6 +50,12 @@ namespace ds {
  * each entry occupies exactly the number of bits it requires to store the
  * maximum value. To do so, we store several pin count entries in a 64-bit unsigned
  * integer.
+ * Since a single large hyperedge would force wide entries for all hyperedges,
+ * the packed entries use at most SMALL_TIER_MAX_BITS bits if this reduces the
+ * number of 64-bit values per hyperedge (e.g., not for small k). Once a pin count of
+ * a hyperedge exceeds the range of the packed entries, the hyperedge is promoted
+ * to a second tier that stores full-width counters for all blocks of the
+ * hyperedge. Promotions are permanent until the data structure is reset.
  * Note, this data structure is not thread-safe. Updates of a pin count entry
  * of a hyperedge must be done exclusively. Different hyperedges can be updated
  * concurrently.
@@ -60,16 +67,23 @@ class PinCountInPart {
  public:
   using Value = uint64_t;
 
+  // ! Maximum number of bits used per packed pin count entry
+  static constexpr size_t SMALL_TIER_MAX_BITS = 8;
+
   PinCountInPart() :
     _num_hyperedges(0),
     _k(0),
     _max_value(0),
+    _small_max_value(0),
     _bits_per_element(0),
     _entries_per_value(0),
     _values_per_hyperedge(0),
     _extraction_mask(0),
     _pin_count_in_part(),
-    _ets_pin_counts([&] { return initPinCountSnapshot(); }) { }
+    _large_index(),
+    _large_pin_counts(),
+    _ets_pin_counts([&] { return initPinCountSnapshot(); }),
+    _ets_large_pin_counts([&] { return initLargePinCountSnapshot(); }) { }
 
   PinCountInPart(const HyperedgeID num_hyperedges,
                  const PartitionID k,
@@ -78,12 +92,16 @@ class PinCountInPart {
     _num_hyperedges(0),
     _k(0),
     _max_value(0),
+    _small_max_value(0),
     _bits_per_element(0),
     _entries_per_value(0),
     _values_per_hyperedge(0),
     _extraction_mask(0),
     _pin_count_in_part(),
-    _ets_pin_counts([&] { return initPinCountSnapshot(); }) {
+    _large_index(),
+    _large_pin_counts(),
+    _ets_pin_counts([&] { return initPinCountSnapshot(); }),
+    _ets_large_pin_counts([&] { return initLargePinCountSnapshot(); }) {
     initialize(num_hyperedges, k, max_value, assign_parallel);
   }
 
@@ -94,23 +112,31 @@ class PinCountInPart {
     _num_hyperedges(other._num_hyperedges),
     _k(other._k),
     _max_value(other._max_value),
+    _small_max_value(other._small_max_value),
     _bits_per_element(other._bits_per_element),
     _entries_per_value(other._entries_per_value),
     _values_per_hyperedge(other._values_per_hyperedge),
     _extraction_mask(other._extraction_mask),
     _pin_count_in_part(std::move(other._pin_count_in_part)),
-    _ets_pin_counts([&] { return initPinCountSnapshot(); }) { }
+    _large_index(std::move(other._large_index)),
+    _large_pin_counts(std::move(other._large_pin_counts)),
+    _ets_pin_counts([&] { return initPinCountSnapshot(); }),
+    _ets_large_pin_counts([&] { return initLargePinCountSnapshot(); }) { }
 
   PinCountInPart & operator= (PinCountInPart&& other) {
     _num_hyperedges = other._num_hyperedges;
     _k = other._k;
     _max_value = other._max_value;
+    _small_max_value = other._small_max_value;
     _bits_per_element = other._bits_per_element;
     _entries_per_value = other._entries_per_value;
     _values_per_hyperedge = other._values_per_hyperedge;
     _extraction_mask = other._extraction_mask;
     _pin_count_in_part = std::move(other._pin_count_in_part);
+    _large_index = std::move(other._large_index);
+    _large_pin_counts = std::move(other._large_pin_counts);
     _ets_pin_counts = tbb::enumerable_thread_specific<PinCountSnapshot>([&] { return initPinCountSnapshot(); });
+    _ets_large_pin_counts = tbb::enumerable_thread_specific<PinCountSnapshot>([&] { return initLargePinCountSnapshot(); });
     return *this;
   }
 
@@ -124,31 +150,62 @@ class PinCountInPart {
       _num_hyperedges = num_hyperedges;
       _k = k;
       _max_value = max_value;
-      _bits_per_element = num_bits_per_element(max_value);
-      _entries_per_value = num_entries_per_value(k, max_value);
-      _values_per_hyperedge = num_values_per_hyperedge(k, max_value);
+      _small_max_value = small_tier_max_value(k, max_value);
+      _bits_per_element = num_bits_per_element(_small_max_value);
+      _entries_per_value = num_entries_per_value(k, _small_max_value);
+      _values_per_hyperedge = num_values_per_hyperedge(k, _small_max_value);
       _extraction_mask = std::pow(2UL, _bits_per_element) - UL(1);
       _pin_count_in_part.resize("Refinement", "pin_count_in_part",
         num_hyperedges * _values_per_hyperedge, true, assign_parallel);
+      if ( isTwoTier() ) {
+        _large_index.resize(num_hyperedges, kInvalidHyperedge, assign_parallel);
+      }
     }
   }
 
   void reset(const bool assign_parallel = true) {
     _pin_count_in_part.assign(_pin_count_in_part.size(), 0, assign_parallel);
+    if ( isTwoTier() ) {
+      _large_index.assign(_large_index.size(), kInvalidHyperedge, assign_parallel);
+      _large_pin_counts.clear();
+    }
   }
 
   // ! Returns a snapshot of the connectivity set of hyperedge he
   inline PinCountSnapshot& snapshot(const HyperedgeID he) {
+    const HyperedgeID large_pos = largePosition(he);
+    if ( large_pos != kInvalidHyperedge ) {
+      PinCountSnapshot& cpy = _ets_large_pin_counts.local();
+      const size_t start = UL(large_pos) * _k;
+      for ( PartitionID block = 0; block < _k; ++block ) {
+        cpy.setPinCountInPart(block, _large_pin_counts[start + block]);
+      }
+      return cpy;
+    }
     PinCountSnapshot& cpy = _ets_pin_counts.local();
     cpy.snapshot(_pin_count_in_part.data() + he * _values_per_hyperedge);
     return cpy;
   }
 
+  // ! Returns whether or not the pin counts of hyperedge he are stored in full-width counters
+  inline bool isLarge(const HyperedgeID he) const {
+    return largePosition(he) != kInvalidHyperedge;
+  }
+
+  // ! Number of hyperedges promoted to full-width counters
+  size_t numLargeHyperedges() const {
+    return _k > 0 ? _large_pin_counts.size() / _k : 0;
+  }
+
   // ! Returns the pin count of the hyperedge in the corresponding block
   inline HypernodeID pinCountInPart(const HyperedgeID he,
                                     const PartitionID id) const {
     ASSERT(he < _num_hyperedges);
     ASSERT(id != kInvalidPartition && id < _k);
+    const HyperedgeID large_pos = largePosition(he);
+    if ( large_pos != kInvalidHyperedge ) {
+      return _large_pin_counts[UL(large_pos) * _k + id];
+    }
     const size_t value_pos = he * _values_per_hyperedge + id / _entries_per_value;
     const size_t bit_pos = (id % _entries_per_value) * _bits_per_element;
     const Value mask = _extraction_mask << bit_pos;
@@ -161,6 +218,15 @@ class PinCountInPart {
                                 const HypernodeID value) {
     ASSERT(he < _num_hyperedges);
     ASSERT(id != kInvalidPartition && id < _k);
+    ASSERT(value <= _max_value);
+    HyperedgeID large_pos = largePosition(he);
+    if ( large_pos == kInvalidHyperedge && value > _small_max_value ) {
+      large_pos = promote(he);
+    }
+    if ( large_pos != kInvalidHyperedge ) {
+      _large_pin_counts[UL(large_pos) * _k + id] = value;
+      return;
+    }
     const size_t value_pos = he * _values_per_hyperedge + id / _entries_per_value;
     const size_t bit_pos = (id % _entries_per_value) * _bits_per_element;
     updateEntry(_pin_count_in_part[value_pos], bit_pos, value);
@@ -171,12 +237,21 @@ class PinCountInPart {
                                              const PartitionID id) {
     ASSERT(he < _num_hyperedges);
     ASSERT(id != kInvalidPartition && id < _k);
+    HyperedgeID large_pos = largePosition(he);
+    if ( large_pos != kInvalidHyperedge ) {
+      ASSERT(_large_pin_counts[UL(large_pos) * _k + id] + 1 <= _max_value);
+      return ++_large_pin_counts[UL(large_pos) * _k + id];
+    }
     const size_t value_pos = he * _values_per_hyperedge + id / _entries_per_value;
     const size_t bit_pos = (id % _entries_per_value) * _bits_per_element;
     const Value mask = _extraction_mask << bit_pos;
     Value& current_value = _pin_count_in_part[value_pos];
     Value pin_count_in_part = (current_value & mask) >> bit_pos;
     ASSERT(pin_count_in_part + 1 <= _max_value);
+    if ( pin_count_in_part + 1 > _small_max_value ) {
+      large_pos = promote(he);
+      return ++_large_pin_counts[UL(large_pos) * _k + id];
+    }
     updateEntry(current_value, bit_pos, pin_count_in_part + 1);
     return pin_count_in_part + 1;
   }
@@ -186,6 +261,11 @@ class PinCountInPart {
                                              const PartitionID id) {
     ASSERT(he < _num_hyperedges);
     ASSERT(id != kInvalidPartition && id < _k);
+    const HyperedgeID large_pos = largePosition(he);
+    if ( large_pos != kInvalidHyperedge ) {
+      ASSERT(_large_pin_counts[UL(large_pos) * _k + id] > 0);
+      return --_large_pin_counts[UL(large_pos) * _k + id];
+    }
     const size_t value_pos = he * _values_per_hyperedge + id / _entries_per_value;
     const size_t bit_pos = (id % _entries_per_value) * _bits_per_element;
     const Value mask = _extraction_mask << bit_pos;
@@ -198,38 +278,89 @@ class PinCountInPart {
 
   // ! Returns the size in bytes of this data structure
   size_t size_in_bytes() const {
-    return sizeof(Value) * _pin_count_in_part.size();
+    return sizeof(Value) * _pin_count_in_part.size() +
+      sizeof(HyperedgeID) * _large_index.size() +
+      sizeof(HypernodeID) * _large_pin_counts.size();
   }
 
   void freeInternalData() {
     parallel::free(_pin_count_in_part);
+    parallel::free(_large_index);
+    _large_pin_counts.clear();
+    _large_pin_counts.shrink_to_fit();
   }
 
   void memoryConsumption(utils::MemoryTreeNode* parent) const {
     ASSERT(parent);
     parent->addChild("Pin Count Values", sizeof(Value) * _pin_count_in_part.size());
+    if ( isTwoTier() ) {
+      parent->addChild("Large Pin Count Values",
+        sizeof(HyperedgeID) * _large_index.size() +
+        sizeof(HypernodeID) * _large_pin_counts.size());
+    }
   }
 
   static size_t num_elements(const HyperedgeID num_hyperedges,
                              const PartitionID k,
                              const HypernodeID max_value) {
-    return num_hyperedges * num_values_per_hyperedge(k, max_value);
+    return num_hyperedges * num_values_per_hyperedge(k, small_tier_max_value(k, max_value));
   }
 
  private:
+  bool isTwoTier() const {
+    return _small_max_value < _max_value;
+  }
+
+  inline HyperedgeID largePosition(const HyperedgeID he) const {
+    ASSERT(he < _num_hyperedges);
+    return isTwoTier() ? __atomic_load_n(&_large_index[he], __ATOMIC_ACQUIRE) : kInvalidHyperedge;
+  }
+
+  // ! Moves the pin counts of hyperedge he to full-width counters.
+  // ! Updates of a hyperedge are exclusive, which is why only the
+  // ! growth of the large tier has to be synchronized.
+  HyperedgeID promote(const HyperedgeID he) {
+    ASSERT(isTwoTier() && !isLarge(he));
+    const size_t start = _large_pin_counts.grow_by(_k) - _large_pin_counts.begin();
+    const size_t value_start = he * _values_per_hyperedge;
+    for ( PartitionID block = 0; block < _k; ++block ) {
+      const size_t bit_pos = (block % _entries_per_value) * _bits_per_element;
+      _large_pin_counts[start + block] =
+        (_pin_count_in_part[value_start + block / _entries_per_value] >> bit_pos) & _extraction_mask;
+    }
+    const HyperedgeID large_pos = start / _k;
+    __atomic_store_n(&_large_index[he], large_pos, __ATOMIC_RELEASE);
+    return large_pos;
+  }
+
   inline void updateEntry(Value& value,
                           const size_t bit_pos,
                           const Value new_value) {
-    ASSERT(new_value <= _max_value);
+    ASSERT(new_value <= _small_max_value);
     const Value zero_mask = ~(_extraction_mask << bit_pos);
     const Value value_mask = new_value << bit_pos;
     value = (value & zero_mask) | value_mask;
   }
 
   PinCountSnapshot initPinCountSnapshot() const {
+    return PinCountSnapshot(_k, _small_max_value);
+  }
+
+  PinCountSnapshot initLargePinCountSnapshot() const {
     return PinCountSnapshot(_k, _max_value);
   }
 
+  // ! Maximum value of the packed entries. We only use two tiers if this
+  // ! reduces the memory of the packed entries, since otherwise the second
+  // ! tier only adds the overhead of promotions.
+  static HypernodeID small_tier_max_value(const PartitionID k,
+                                          const HypernodeID max_value) {
+    const HypernodeID small_max_value = std::min(max_value,
+      static_cast<HypernodeID>((UL(1) << SMALL_TIER_MAX_BITS) - 1));
+    return num_values_per_hyperedge(k, small_max_value) <
+      num_values_per_hyperedge(k, max_value) ? small_max_value : max_value;
+  }
+
   static size_t num_values_per_hyperedge(const PartitionID k,
                                          const HypernodeID max_value) {
     const size_t entries_per_value = num_entries_per_value(k, max_value);
@@ -252,12 +383,18 @@ class PinCountInPart {
   HyperedgeID _num_hyperedges;
   PartitionID _k;
   HypernodeID _max_value;
+  HypernodeID _small_max_value;
   size_t _bits_per_element;
   size_t _entries_per_value;
   size_t _values_per_hyperedge;
   Value _extraction_mask;
   Array<Value> _pin_count_in_part;
+  // ! Position of a promoted hyperedge in the large tier (or kInvalidHyperedge)
+  Array<HyperedgeID> _large_index;
+  // ! Full-width pin counts of promoted hyperedges (k entries per hyperedge)
+  tbb::concurrent_vector<HypernodeID> _large_pin_counts;
   tbb::enumerable_thread_specific<PinCountSnapshot> _ets_pin_counts;
+  tbb::enumerable_thread_specific<PinCountSnapshot> _ets_large_pin_counts;
 
 };
 }  // namespace ds
@@ -422,6 +422,8 @@ namespace mt_kahypar::ds {
     hypergraph._num_removed_nodes = _num_removed_nodes;
     hypergraph._num_edges = _num_edges;
     hypergraph._total_weight = _total_weight;
+    hypergraph._has_unit_node_weights.store(_has_unit_node_weights.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    hypergraph._has_unit_edge_weights.store(_has_unit_edge_weights.load(std::memory_order_relaxed), std::memory_order_relaxed);
 
     tbb::parallel_invoke([&] {
       hypergraph._nodes.resize(_nodes.size());
@@ -449,6 +451,8 @@ namespace mt_kahypar::ds {
     hypergraph._num_removed_nodes = _num_removed_nodes;
     hypergraph._num_edges = _num_edges;
     hypergraph._total_weight = _total_weight;
+    hypergraph._has_unit_node_weights.store(_has_unit_node_weights.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    hypergraph._has_unit_edge_weights.store(_has_unit_edge_weights.load(std::memory_order_relaxed), std::memory_order_relaxed);
 
     hypergraph._nodes.resize(_nodes.size());
     memcpy(hypergraph._nodes.data(), _nodes.data(),
@@ -462,6 +462,8 @@ class StaticGraph {
     _num_removed_nodes(0),
     _num_edges(0),
     _total_weight(0),
+    _has_unit_node_weights(false),
+    _has_unit_edge_weights(false),
     _nodes(),
     _edges(),
     _unique_edge_ids(),
@@ -476,6 +478,8 @@ class StaticGraph {
     _num_removed_nodes(other._num_removed_nodes),
     _num_edges(other._num_edges),
     _total_weight(other._total_weight),
+    _has_unit_node_weights(other._has_unit_node_weights.load(std::memory_order_relaxed)),
+    _has_unit_edge_weights(other._has_unit_edge_weights.load(std::memory_order_relaxed)),
     _nodes(std::move(other._nodes)),
     _edges(std::move(other._edges)),
     _unique_edge_ids(std::move(other._unique_edge_ids)),
@@ -489,6 +493,8 @@ class StaticGraph {
     _num_removed_nodes = other._num_removed_nodes;
     _num_edges = other._num_edges;
     _total_weight = other._total_weight;
+    _has_unit_node_weights.store(other._has_unit_node_weights.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    _has_unit_edge_weights.store(other._has_unit_edge_weights.load(std::memory_order_relaxed), std::memory_order_relaxed);
     _nodes = std::move(other._nodes);
     _edges = std::move(other._edges);
     _unique_edge_ids = std::move(other._unique_edge_ids);
@@ -535,12 +541,12 @@ class StaticGraph {
   }
 
   // ! Initial number of pins
-  HypernodeID initialNumPins() const {
+  size_t initialNumPins() const {
     return _num_edges;
   }
 
   // ! Initial sum of the degree of all vertices
-  HypernodeID initialTotalVertexDegree() const {
+  size_t initialTotalVertexDegree() const {
     return _num_edges;
   }
 
@@ -552,6 +558,17 @@ class StaticGraph {
   // ! Computes the total node weight of the hypergraph
   void computeAndSetTotalNodeWeight(parallel_tag_t);
 
+  // ! Returns true, if all nodes have weight one. This only holds for
+  // ! unweighted input graphs, contracted graphs are always weighted.
+  bool hasUnitNodeWeights() const {
+    return _has_unit_node_weights.load(std::memory_order_relaxed);
+  }
+
+  // ! Returns true, if all edges have weight one.
+  bool hasUnitEdgeWeights() const {
+    return _has_unit_edge_weights.load(std::memory_order_relaxed);
+  }
+
   // ####################### Iterators #######################
 
   // ! Iterates in parallel over all active nodes and calls function f
@@ -612,6 +629,9 @@ class StaticGraph {
 
   // ! Sets the weight of a vertex
   void setNodeWeight(const HypernodeID u, const HypernodeWeight weight) {
+    if ( weight != 1 ) {
+      _has_unit_node_weights.store(false, std::memory_order_relaxed);
+    }
     return node(u).setWeight(weight);
   }
 
@@ -674,6 +694,9 @@ class StaticGraph {
 
   // ! Sets the weight of a hyperedge
   void setEdgeWeight(const HyperedgeID e, const HyperedgeWeight weight) {
+    if ( weight != 1 ) {
+      _has_unit_edge_weights.store(false, std::memory_order_relaxed);
+    }
     return edge(e).setWeight(weight);
   }
 
@@ -884,6 +907,11 @@ class StaticGraph {
   HyperedgeID _num_edges;
   // ! Total weight of the graph
   HypernodeWeight _total_weight;
+  // ! Weights can be set in parallel, therefore the unit weight flags are atomic.
+  // ! True, if all nodes have unit weight (only set for input graphs)
+  std::atomic<bool> _has_unit_node_weights;
+  // ! True, if all edges have unit weight (only set for input graphs)
+  std::atomic<bool> _has_unit_edge_weights;
 
   // ! Nodes
   Array<Node> _nodes;
@@ -28,6 +28,8 @@
 
 #include "static_graph_factory.h"
 
+#include <atomic>
+
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_invoke.h>
 
@@ -93,6 +95,31 @@ namespace mt_kahypar::ds {
           const HyperedgeWeight* edge_weight,
           const HypernodeWeight* node_weight,
           const bool stable_construction_of_incident_edges) {
+    return construct_from_graph_edges_impl(num_nodes, num_edges, edge_vector,
+      edge_weight, node_weight, stable_construction_of_incident_edges);
+  }
+
+  template<typename PinID>
+  StaticGraph StaticGraphFactory::construct_from_graph_edges(
+          const HypernodeID num_nodes,
+          const HyperedgeID num_edges,
+          const PinID* edges,
+          const HyperedgeWeight* edge_weight,
+          const HypernodeWeight* node_weight,
+          const bool stable_construction_of_incident_edges) {
+    return construct_from_graph_edges_impl(num_nodes, num_edges,
+      GraphEdgeVectorView<PinID>(num_edges, edges),
+      edge_weight, node_weight, stable_construction_of_incident_edges);
+  }
+
+  template<typename Edges>
+  StaticGraph StaticGraphFactory::construct_from_graph_edges_impl(
+          const HypernodeID num_nodes,
+          const HyperedgeID num_edges,
+          const Edges& edge_vector,
+          const HyperedgeWeight* edge_weight,
+          const HypernodeWeight* node_weight,
+          const bool stable_construction_of_incident_edges) {
     StaticGraph graph;
     graph._num_nodes = num_nodes;
     graph._num_edges = 2 * num_edges;
@@ -132,6 +159,9 @@ namespace mt_kahypar::ds {
     AtomicCounter incident_edges_position(num_nodes,
                                          parallel::IntegralAtomicWrapper<size_t>(0));
 
+    // Unweighted inputs allow several data structures to skip reading weights
+    std::atomic<bool> unit_node_weights(true);
+    std::atomic<bool> unit_edge_weights(true);
     auto setup_edges = [&] {
       tbb::parallel_for(ID(0), num_edges, [&](const size_t pos) {
         const HypernodeID pin0 = edge_vector[pos].first;
@@ -154,6 +184,9 @@ namespace mt_kahypar::ds {
         if (edge_weight) {
           edge0.setWeight(edge_weight[pos]);
           edge1.setWeight(edge_weight[pos]);
+          if ( edge_weight[pos] != 1 ) {
+            unit_edge_weights.store(false, std::memory_order_relaxed);
+          }
         }
       });
     };
@@ -165,6 +198,9 @@ namespace mt_kahypar::ds {
         node.setFirstEntry(degree_prefix_sum[pos]);
         if ( node_weight ) {
           node.setWeight(node_weight[pos]);
+          if ( node_weight[pos] != 1 ) {
+            unit_node_weights.store(false, std::memory_order_relaxed);
+          }
         }
       });
     };
@@ -180,7 +216,16 @@ namespace mt_kahypar::ds {
     if (stable_construction_of_incident_edges) {
       sort_incident_edges(graph);
     }
+    graph._has_unit_node_weights.store(unit_node_weights.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    graph._has_unit_edge_weights.store(unit_edge_weights.load(std::memory_order_relaxed), std::memory_order_relaxed);
     graph.computeAndSetTotalNodeWeight(parallel_tag_t());
     return graph;
   }
+
+  #define STATIC_GRAPH_EDGE_ARRAY_CONSTRUCT(PIN_TYPE)                                    \
+    template StaticGraph StaticGraphFactory::construct_from_graph_edges<PIN_TYPE>(      \
+      const HypernodeID, const HyperedgeID, const PIN_TYPE*,                            \
+      const HyperedgeWeight*, const HypernodeWeight*, const bool);
+
+  MT_KAHYPAR_INSTANTIATE_FOR_PIN_TYPES(STATIC_GRAPH_EDGE_ARRAY_CONSTRUCT)
 }
\ No newline at end of file
@@ -31,6 +31,7 @@
 #include "tbb/enumerable_thread_specific.h"
 
 #include "mt-kahypar/datastructures/static_graph.h"
+#include "mt-kahypar/datastructures/edge_vector_views.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
 
 
@@ -62,6 +63,17 @@ class StaticGraphFactory {
                                                 const HypernodeWeight* node_weight = nullptr,
                                                 const bool stable_construction_of_incident_edges = false);
 
+  // ! Constructs the graph directly from a flat edge array without building an
+  // ! intermediate edge vector. Edge e connects edges[2 * e] and edges[2 * e + 1].
+  // ! No backwards edges allowed, i.e. each edge is unique
+  template<typename PinID>
+  static StaticGraph construct_from_graph_edges(const HypernodeID num_nodes,
+                                                const HyperedgeID num_edges,
+                                                const PinID* edges,
+                                                const HyperedgeWeight* edge_weight = nullptr,
+                                                const HypernodeWeight* node_weight = nullptr,
+                                                const bool stable_construction_of_incident_edges = false);
+
   static std::pair<StaticGraph, parallel::scalable_vector<HypernodeID> > compactify(const StaticGraph&) {
     ERR("Compactify not implemented for static graph.");
   }
@@ -69,6 +81,14 @@ class StaticGraphFactory {
  private:
   StaticGraphFactory() { }
 
+  template<typename Edges>
+  static StaticGraph construct_from_graph_edges_impl(const HypernodeID num_nodes,
+                                                     const HyperedgeID num_edges,
+                                                     const Edges& edge_vector,
+                                                     const HyperedgeWeight* edge_weight,
+                                                     const HypernodeWeight* node_weight,
+                                                     const bool stable_construction_of_incident_edges);
+
   static void sort_incident_edges(StaticGraph& graph);
 };
 
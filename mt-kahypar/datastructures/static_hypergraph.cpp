@@ -496,6 +496,8 @@ namespace mt_kahypar::ds {
     hypergraph._num_pins = _num_pins;
     hypergraph._total_degree = _total_degree;
     hypergraph._total_weight = _total_weight;
+    hypergraph._has_unit_node_weights.store(_has_unit_node_weights.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    hypergraph._has_unit_edge_weights.store(_has_unit_edge_weights.load(std::memory_order_relaxed), std::memory_order_relaxed);
 
     tbb::parallel_invoke([&] {
       hypergraph._hypernodes.resize(_hypernodes.size());
@@ -531,6 +533,8 @@ namespace mt_kahypar::ds {
     hypergraph._num_pins = _num_pins;
     hypergraph._total_degree = _total_degree;
     hypergraph._total_weight = _total_weight;
+    hypergraph._has_unit_node_weights.store(_has_unit_node_weights.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    hypergraph._has_unit_edge_weights.store(_has_unit_edge_weights.load(std::memory_order_relaxed), std::memory_order_relaxed);
 
     hypergraph._hypernodes.resize(_hypernodes.size());
     memcpy(hypergraph._hypernodes.data(), _hypernodes.data(),
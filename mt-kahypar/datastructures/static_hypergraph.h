@@ -347,7 +347,7 @@ class StaticHypergraph {
   struct TmpContractionBuffer {
     explicit TmpContractionBuffer(const HypernodeID num_hypernodes,
                                   const HyperedgeID num_hyperedges,
-                                  const HyperedgeID num_pins) {
+                                  const size_t num_pins) {
       tbb::parallel_invoke([&] {
         mapping.resize("Coarsening", "mapping", num_hypernodes);
       }, [&] {
@@ -414,6 +414,8 @@ class StaticHypergraph {
     _num_pins(0),
     _total_degree(0),
     _total_weight(0),
+    _has_unit_node_weights(false),
+    _has_unit_edge_weights(false),
     _hypernodes(),
     _incident_nets(),
     _hyperedges(),
@@ -434,6 +436,8 @@ class StaticHypergraph {
     _num_pins(other._num_pins),
     _total_degree(other._total_degree),
     _total_weight(other._total_weight),
+    _has_unit_node_weights(other._has_unit_node_weights.load(std::memory_order_relaxed)),
+    _has_unit_edge_weights(other._has_unit_edge_weights.load(std::memory_order_relaxed)),
     _hypernodes(std::move(other._hypernodes)),
     _incident_nets(std::move(other._incident_nets)),
     _hyperedges(std::move(other._hyperedges)),
@@ -453,6 +457,8 @@ class StaticHypergraph {
     _num_pins = other._num_pins;
     _total_degree = other._total_degree;
     _total_weight = other._total_weight;
+    _has_unit_node_weights.store(other._has_unit_node_weights.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    _has_unit_edge_weights.store(other._has_unit_edge_weights.load(std::memory_order_relaxed), std::memory_order_relaxed);
     _hypernodes = std::move(other._hypernodes);
     _incident_nets = std::move(other._incident_nets);
     _hyperedges = std::move(other._hyperedges);
@@ -504,12 +510,12 @@ class StaticHypergraph {
   }
 
   // ! Initial number of pins
-  HypernodeID initialNumPins() const {
+  size_t initialNumPins() const {
     return _num_pins;
   }
 
   // ! Initial sum of the degree of all vertices
-  HypernodeID initialTotalVertexDegree() const {
+  size_t initialTotalVertexDegree() const {
     return _total_degree;
   }
 
@@ -521,6 +527,17 @@ class StaticHypergraph {
   // ! Computes the total node weight of the hypergraph
   void computeAndSetTotalNodeWeight(parallel_tag_t);
 
+  // ! Returns true, if all vertices have weight one. This only holds for
+  // ! unweighted input hypergraphs, contracted hypergraphs are always weighted.
+  bool hasUnitNodeWeights() const {
+    return _has_unit_node_weights.load(std::memory_order_relaxed);
+  }
+
+  // ! Returns true, if all hyperedges have weight one.
+  bool hasUnitEdgeWeights() const {
+    return _has_unit_edge_weights.load(std::memory_order_relaxed);
+  }
+
   // ####################### Iterators #######################
 
   // ! Iterates in parallel over all active nodes and calls function f
@@ -587,6 +604,9 @@ class StaticHypergraph {
   // ! Sets the weight of a vertex
   void setNodeWeight(const HypernodeID u, const HypernodeWeight weight) {
     ASSERT(!hypernode(u).isDisabled(), "Hypernode" << u << "is disabled");
+    if ( weight != 1 ) {
+      _has_unit_node_weights.store(false, std::memory_order_relaxed);
+    }
     return hypernode(u).setWeight(weight);
   }
 
@@ -642,6 +662,9 @@ class StaticHypergraph {
   // ! Sets the weight of a hyperedge
   void setEdgeWeight(const HyperedgeID e, const HyperedgeWeight weight) {
     ASSERT(!hyperedge(e).isDisabled(), "Hyperedge" << e << "is disabled");
+    if ( weight != 1 ) {
+      _has_unit_edge_weights.store(false, std::memory_order_relaxed);
+    }
     return hyperedge(e).setWeight(weight);
   }
 
@@ -933,11 +956,16 @@ class StaticHypergraph {
   // ! Maximum size of a hyperedge
   HypernodeID _max_edge_size;
   // ! Number of pins
-  HypernodeID _num_pins;
+  size_t _num_pins;
   // ! Total degree of all vertices
-  HypernodeID _total_degree;
+  size_t _total_degree;
   // ! Total weight of hypergraph
   HypernodeWeight _total_weight;
+  // ! Weights can be set in parallel, therefore the unit weight flags are atomic.
+  // ! True, if all vertices have unit weight (only set for input hypergraphs)
+  std::atomic<bool> _has_unit_node_weights;
+  // ! True, if all hyperedges have unit weight (only set for input hypergraphs)
+  std::atomic<bool> _has_unit_edge_weights;
 
   // ! Hypernodes
   Array<Hypernode> _hypernodes;
@@ -27,6 +27,8 @@
 
 #include "static_hypergraph_factory.h"
 
+#include <atomic>
+
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_invoke.h>
 
@@ -42,6 +44,32 @@ namespace mt_kahypar::ds {
           const HyperedgeWeight* hyperedge_weight,
           const HypernodeWeight* hypernode_weight,
           const bool stable_construction_of_incident_edges) {
+    return construct_impl(num_hypernodes, num_hyperedges, edge_vector,
+      hyperedge_weight, hypernode_weight, stable_construction_of_incident_edges);
+  }
+
+  template<typename PinID>
+  StaticHypergraph StaticHypergraphFactory::construct(
+          const HypernodeID num_hypernodes,
+          const HyperedgeID num_hyperedges,
+          const size_t* hyperedge_indices,
+          const PinID* hyperedges,
+          const HyperedgeWeight* hyperedge_weight,
+          const HypernodeWeight* hypernode_weight,
+          const bool stable_construction_of_incident_edges) {
+    return construct_impl(num_hypernodes, num_hyperedges,
+      HyperedgeVectorView<PinID>(num_hyperedges, hyperedge_indices, hyperedges),
+      hyperedge_weight, hypernode_weight, stable_construction_of_incident_edges);
+  }
+
+  template<typename EdgeVector>
+  StaticHypergraph StaticHypergraphFactory::construct_impl(
+          const HypernodeID num_hypernodes,
+          const HyperedgeID num_hyperedges,
+          const EdgeVector& edge_vector,
+          const HyperedgeWeight* hyperedge_weight,
+          const HypernodeWeight* hypernode_weight,
+          const bool stable_construction_of_incident_edges) {
     StaticHypergraph hypergraph;
     hypergraph._num_hypernodes = num_hypernodes;
     hypergraph._num_hyperedges = num_hyperedges;
@@ -60,7 +88,7 @@ namespace mt_kahypar::ds {
       num_pins_per_hyperedge[pos] = edge_vector[pos].size();
       local_max_edge_size.local() = std::max(
               local_max_edge_size.local(), edge_vector[pos].size());
-      for ( const HypernodeID& pin : edge_vector[pos] ) {
+      for ( const HypernodeID pin : edge_vector[pos] ) {
         ASSERT(pin < num_hypernodes, V(pin) << V(num_hypernodes));
         ++num_incident_nets_per_vertex[pin];
       }
@@ -102,6 +130,9 @@ namespace mt_kahypar::ds {
 
     AtomicCounter incident_nets_position(num_hypernodes,
                                          parallel::IntegralAtomicWrapper<size_t>(0));
+    // Unweighted inputs allow several data structures to skip reading weights
+    std::atomic<bool> unit_node_weights(true);
+    std::atomic<bool> unit_edge_weights(true);
 
     auto setup_hyperedges = [&] {
       tbb::parallel_for(ID(0), num_hyperedges, [&](const size_t pos) {
@@ -111,11 +142,14 @@ namespace mt_kahypar::ds {
         hyperedge.setSize(pin_prefix_sum.value(pos));
         if ( hyperedge_weight ) {
           hyperedge.setWeight(hyperedge_weight[pos]);
+          if ( hyperedge_weight[pos] != 1 ) {
+            unit_edge_weights.store(false, std::memory_order_relaxed);
+          }
         }
 
         const HyperedgeID he = pos;
         size_t incidence_array_pos = hyperedge.firstEntry();
-        for ( const HypernodeID& pin : edge_vector[pos] ) {
+        for ( const HypernodeID pin : edge_vector[pos] ) {
           ASSERT(incidence_array_pos < hyperedge.firstInvalidEntry());
           ASSERT(pin < num_hypernodes);
           // Add pin to incidence array
@@ -136,6 +170,9 @@ namespace mt_kahypar::ds {
         hypernode.setSize(incident_net_prefix_sum.value(pos));
         if ( hypernode_weight ) {
           hypernode.setWeight(hypernode_weight[pos]);
+          if ( hypernode_weight[pos] != 1 ) {
+            unit_node_weights.store(false, std::memory_order_relaxed);
+          }
         }
       });
     };
@@ -159,8 +196,17 @@ namespace mt_kahypar::ds {
     hypergraph._hypernodes.back() = StaticHypergraph::Hypernode(hypergraph._incident_nets.size());
     hypergraph._hyperedges.back() = StaticHypergraph::Hyperedge(hypergraph._incidence_array.size());
 
+    hypergraph._has_unit_node_weights.store(unit_node_weights.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    hypergraph._has_unit_edge_weights.store(unit_edge_weights.load(std::memory_order_relaxed), std::memory_order_relaxed);
     hypergraph.computeAndSetTotalNodeWeight(parallel_tag_t());
     return hypergraph;
   }
 
+  #define STATIC_HYPERGRAPH_CSR_CONSTRUCT(PIN_TYPE)                             \
+    template StaticHypergraph StaticHypergraphFactory::construct<PIN_TYPE>(    \
+      const HypernodeID, const HyperedgeID, const size_t*, const PIN_TYPE*,    \
+      const HyperedgeWeight*, const HypernodeWeight*, const bool);
+
+  MT_KAHYPAR_INSTANTIATE_FOR_PIN_TYPES(STATIC_HYPERGRAPH_CSR_CONSTRUCT)
+
 }
\ No newline at end of file
@@ -30,6 +30,7 @@
 #include "tbb/enumerable_thread_specific.h"
 
 #include "mt-kahypar/datastructures/static_hypergraph.h"
+#include "mt-kahypar/datastructures/edge_vector_views.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
 
 
@@ -50,12 +51,32 @@ class StaticHypergraphFactory {
                                     const HypernodeWeight* hypernode_weight = nullptr,
                                     const bool stable_construction_of_incident_edges = false);
 
+  // ! Constructs the hypergraph directly from an adjacency array (CSR format) without
+  // ! building an intermediate edge vector. The pins of hyperedge e are stored in
+  // ! hyperedges[hyperedge_indices[e]], ..., hyperedges[hyperedge_indices[e + 1] - 1].
+  template<typename PinID>
+  static StaticHypergraph construct(const HypernodeID num_hypernodes,
+                                    const HyperedgeID num_hyperedges,
+                                    const size_t* hyperedge_indices,
+                                    const PinID* hyperedges,
+                                    const HyperedgeWeight* hyperedge_weight = nullptr,
+                                    const HypernodeWeight* hypernode_weight = nullptr,
+                                    const bool stable_construction_of_incident_edges = false);
+
   static std::pair<StaticHypergraph, vec<HypernodeID>> compactify(const StaticHypergraph&) {
     ERR("Compactify not implemented for static hypergraph.");
   }
 
  private:
   StaticHypergraphFactory() { }
+
+  template<typename EdgeVector>
+  static StaticHypergraph construct_impl(const HypernodeID num_hypernodes,
+                                         const HyperedgeID num_hyperedges,
+                                         const EdgeVector& edge_vector,
+                                         const HyperedgeWeight* hyperedge_weight,
+                                         const HypernodeWeight* hypernode_weight,
+                                         const bool stable_construction_of_incident_edges);
 };
 
 } // namespace mt_kahypar
\ No newline at end of file
@@ -124,6 +124,23 @@ namespace mt_kahypar {
             ("num-vcycles",
              po::value<size_t>(&context.partition.num_vcycles)->value_name("<size_t>")->default_value(0),
              "Number of V-Cycles")
+            ("e-population-size",
+             po::value<size_t>(&context.evolutionary.population_size)->value_name("<size_t>")->default_value(0),
+             "If greater than one, an evolutionary algorithm maintains a population of partitions of this size\n"
+             "and computes new offspring concurrently via combine operations (V-cycle restricted to the common\n"
+             "blocks of two parents) and mutations (V-cycle on one parent) until the time limit or the number of\n"
+             "generations is reached (only supported in mode direct).")
+            ("e-num-generations",
+             po::value<size_t>(&context.evolutionary.num_generations)->value_name("<size_t>"),
+             "Maximum number of generations computed by the evolutionary algorithm (see e-population-size).\n"
+             "Each generation computes min(population size, number of threads) offspring.")
+            ("e-mutation-chance",
+             po::value<double>(&context.evolutionary.mutation_chance)->value_name("<double>")->default_value(0.5),
+             "Probability that an offspring is computed via a mutation instead of a combine operation.")
+            ("e-dynamic-population-amount-of-time",
+             po::value<double>(&context.evolutionary.dynamic_population_amount_of_time)->value_name("<double>")->default_value(0.15),
+             "Fraction of the time limit after which no further individuals of the initial population are started.\n"
+             "Only the individuals computed until then form the population (see time-limit).")
             ("perform-parallel-recursion-in-deep-multilevel",
              po::value<bool>(&context.partition.perform_parallel_recursion_in_deep_multilevel)->value_name("<bool>")->default_value(true),
              "If true, then we perform parallel recursion within the deep multilevel scheme.")
@@ -162,7 +179,15 @@ namespace mt_kahypar {
              po::value<bool>(&context.partition.enable_progress_bar)->value_name("<bool>")->default_value(false),
              "If true, shows a progress bar during coarsening and refinement phase.")
             ("time-limit", po::value<int>(&context.partition.time_limit)->value_name("<int>"),
-             "Time limit in seconds (currently not supported)")
+             "Time limit in seconds (only used by the evolutionary algorithm, see e-population-size)")
+            ("memory-budget",
+             po::value<size_t>(&context.partition.memory_budget)->value_name("<size_t>")->default_value(0),
+             "Memory budget in megabytes (0 = unlimited). Before partitioning, the peak memory consumption is\n"
+             "estimated and lower-memory alternatives are selected until the estimate fits into the budget:\n"
+             " - low-memory contraction in community detection\n"
+             " - FM applies moves directly to the global partition (no thread-local delta partitions)\n"
+             " - sparse pin count data structure (multilevel hypergraph partitioning)\n"
+             " - disabling FM refinement (no gain cache)")
             ("sp-process,s",
              po::value<bool>(&context.partition.sp_process_output)->value_name("<bool>")->default_value(false),
              "Summarize partitioning results in RESULT line compatible with sqlplottools "
@@ -274,8 +299,23 @@ namespace mt_kahypar {
              "Rating function used to calculate scores for vertex pairs:\n"
              #ifdef KAHYPAR_ENABLE_EXPERIMENTAL_FEATURES
              "- sameness\n"
+             "- algebraic_distance (multilevel only)\n"
              #endif
              "- heavy_edge")
+            #ifdef KAHYPAR_ENABLE_EXPERIMENTAL_FEATURES
+            ("c-rating-algebraic-distance-vectors",
+             po::value<size_t>(&context.coarsening.rating.algebraic_distance_num_vectors)->value_name(
+                     "<size_t>")->default_value(5),
+             "Number of random test vectors used to compute algebraic distances (c-rating-score=algebraic_distance)")
+            ("c-rating-algebraic-distance-iterations",
+             po::value<size_t>(&context.coarsening.rating.algebraic_distance_num_iterations)->value_name(
+                     "<size_t>")->default_value(20),
+             "Number of Jacobi over-relaxation sweeps per test vector (c-rating-score=algebraic_distance)")
+            ("c-rating-algebraic-distance-omega",
+             po::value<double>(&context.coarsening.rating.algebraic_distance_omega)->value_name(
+                     "<double>")->default_value(0.5),
+             "Relaxation parameter of the Jacobi over-relaxation sweeps (c-rating-score=algebraic_distance)")
+            #endif
             ("c-rating-heavy-node-penalty",
              po::value<std::string>()->value_name("<string>")->notifier(
                      [&](const std::string& penalty) {
@@ -306,7 +346,15 @@ namespace mt_kahypar {
             ("c-num-sub-rounds",
              po::value<size_t>(&context.coarsening.num_sub_rounds_deterministic)->value_name(
                      "<size_t>")->default_value(16),
-             "Number of sub-rounds used for deterministic coarsening.");
+             "Number of sub-rounds used for deterministic coarsening.")
+            ("c-nlevel-round-size",
+             po::value<size_t>(&context.coarsening.nlevel_round_size)->value_name(
+                     "<size_t>")->default_value(0),
+             "If greater than zero, the n-level coarsener processes the vertices in rounds of this size:\n"
+             "all vertices of a round are rated in parallel, then the contractions are registered in the\n"
+             "contraction forest and afterwards performed in parallel. This separates rating from\n"
+             "contraction and avoids lock contention on the hypergraph. If zero, each vertex is rated\n"
+             "and contracted immediately (n-Level Partitioner).");
     return options;
   }
 
@@ -333,6 +381,40 @@ namespace mt_kahypar {
              po::value<size_t>((!initial_partitioning ? &context.refinement.min_border_vertices_per_thread :
                                 &context.initial_partitioning.refinement.min_border_vertices_per_thread))->value_name("<size_t>")->default_value(0),
              "Minimum number of border vertices per thread with which we perform a localized search (n-Level Partitioner).")
+            ((initial_partitioning ? "i-r-adaptive-batch-size" : "r-adaptive-batch-size"),
+             po::value<bool>((!initial_partitioning ? &context.refinement.adaptive_batch_size.enabled :
+                              &context.initial_partitioning.refinement.adaptive_batch_size.enabled))->value_name(
+                     "<bool>")->default_value(false),
+             "If true, the minimum number of border vertices with which we perform a localized search is adapted\n"
+             "to the improvement per second of previous localized searches (n-Level Partitioner).")
+            ((initial_partitioning ? "i-r-adaptive-batch-size-scaling-factor" : "r-adaptive-batch-size-scaling-factor"),
+             po::value<double>((!initial_partitioning ? &context.refinement.adaptive_batch_size.scaling_factor :
+                                &context.initial_partitioning.refinement.adaptive_batch_size.scaling_factor))->value_name(
+                     "<double>")->default_value(2.0),
+             "Factor by which the minimum number of border vertices is increased or decreased after each\n"
+             "localized search (requires r-adaptive-batch-size).")
+            ((initial_partitioning ? "i-r-adaptive-batch-size-max-multiplier" : "r-adaptive-batch-size-max-multiplier"),
+             po::value<size_t>((!initial_partitioning ? &context.refinement.adaptive_batch_size.max_multiplier :
+                                &context.initial_partitioning.refinement.adaptive_batch_size.max_multiplier))->value_name(
+                     "<size_t>")->default_value(16),
+             "The minimum number of border vertices stays within this factor of its initial value\n"
+             "(requires r-adaptive-batch-size).")
+            ((initial_partitioning ? "i-r-adaptive-refinement" : "r-adaptive-refinement"),
+             po::value<bool>((!initial_partitioning ? &context.refinement.adaptive.enabled :
+                              &context.initial_partitioning.refinement.adaptive.enabled))->value_name(
+                     "<bool>")->default_value(false),
+             "If true, refinement algorithms with a low improvement per second on previous levels are skipped.")
+            ((initial_partitioning ? "i-r-adaptive-min-relative-efficiency" : "r-adaptive-min-relative-efficiency"),
+             po::value<double>((!initial_partitioning ? &context.refinement.adaptive.min_relative_efficiency :
+                                &context.initial_partitioning.refinement.adaptive.min_relative_efficiency))->value_name(
+                     "<double>")->default_value(0.1),
+             "A refinement algorithm is skipped on the next level, if its improvement per second is smaller than\n"
+             "this factor times the improvement per second of all refinement algorithms (requires r-adaptive-refinement).")
+            ((initial_partitioning ? "i-r-adaptive-probe-interval" : "r-adaptive-probe-interval"),
+             po::value<size_t>((!initial_partitioning ? &context.refinement.adaptive.probe_interval :
+                                &context.initial_partitioning.refinement.adaptive.probe_interval))->value_name(
+                     "<size_t>")->default_value(4),
+             "A skipped refinement algorithm is executed again after this number of levels to re-evaluate its efficiency.")
             ((initial_partitioning ? "i-r-lp-type" : "r-lp-type"),
              po::value<std::string>()->value_name("<string>")->notifier(
                      [&, initial_partitioning](const std::string& type) {
@@ -400,6 +482,11 @@ namespace mt_kahypar {
              po::value<size_t>((initial_partitioning ? &context.initial_partitioning.refinement.fm.num_seed_nodes :
                                 &context.refinement.fm.num_seed_nodes))->value_name("<size_t>")->default_value(25),
              "Number of nodes to start the 'highly localized FM' with.")
+            ((initial_partitioning ? "i-r-fm-locality-aware-seeds" : "r-fm-locality-aware-seeds"),
+             po::value<bool>((initial_partitioning ? &context.initial_partitioning.refinement.fm.locality_aware_seeds :
+                              &context.refinement.fm.locality_aware_seeds))->value_name("<bool>")->default_value(false),
+             "If true, the seed nodes of each thread are grouped by their block such that the seeds of a\n"
+             "localized FM search and the seeds stolen by other threads are clustered.")
             (( initial_partitioning ? "i-r-fm-rollback-parallel" : "r-fm-rollback-parallel"),
              po::value<bool>((initial_partitioning ? &context.initial_partitioning.refinement.fm.rollback_parallel :
                               &context.refinement.fm.rollback_parallel))
@@ -521,6 +608,11 @@ namespace mt_kahypar {
              po::value<bool>((initial_partitioning ? &context.initial_partitioning.refinement.flows.pierce_in_bulk :
                               &context.refinement.flows.pierce_in_bulk))->value_name("<bool>"),
              "If true, then FlowCutter is accelerated by piercing multiple nodes at a time")
+            ((initial_partitioning ? "i-r-flow-use-graph-flow-cutter" : "r-flow-use-graph-flow-cutter"),
+             po::value<bool>((initial_partitioning ? &context.initial_partitioning.refinement.flows.use_graph_flow_cutter :
+                              &context.refinement.flows.use_graph_flow_cutter))->value_name("<bool>"),
+             "If true, then sequential flow-based refinement on graphs (cut metric) solves the flow problems\n"
+             "on a graph flow network instead of a flow hypergraph")
             ((initial_partitioning ? "i-r-flow-scaling" : "r-flow-scaling"),
              po::value<double>((initial_partitioning ? &context.initial_partitioning.refinement.flows.alpha :
                       &context.refinement.flows.alpha))->value_name("<double>"),
@@ -595,6 +687,11 @@ namespace mt_kahypar {
              po::value<size_t>(&context.initial_partitioning.min_adaptive_ip_runs)->value_name("<size_t>")->default_value(5),
              "If adaptive IP runs is enabled, than each initial partitioner performs minimum min_adaptive_ip_runs runs before\n"
              "it decides if it should terminate.")
+            ("i-use-portfolio-racing",
+             po::value<bool>(&context.initial_partitioning.use_portfolio_racing)->value_name("<bool>")->default_value(false),
+             "If true, the runs of the initial partitioners are not fixed in advance. Each run is assigned to the most\n"
+             "promising non-dominated initial partitioner when it starts, and runs of initial partitioners that become\n"
+             "dominated by concurrently finished runs are cancelled. Disabled in deterministic mode.")
             ("i-population-size",
              po::value<size_t>(&context.initial_partitioning.population_size)->value_name("<size_t>")->default_value(16),
              "Size of population of flat bipartitions to perform secondary FM refinement on in deterministic mode."
@@ -628,6 +725,24 @@ namespace mt_kahypar {
             ("target-graph-file,g",
              po::value<std::string>(&context.mapping.target_graph_file)->value_name("<string>"),
              "Path to a target architecture graph in Metis file format.")
+            ("target-hierarchy",
+             po::value<std::string>(&context.mapping.target_hierarchy)->value_name("<string>"),
+             "Describes the target architecture as a hierarchy instead of reading a target graph file.\n"
+             "The fan-out of each level is given from the innermost to the outermost level separated by colons\n"
+             "(e.g., 4:8:6 means 6 racks with 8 nodes each containing 4 cores). Distances and steiner trees\n"
+             "are computed in closed form (no precomputation).")
+            ("target-hierarchy-costs",
+             po::value<std::string>(&context.mapping.target_hierarchy_costs)->value_name("<string>"),
+             "Communication cost of each level of the target hierarchy separated by colons (e.g., 1:10:100).\n"
+             "Costs must be non-decreasing from the innermost to the outermost level.")
+            ("target-torus",
+             po::value<std::string>(&context.mapping.target_torus)->value_name("<string>"),
+             "Describes the target architecture as a torus instead of reading a target graph file.\n"
+             "The size of each dimension is separated by colons (e.g., 8:8:8).")
+            ("target-torus-costs",
+             po::value<std::string>(&context.mapping.target_torus_costs)->value_name("<string>"),
+             "Communication cost of a link in each dimension of the target torus separated by colons\n"
+             "(default: unit costs).")
             ("one-to-one-mapping-strategy",
              po::value<std::string>()->value_name("<string>")->notifier(
                      [&](const std::string& strategy) {
@@ -636,6 +751,7 @@ namespace mt_kahypar {
              "Strategy for solving the one-to-one mapping problem after initial partitioning.\n"
              "Available strategies:\n"
              " - greedy_mapping\n"
+             " - parallel_local_search (improves the mapping of the initial partition via parallel swaps)\n"
              " - identity")
             ("mapping-use-local-search",
              po::value<bool>(&context.mapping.use_local_search)->value_name("<bool>"),
@@ -647,6 +763,14 @@ namespace mt_kahypar {
             ("max-steiner-tree-size",
              po::value<size_t>(&context.mapping.max_steiner_tree_size)->value_name("<size_t>"),
              "We precompute all optimal steiner trees up to this size in the target graph.")
+            ("steiner-tree-cache-capacity",
+             po::value<size_t>(&context.mapping.steiner_tree_cache_capacity)->value_name("<size_t>"),
+             "Maximum number of cached steiner trees of connectivity sets larger than max-steiner-tree-size.\n"
+             "If the cache is full, least recently used entries are evicted (8 bytes per entry).")
+            ("track-steiner-tree-cache-stats",
+             po::value<bool>(&context.mapping.track_steiner_tree_cache_stats)->value_name("<bool>"),
+             "If true, counts hits, misses and evictions of the steiner tree cache and outputs them\n"
+             "together with the timings.")
             ("mapping-largest-he-fraction",
              po::value<double>(&context.mapping.largest_he_fraction)->value_name("<double>"),
              "If x% (x = process-mapping-largest-he-fraction) of the largest hyperedges covers more than y% of the pins\n"
@@ -683,7 +807,27 @@ namespace mt_kahypar {
             ("s-shuffle-block-size",
              po::value<size_t>(&context.shared_memory.shuffle_block_size)->value_name("<size_t>"),
              "If we perform a localized random shuffle in parallel, we perform a parallel for over blocks of size"
-             "'shuffle_block_size' and shuffle them sequential.");
+             "'shuffle_block_size' and shuffle them sequential.")
+            ("s-sequential-pin-threshold",
+             po::value<size_t>(&context.shared_memory.sequential_pin_threshold)->value_name("<size_t>"),
+             "Hypergraphs with at most this many pins are partitioned on a single thread,\n"
+             "since the overheads of the parallel algorithms outweigh their benefits on small inputs\n"
+             "(0 = disabled, default; ignored for the deterministic preset).")
+            ("s-huge-pages",
+             po::value<std::string>()->value_name("<string>")->notifier(
+                     [&](const std::string& mode) {
+                       context.shared_memory.huge_pages = hugePageModeFromString(mode);
+                     }),
+             "Places large arrays (e.g., pins, incident nets, gain cache and pin counts) on huge pages:\n"
+             "- disabled\n"
+             "- transparent (2 MB aligned + madvise)\n"
+             "- explicit_2mb (MAP_HUGETLB, requires reserved huge pages)\n"
+             "- explicit_1gb (MAP_HUGETLB, 1 GB pages for arrays of at least 1 GB, 2 MB pages otherwise)\n"
+             "Explicit huge pages fall back to transparent huge pages if no reserved pages are available.")
+            ("s-huge-page-cache-size",
+             po::value<size_t>(&context.shared_memory.huge_page_cache_size)->value_name("<size_t>"),
+             "Maximum size in megabytes of freed huge page allocations that are kept for reuse\n"
+             "in later coarsening levels and V-cycles (default: 2048).");
 
     return shared_memory_options;
   }
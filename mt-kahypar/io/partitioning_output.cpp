@@ -152,7 +152,7 @@ namespace mt_kahypar::io {
     const double stdev_hn_weight = utils::parallel_stdev(hn_weights, avg_hn_weight, num_hypernodes);
 
     HyperedgeID num_hyperedges = hypergraph.initialNumEdges();
-    HypernodeID num_pins = hypergraph.initialNumPins();
+    size_t num_pins = hypergraph.initialNumPins();
     const double avg_he_size = utils::avgHyperedgeDegree(hypergraph);
     hypergraph.doParallelForAllEdges([&](const HyperedgeID& he) {
       he_sizes[he] = hypergraph.edgeSize(he);
@@ -601,7 +601,7 @@ namespace mt_kahypar::io {
         LOG << hypergraph_memory_consumption;
       }
 
-      if ( hypergraph.hasTargetGraph() && TargetGraph::TRACK_STATS ) {
+      if ( hypergraph.hasTargetGraph() && hypergraph.targetGraph()->isTrackingStats() ) {
         hypergraph.targetGraph()->printStats();
       }
 
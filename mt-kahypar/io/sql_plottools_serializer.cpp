@@ -58,6 +58,9 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
         << " epsilon=" << context.partition.epsilon
         << " seed=" << context.partition.seed
         << " num_vcycles=" << context.partition.num_vcycles
+        << " evolutionary_population_size=" << context.evolutionary.population_size
+        << " evolutionary_num_generations=" << context.evolutionary.num_generations
+        << " evolutionary_mutation_chance=" << context.evolutionary.mutation_chance
         << " deterministic=" << context.partition.deterministic
         << " perform_parallel_recursion_in_deep_multilevel=" << context.partition.perform_parallel_recursion_in_deep_multilevel;
     oss << " large_hyperedge_size_threshold_factor=" << context.partition.large_hyperedge_size_threshold_factor
@@ -95,6 +98,7 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
         << " initial_partitioning_runs=" << context.initial_partitioning.runs
         << " initial_partitioning_use_adaptive_ip_runs=" << std::boolalpha << context.initial_partitioning.use_adaptive_ip_runs
         << " initial_partitioning_min_adaptive_ip_runs=" << context.initial_partitioning.min_adaptive_ip_runs
+        << " initial_partitioning_use_portfolio_racing=" << std::boolalpha << context.initial_partitioning.use_portfolio_racing
         << " initial_partitioning_perform_refinement_on_best_partitions=" << std::boolalpha << context.initial_partitioning.perform_refinement_on_best_partitions
         << " initial_partitioning_fm_refinment_rounds=" << std::boolalpha << context.initial_partitioning.fm_refinment_rounds
         << " initial_partitioning_remove_degree_zero_hns_before_ip=" << std::boolalpha << context.initial_partitioning.remove_degree_zero_hns_before_ip
@@ -159,7 +163,7 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
           << " mapping_largest_he_fraction=" << context.mapping.largest_he_fraction
           << " mapping_min_pin_coverage_of_largest_hes=" << context.mapping.min_pin_coverage_of_largest_hes
           << " mapping_large_he_threshold=" << context.mapping.large_he_threshold;
-      if ( TargetGraph::TRACK_STATS ) {
+      if ( hypergraph.hasTargetGraph() && hypergraph.targetGraph()->isTrackingStats() ) {
         hypergraph.targetGraph()->printStats(oss);
       }
     }
@@ -0,0 +1,319 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <map>
+#include <unordered_map>
+#include <cstring>
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include "tbb/scalable_allocator.h"
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/partition/context_enum_classes.h"
+
+namespace mt_kahypar {
+namespace parallel {
+
+/*!
+ * Singleton that places large allocations (e.g., pins, incident nets, gain cache
+ * and pin counts) on huge pages to reduce TLB misses. Allocations below a size
+ * threshold and allocations on systems without huge page support are served by
+ * the scalable allocator of TBB.
+ *
+ * Huge page allocations are not returned to the OS when they are freed. Instead,
+ * they are cached and reused by subsequent allocations (e.g., the buffers of the
+ * next coarsening level or V-cycle). The cache is bounded and the smallest cached
+ * allocation that fits a request is reused (best fit), unless it is more than twice
+ * as large as the request.
+ */
+class HugePageAllocator {
+
+  static constexpr bool debug = false;
+
+  static constexpr size_t MEGABYTE = UL(1) << 20;
+  static constexpr size_t HUGE_PAGE_SIZE = UL(1) << 21;       // 2 MB
+  static constexpr size_t GIGANTIC_PAGE_SIZE = UL(1) << 30;   // 1 GB
+  // ! Smaller allocations are served by the scalable allocator
+  static constexpr size_t MIN_ALLOCATION_SIZE = HUGE_PAGE_SIZE;
+  // ! Cached allocations larger than this factor times the request are not reused
+  static constexpr size_t MAX_REUSE_FACTOR = 2;
+  // ! Default maximum size of the cache in megabytes
+  static constexpr size_t DEFAULT_MAX_CACHED_SIZE_IN_MB = 2048;
+
+ public:
+  using Mode = HugePageMode;
+
+ private:
+  struct Allocation {
+    // ! Start of the mapped memory region
+    void* region;
+    // ! Size of the mapped memory region
+    size_t size;
+  };
+
+ public:
+  HugePageAllocator(const HugePageAllocator&) = delete;
+  HugePageAllocator & operator= (const HugePageAllocator &) = delete;
+
+  HugePageAllocator(HugePageAllocator&&) = delete;
+  HugePageAllocator & operator= (HugePageAllocator &&) = delete;
+
+  ~HugePageAllocator() {
+    release_cached_memory();
+  }
+
+  static HugePageAllocator& instance() {
+    static HugePageAllocator instance;
+    return instance;
+  }
+
+  // ! Configures the allocator. At most max_cached_size_in_mb megabytes
+  // ! of freed huge page allocations are kept for reuse.
+  void configure([[maybe_unused]] const Mode mode,
+                 const size_t max_cached_size_in_mb = DEFAULT_MAX_CACHED_SIZE_IN_MB) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    #ifdef __linux__
+    _mode = mode;
+    #else
+    // Huge pages are only supported on Linux
+    _mode = Mode::disabled;
+    #endif
+    _max_cached_size = max_cached_size_in_mb >= std::numeric_limits<size_t>::max() / MEGABYTE ?
+      std::numeric_limits<size_t>::max() : max_cached_size_in_mb * MEGABYTE;
+  }
+
+  Mode mode() const {
+    return _mode;
+  }
+
+  // ! Allocates size bytes of memory. If zero_initialize is true,
+  // ! the returned memory is set to zero.
+  void* allocate(const size_t size, const bool zero_initialize = false) {
+    if ( _mode == Mode::disabled || size < MIN_ALLOCATION_SIZE ) {
+      return zero_initialize ? scalable_calloc(size, 1) : scalable_malloc(size);
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    void* data = nullptr;
+    // Reuse the smallest cached allocation that is large enough, but
+    // not so large that most of it would be wasted on this request
+    auto cached = _cache.lower_bound(size);
+    if ( cached != _cache.end() && cached->first <= MAX_REUSE_FACTOR * size ) {
+      const Allocation allocation = cached->second;
+      _cache.erase(cached);
+      _cached_size -= allocation.size;
+      data = allocation.region;
+      _allocations[data] = allocation;
+      ++_num_reused_allocations;
+      if ( zero_initialize ) {
+        // Freshly mapped memory is zero initialized, but reused memory is not
+        std::memset(data, 0, size);
+      }
+      DBG << "Reuse cached allocation of" << allocation.size << "bytes for request of" << size << "bytes";
+    } else {
+      data = map_memory(size);
+      if ( !data ) {
+        return zero_initialize ? scalable_calloc(size, 1) : scalable_malloc(size);
+      }
+    }
+    return data;
+  }
+
+  // ! Frees memory allocated with allocate(size). Allocations below the size
+  // ! threshold are returned to the scalable allocator without acquiring the lock.
+  void free(void* data, const size_t size) {
+    if ( size < MIN_ALLOCATION_SIZE ) {
+      scalable_free(data);
+    } else {
+      free(data);
+    }
+  }
+
+  // ! Frees memory allocated with allocate(...)
+  void free(void* data) {
+    if ( !data ) {
+      return;
+    }
+    if ( _has_huge_page_allocations.load(std::memory_order_relaxed) ) {
+      std::lock_guard<std::mutex> lock(_mutex);
+      auto it = _allocations.find(data);
+      if ( it != _allocations.end() ) {
+        const Allocation allocation = it->second;
+        _allocations.erase(it);
+        if ( _cached_size + allocation.size <= _max_cached_size ) {
+          _cache.emplace(allocation.size, allocation);
+          _cached_size += allocation.size;
+        } else {
+          unmap_memory(allocation);
+        }
+        return;
+      }
+    }
+    scalable_free(data);
+  }
+
+  // ! Returns all cached huge page allocations to the OS
+  void release_cached_memory() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for ( auto& cached : _cache ) {
+      unmap_memory(cached.second);
+    }
+    _cache.clear();
+    _cached_size = 0;
+  }
+
+  size_t num_huge_page_allocations() const {
+    return _num_huge_page_allocations;
+  }
+
+  size_t num_reused_allocations() const {
+    return _num_reused_allocations;
+  }
+
+ private:
+  HugePageAllocator() :
+    _mutex(),
+    _mode(Mode::disabled),
+    _max_cached_size(DEFAULT_MAX_CACHED_SIZE_IN_MB * MEGABYTE),
+    _cached_size(0),
+    _allocations(),
+    _cache(),
+    _has_huge_page_allocations(false),
+    _num_huge_page_allocations(0),
+    _num_reused_allocations(0) { }
+
+  static size_t round_up(const size_t size, const size_t alignment) {
+    return alignment * ( size / alignment + ( size % alignment != 0 ) );
+  }
+
+  // ! Maps a memory region backed by huge pages. Returns nullptr, if this fails.
+  void* map_memory([[maybe_unused]] const size_t size) {
+    #ifdef __linux__
+    if ( _mode == Mode::explicit_2mb || _mode == Mode::explicit_1gb ) {
+      // Rounding a small request up to a whole 1 GB page wastes most of the
+      // page, so 1 GB pages are only used for requests of at least 1 GB
+      const bool use_gigantic_pages = _mode == Mode::explicit_1gb && size >= GIGANTIC_PAGE_SIZE;
+      const size_t page_size = use_gigantic_pages ? GIGANTIC_PAGE_SIZE : HUGE_PAGE_SIZE;
+      const size_t mapped_size = round_up(size, page_size);
+      int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+      #ifdef MAP_HUGE_SHIFT
+      flags |= ( use_gigantic_pages ? 30 : 21 ) << MAP_HUGE_SHIFT;
+      #endif
+      void* region = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, flags, -1, 0);
+      if ( region != MAP_FAILED ) {
+        return register_allocation(region, mapped_size);
+      }
+      DBG << "Failed to map" << mapped_size << "bytes on explicit huge pages"
+          << "=> fall back to transparent huge pages";
+    }
+
+    // Transparent huge pages: Overallocate such that the region can be aligned to the
+    // huge page size and return the unaligned head and tail of the mapping to the OS
+    const size_t mapped_size = round_up(size, HUGE_PAGE_SIZE);
+    char* region = static_cast<char*>(mmap(nullptr, mapped_size + HUGE_PAGE_SIZE,
+      PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    if ( region == MAP_FAILED ) {
+      return nullptr;
+    }
+    char* aligned_region = reinterpret_cast<char*>(
+      round_up(reinterpret_cast<size_t>(region), HUGE_PAGE_SIZE));
+    const size_t head = aligned_region - region;
+    if ( head > 0 ) {
+      munmap(region, head);
+    }
+    if ( HUGE_PAGE_SIZE - head > 0 ) {
+      munmap(aligned_region + mapped_size, HUGE_PAGE_SIZE - head);
+    }
+    #ifdef MADV_HUGEPAGE
+    madvise(aligned_region, mapped_size, MADV_HUGEPAGE);
+    #endif
+    return register_allocation(aligned_region, mapped_size);
+    #else
+    return nullptr;
+    #endif
+  }
+
+  void* register_allocation(void* region, const size_t size) {
+    _allocations[region] = Allocation { region, size };
+    _has_huge_page_allocations.store(true, std::memory_order_relaxed);
+    ++_num_huge_page_allocations;
+    return region;
+  }
+
+  void unmap_memory([[maybe_unused]] const Allocation& allocation) {
+    #ifdef __linux__
+    munmap(allocation.region, allocation.size);
+    #endif
+  }
+
+  std::mutex _mutex;
+  Mode _mode;
+  size_t _max_cached_size;
+  size_t _cached_size;
+  // ! Active huge page allocations
+  std::unordered_map<void*, Allocation> _allocations;
+  // ! Freed huge page allocations ordered by their size
+  std::multimap<size_t, Allocation> _cache;
+  std::atomic<bool> _has_huge_page_allocations;
+  size_t _num_huge_page_allocations;
+  size_t _num_reused_allocations;
+};
+
+template<typename T>
+struct huge_page_deleter {
+  huge_page_deleter() :
+    size(std::numeric_limits<size_t>::max()) { }
+
+  explicit huge_page_deleter(const size_t size_in_bytes) :
+    size(size_in_bytes) { }
+
+  void operator()(T *p) {
+    HugePageAllocator::instance().free(p, size);
+  }
+
+  // ! Size of the allocation in bytes (unknown, if default constructed)
+  size_t size;
+};
+
+template<typename T>
+using huge_page_unique_ptr = std::unique_ptr<T, huge_page_deleter<T>>;
+
+template<typename T>
+static huge_page_unique_ptr<T> make_huge_page_unique(const size_t size) {
+  T* ptr = static_cast<T*>(HugePageAllocator::instance().allocate(sizeof(T) * size));
+  return huge_page_unique_ptr<T>(ptr, parallel::huge_page_deleter<T>(sizeof(T) * size));
+}
+
+}  // namespace parallel
+}  // namespace mt_kahypar
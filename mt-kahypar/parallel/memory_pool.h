@@ -44,6 +44,7 @@
 #include "tbb/scalable_allocator.h"
 
 #include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/huge_page_allocator.h"
 #include "mt-kahypar/parallel/stl/scalable_unique_ptr.h"
 #include "mt-kahypar/utils/memory_tree.h"
 
@@ -158,7 +159,7 @@ class MemoryPoolT {
     // ! Note, the memory chunk is zero initialized.
     bool allocate() {
       if ( !_data && !_defer_allocation ) {
-        _data = (char*) scalable_calloc(_num_elements, _size);
+        _data = (char*) HugePageAllocator::instance().allocate(_num_elements * _size, true);
         return true;
       } else {
         return false;
@@ -168,7 +169,7 @@ class MemoryPoolT {
     // ! Frees the memory chunk
     void free() {
       if ( _data ) {
-        scalable_free(_data);
+        HugePageAllocator::instance().free(_data, _num_elements * _size);
         _data = nullptr;
       }
     }
@@ -592,6 +593,9 @@ class MemoryPoolT {
     _use_round_robin_assignment(true),
     _use_minimum_allocation_size(true),
     _use_unused_memory_chunks(true) {
+    // The memory chunks are freed in the destructor of the memory pool. Constructing
+    // the allocator first ensures that it is destroyed after the memory pool.
+    HugePageAllocator::instance();
     #ifdef __linux__
       _page_size = sysconf(_SC_PAGE_SIZE);
     #elif _WIN32
@@ -27,7 +27,10 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include <tbb/parallel_for_each.h>
+#include <tbb/concurrent_queue.h>
 
 #include "mt-kahypar/parallel/atomic_wrapper.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
@@ -51,6 +54,11 @@ struct ThreadQueue {
     front.store(0);
   }
 
+  size_t unsafe_size() const {
+    const size_t f = front.load(std::memory_order_relaxed);
+    return f < elements.size() ? elements.size() - f : 0;
+  }
+
   bool try_pop(T& dest) {
     size_t slot = front.fetch_add(1, std::memory_order_acq_rel);
     if (slot < elements.size()) {
@@ -59,19 +67,72 @@ struct ThreadQueue {
     }
     return false;
   }
+
+  // ! Claims half of the remaining elements (at most max_elements), but at least one element.
+  // ! The claimed elements are stored consecutively in elements[begin, end).
+  bool try_steal_half(const size_t max_elements, size_t& begin, size_t& end) {
+    size_t f = front.load(std::memory_order_relaxed);
+    while (f < elements.size()) {
+      const size_t remaining = elements.size() - f;
+      const size_t num_elements = std::min(max_elements, std::max(remaining / 2, UL(1)));
+      if (front.compare_exchange_weak(f, f + num_elements, std::memory_order_acq_rel)) {
+        begin = f;
+        end = f + num_elements;
+        return true;
+      }
+    }
+    return false;
+  }
 };
 
+/*!
+ * Work container with one queue per thread. A thread first pops elements from its own
+ * queue. If its queue is empty, it steals half of the remaining elements of another queue
+ * with a single CAS operation. The stolen elements are consecutive in the victim queue and
+ * are buffered in a thread-local range, from which the thread pops without synchronization.
+ * Victims are visited in round-robin order starting at the successor of the stealing thread
+ * such that concurrent thieves do not contend on the same queue. Since the elements of a
+ * queue are usually inserted in order of their IDs (or grouped via sort_by_key(...)), stolen
+ * batches preserve their locality.
+ *
+ * A thread that stops popping early must call release_stolen_elements(...) such that
+ * the unconsumed part of its stolen range remains available to the other threads.
+ *
+ * Note that each thread_id must only be used by one thread at a time when calling try_pop(...).
+ */
 template<typename T>
 struct WorkContainer {
 
+  static constexpr size_t MAX_STEAL_SIZE = 64;
+
+  // ! Range of elements stolen from tls_queues[queue]
+  struct StolenRange {
+    size_t queue = 0;
+    size_t begin = 0;
+    size_t end = 0;
+    // ! Avoids false sharing between threads
+    char padding[64 - 3 * sizeof(size_t)];
+  };
+
   WorkContainer(size_t maxNumThreads = 0) :
-    tls_queues(maxNumThreads) { }
+    tls_queues(maxNumThreads),
+    stolen_ranges(maxNumThreads),
+    released_elements() { }
+
+  void resize(size_t maxNumThreads) {
+    tls_queues.resize(maxNumThreads);
+    stolen_ranges.resize(maxNumThreads);
+  }
 
   size_t unsafe_size() const {
     size_t sz = 0;
     for (const ThreadQueue<T>& q : tls_queues) {
-      sz += q.elements.size() - q.front.load(std::memory_order_relaxed);
+      sz += q.unsafe_size();
     }
+    for (const StolenRange& r : stolen_ranges) {
+      sz += r.end - r.begin;
+    }
+    sz += released_elements.unsafe_size();
     return sz;
   }
 
@@ -84,12 +145,36 @@ struct WorkContainer {
 
   bool try_pop(T& dest, size_t thread_id) {
     ASSERT(thread_id < tls_queues.size());
-    return tls_queues[thread_id].try_pop(dest) || steal_work(dest);
+    StolenRange& stolen = stolen_ranges[thread_id];
+    if (stolen.begin < stolen.end) {
+      dest = tls_queues[stolen.queue].elements[stolen.begin++];
+      return true;
+    }
+    return tls_queues[thread_id].try_pop(dest) || released_elements.try_pop(dest) ||
+      steal_work(dest, thread_id);
   }
 
-  bool steal_work(T& dest) {
-    for (ThreadQueue<T>& q : tls_queues) {
-      if (q.try_pop(dest)) {
+  // ! Makes the unconsumed elements stolen by thread_id available to all threads
+  void release_stolen_elements(size_t thread_id) {
+    ASSERT(thread_id < stolen_ranges.size());
+    StolenRange& stolen = stolen_ranges[thread_id];
+    for ( ; stolen.begin < stolen.end; ++stolen.begin) {
+      released_elements.push(tls_queues[stolen.queue].elements[stolen.begin]);
+    }
+  }
+
+  bool steal_work(T& dest, size_t thread_id) {
+    ASSERT(thread_id < stolen_ranges.size());
+    StolenRange& stolen = stolen_ranges[thread_id];
+    const size_t num_queues = tls_queues.size();
+    for (size_t i = 1; i <= num_queues; ++i) {
+      const size_t victim = (thread_id + i) % num_queues;
+      size_t begin = 0, end = 0;
+      if (tls_queues[victim].try_steal_half(MAX_STEAL_SIZE, begin, end)) {
+        dest = tls_queues[victim].elements[begin];
+        stolen.queue = victim;
+        stolen.begin = begin + 1;
+        stolen.end = end;
         return true;
       }
     }
@@ -102,13 +187,31 @@ struct WorkContainer {
     });
   }
 
+  // ! Groups the elements of each queue by their key, the order of
+  // ! elements with the same key is preserved (e.g., after shuffle())
+  template<typename F>
+  void sort_by_key(const F& key) {
+    tbb::parallel_for_each(tls_queues, [&](ThreadQueue<T>& q) {
+      std::stable_sort(q.elements.begin(), q.elements.end(), [&](const T& lhs, const T& rhs) {
+        return key(lhs) < key(rhs);
+      });
+    });
+  }
+
   void clear() {
     for (ThreadQueue<T>& q : tls_queues) {
       q.clear();
     }
+    for (StolenRange& r : stolen_ranges) {
+      r = StolenRange();
+    }
+    released_elements.clear();
   }
 
   vec<ThreadQueue<T>> tls_queues;
+  vec<StolenRange> stolen_ranges;
+  // ! Unconsumed stolen elements of threads that stopped early
+  tbb::concurrent_queue<T> released_elements;
 
   using SubRange = IteratorRange< typename vec<T>::const_iterator >;
   using Range = ConcatenatedRange<SubRange>;
@@ -129,6 +232,7 @@ struct WorkContainer {
     for (const ThreadQueue<T>& q : tls_queues) {
       local_work_queue_node->updateSize(q.elements.capacity() * sizeof(T));
     }
+    work_container_node->addChild("Stolen Ranges", stolen_ranges.capacity() * sizeof(StolenRange));
   }
 };
 
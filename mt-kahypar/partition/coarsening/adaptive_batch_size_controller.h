@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/utils/efficiency_estimator.h"
+#include "mt-kahypar/utils/utilities.h"
+
+namespace mt_kahypar {
+
+/*!
+ * The n-level uncoarsener performs a localized search once the uncontracted batches
+ * contain at least a minimum number of border vertices. Small values cause a large
+ * overhead of per-batch refinement and synchronization on the finer levels, whereas
+ * large values reduce the solution quality on the coarser levels. The controller
+ * measures the improvement per second (efficiency) of each localized search and
+ * compares it to the exponential moving average of all previous searches (see
+ * EfficiencyEstimator). If a search was more efficient than the average, the
+ * threshold is decreased by scaling_factor (refinement pays off) and otherwise it
+ * is increased. The threshold stays between the initial threshold divided by
+ * max_multiplier (but at least one border vertex per thread) and max_multiplier
+ * times the initial threshold.
+ */
+class AdaptiveBatchSizeController {
+
+  static constexpr bool debug = false;
+
+ public:
+  explicit AdaptiveBatchSizeController(const Context& context) :
+    _context(context),
+    _threshold(std::max(context.refinement.max_batch_size,
+      context.shared_memory.num_threads * context.refinement.min_border_vertices_per_thread)),
+    _min_threshold(_threshold),
+    _max_threshold(_threshold),
+    _efficiency(),
+    _num_refinements(0),
+    _num_refinement_nodes(0),
+    _total_gain(0),
+    _total_time(0.0),
+    _total_threshold(0.0),
+    _num_increases(0),
+    _num_decreases(0) {
+    const AdaptiveBatchSizeParameters& params = context.refinement.adaptive_batch_size;
+    if ( params.enabled ) {
+      const size_t max_multiplier = std::max(params.max_multiplier, UL(1));
+      _min_threshold = std::max(_threshold / max_multiplier,
+        std::max(context.shared_memory.num_threads, UL(1)));
+      _min_threshold = std::min(_min_threshold, _threshold);
+      _max_threshold = _threshold <= std::numeric_limits<size_t>::max() / max_multiplier ?
+        _threshold * max_multiplier : std::numeric_limits<size_t>::max();
+    }
+  }
+
+  AdaptiveBatchSizeController(const AdaptiveBatchSizeController&) = delete;
+  AdaptiveBatchSizeController(AdaptiveBatchSizeController&&) = delete;
+  AdaptiveBatchSizeController & operator= (const AdaptiveBatchSizeController &) = delete;
+  AdaptiveBatchSizeController & operator= (AdaptiveBatchSizeController &&) = delete;
+
+  // ! Minimum number of border vertices with which we perform a localized search
+  size_t minNumBorderVertices() const {
+    return _threshold;
+  }
+
+  // ! Executes the localized search, measures its improvement of the
+  // ! objective function and its running time, and adapts the threshold
+  template<typename F>
+  void execute(const size_t num_refinement_nodes, const Metrics& current_metrics, const F& refine) {
+    const HyperedgeWeight quality_before = current_metrics.quality;
+    HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    refine();
+    HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+    const HyperedgeWeight gain = std::max(quality_before - current_metrics.quality, 0);
+    const double time = std::chrono::duration<double>(end - start).count();
+
+    ++_num_refinements;
+    _num_refinement_nodes += num_refinement_nodes;
+    _total_gain += gain;
+    _total_time += time;
+    _total_threshold += _threshold;
+    update(gain, time);
+  }
+
+  // ! Reports the per-batch refinement telemetry
+  void reportStatistics() const {
+    utils::Stats& stats = utils::Utilities::instance().getStats(_context.utility_id);
+    const double num_refinements = std::max(_num_refinements, UL(1));
+    stats.add_stat("num_localized_refinements", static_cast<int64_t>(_num_refinements));
+    stats.add_stat("avg_localized_refinement_nodes", _num_refinement_nodes / num_refinements);
+    stats.add_stat("avg_localized_refinement_gain", _total_gain / num_refinements);
+    stats.add_stat("avg_localized_refinement_time", _total_time / num_refinements);
+    stats.add_stat("avg_min_num_border_vertices", _total_threshold / num_refinements);
+    if ( _context.refinement.adaptive_batch_size.enabled ) {
+      stats.add_stat("adaptive_batch_size_increases", static_cast<int64_t>(_num_increases));
+      stats.add_stat("adaptive_batch_size_decreases", static_cast<int64_t>(_num_decreases));
+    }
+  }
+
+ private:
+  void update(const HyperedgeWeight gain, const double time) {
+    const double efficiency = utils::EfficiencyEstimator::efficiency(gain, time);
+    if ( _context.refinement.adaptive_batch_size.enabled ) {
+      const double scaling_factor = std::max(_context.refinement.adaptive_batch_size.scaling_factor, 1.0);
+      if ( gain > 0 && ( !_efficiency.isMeasured() || efficiency >= _efficiency.average() ) ) {
+        _threshold = std::max(static_cast<size_t>(_threshold / scaling_factor), _min_threshold);
+        ++_num_decreases;
+      } else {
+        _threshold = static_cast<double>(_threshold) * scaling_factor >= _max_threshold ?
+          _max_threshold : static_cast<size_t>(_threshold * scaling_factor);
+        ++_num_increases;
+      }
+      DBG << "Localized search: gain =" << gain << ", time =" << time << "s, efficiency ="
+          << efficiency << ", average efficiency =" << _efficiency.average() << ", new threshold =" << _threshold;
+    }
+    _efficiency.add(gain, time);
+  }
+
+  const Context& _context;
+  // ! Current value and bounds of the minimum number of border vertices
+  size_t _threshold;
+  size_t _min_threshold;
+  size_t _max_threshold;
+  // ! Improvement per second of the localized searches
+  utils::EfficiencyEstimator _efficiency;
+
+  // ! Telemetry
+  size_t _num_refinements;
+  size_t _num_refinement_nodes;
+  HyperedgeWeight _total_gain;
+  double _total_time;
+  double _total_threshold;
+  size_t _num_increases;
+  size_t _num_decreases;
+};
+
+}  // namespace mt_kahypar
@@ -176,6 +176,7 @@ class MultilevelCoarsener : public ICoarsener,
     }
     _rater.resetMatches();
     _rater.setCurrentNumberOfNodes(current_hg.initialNumNodes());
+    _rater.initializeScorePolicy(current_hg);
     const HypernodeID num_hns_before_pass = current_hg.initialNumNodes() - current_hg.numRemovedHypernodes();
     const HypernodeID hierarchy_contraction_limit = hierarchyContractionLimit(current_hg);
     DBG << V(current_hg.initialNumNodes()) << V(hierarchy_contraction_limit);
@@ -120,6 +120,10 @@ namespace mt_kahypar {
 
   template<typename TypeTraits>
   void MultilevelUncoarsener<TypeTraits>::rebalancingImpl() {
+    if ( _context.type == ContextType::main ) {
+      _refinement_controller.reportStatistics();
+    }
+
     // If we reach the top-level hypergraph and the partition is still imbalanced,
     // we use a rebalancing algorithm to restore balance.
     if (_context.type == ContextType::main && !metrics::isBalanced(*_uncoarseningData.partitioned_hg, _context)) {
@@ -208,38 +212,54 @@ namespace mt_kahypar {
     parallel::scalable_vector<HypernodeID> dummy;
     bool improvement_found = true;
     mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(partitioned_hypergraph);
+    _refinement_controller.startLevel();
     while( improvement_found ) {
       improvement_found = false;
       const HyperedgeWeight metric_before = _current_metrics.quality;
 
-      if ( _label_propagation && _context.refinement.label_propagation.algorithm != LabelPropagationAlgorithm::do_nothing ) {
-        _timer.start_timer("initialize_lp_refiner", "Initialize LP Refiner");
-        _label_propagation->initialize(phg);
-        _timer.stop_timer("initialize_lp_refiner");
-
-        _timer.start_timer("label_propagation", "Label Propagation");
-        improvement_found |= _label_propagation->refine(phg, dummy, _current_metrics, time_limit);
-        _timer.stop_timer("label_propagation");
+      if ( _label_propagation && _context.refinement.label_propagation.algorithm != LabelPropagationAlgorithm::do_nothing &&
+           _refinement_controller.shouldRun(AdaptiveRefinementController::Refiner::label_propagation) ) {
+        improvement_found |= _refinement_controller.execute(
+          AdaptiveRefinementController::Refiner::label_propagation, _current_metrics, [&] {
+          _timer.start_timer("initialize_lp_refiner", "Initialize LP Refiner");
+          _label_propagation->initialize(phg);
+          _timer.stop_timer("initialize_lp_refiner");
+
+          _timer.start_timer("label_propagation", "Label Propagation");
+          const bool improved = _label_propagation->refine(phg, dummy, _current_metrics, time_limit);
+          _timer.stop_timer("label_propagation");
+          return improved;
+        });
       }
 
-      if ( _fm && _context.refinement.fm.algorithm != FMAlgorithm::do_nothing ) {
-        _timer.start_timer("initialize_fm_refiner", "Initialize FM Refiner");
-        _fm->initialize(phg);
-        _timer.stop_timer("initialize_fm_refiner");
-
-        _timer.start_timer("fm", "FM");
-        improvement_found |= _fm->refine(phg, dummy, _current_metrics, time_limit);
-        _timer.stop_timer("fm");
+      if ( _fm && _context.refinement.fm.algorithm != FMAlgorithm::do_nothing &&
+           _refinement_controller.shouldRun(AdaptiveRefinementController::Refiner::fm) ) {
+        improvement_found |= _refinement_controller.execute(
+          AdaptiveRefinementController::Refiner::fm, _current_metrics, [&] {
+          _timer.start_timer("initialize_fm_refiner", "Initialize FM Refiner");
+          _fm->initialize(phg);
+          _timer.stop_timer("initialize_fm_refiner");
+
+          _timer.start_timer("fm", "FM");
+          const bool improved = _fm->refine(phg, dummy, _current_metrics, time_limit);
+          _timer.stop_timer("fm");
+          return improved;
+        });
       }
 
-      if ( _flows && _context.refinement.flows.algorithm != FlowAlgorithm::do_nothing ) {
-        _timer.start_timer("initialize_flow_scheduler", "Initialize Flow Scheduler");
-        _flows->initialize(phg);
-        _timer.stop_timer("initialize_flow_scheduler");
-
-        _timer.start_timer("flow_refinement_scheduler", "Flow Refinement Scheduler");
-        improvement_found |= _flows->refine(phg, dummy, _current_metrics, time_limit);
-        _timer.stop_timer("flow_refinement_scheduler");
+      if ( _flows && _context.refinement.flows.algorithm != FlowAlgorithm::do_nothing &&
+           _refinement_controller.shouldRun(AdaptiveRefinementController::Refiner::flows) ) {
+        improvement_found |= _refinement_controller.execute(
+          AdaptiveRefinementController::Refiner::flows, _current_metrics, [&] {
+          _timer.start_timer("initialize_flow_scheduler", "Initialize Flow Scheduler");
+          _flows->initialize(phg);
+          _timer.stop_timer("initialize_flow_scheduler");
+
+          _timer.start_timer("flow_refinement_scheduler", "Flow Refinement Scheduler");
+          const bool improved = _flows->refine(phg, dummy, _current_metrics, time_limit);
+          _timer.stop_timer("flow_refinement_scheduler");
+          return improved;
+        });
       }
 
       if ( _context.type == ContextType::main ) {
@@ -256,6 +276,7 @@ namespace mt_kahypar {
         break;
       }
     }
+    _refinement_controller.finishLevel();
 
     if ( _context.type == ContextType::main) {
       DBG << "--------------------------------------------------\n";
@@ -101,6 +101,7 @@ class MultilevelUncoarsener : public IUncoarsener<TypeTraits>,
   using Base::_fm;
   using Base::_flows;
   using Base::_rebalancer;
+  using Base::_refinement_controller;
   using Base::_timer;
 
   const TargetGraph* _target_graph;
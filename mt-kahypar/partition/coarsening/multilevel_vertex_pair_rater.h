@@ -105,7 +105,8 @@ class MultilevelVertexPairRater {
     _bloom_filter_mask(align_to_next_power_of_two(
       std::min(ID(10) * max_edge_size, _current_num_nodes)) - 1),
     _local_bloom_filter(_bloom_filter_mask + 1),
-    _already_matched(num_hypernodes) { }
+    _already_matched(num_hypernodes),
+    _score_policy() { }
 
   MultilevelVertexPairRater(const MultilevelVertexPairRater&) = delete;
   MultilevelVertexPairRater & operator= (const MultilevelVertexPairRater &) = delete;
@@ -142,6 +143,14 @@ class MultilevelVertexPairRater {
     _already_matched.set(original_id, true);
   }
 
+  // ! Precomputes the information required by the score policy
+  // ! for rating the vertices of the given hypergraph.
+  // ! Note, this function must be called before rating vertices of a new hypergraph.
+  template<typename Hypergraph>
+  void initializeScorePolicy(const Hypergraph& hypergraph) {
+    _score_policy.initialize(hypergraph, _context);
+  }
+
   // ! Note, this function is not thread safe
   void resetMatches() {
     _already_matched.reset();
@@ -218,8 +227,8 @@ class MultilevelVertexPairRater {
       if ( edge_size < _context.partition.ignore_hyperedge_size_threshold ) {
         edge_size = _context.coarsening.use_adaptive_edge_size ?
           std::max(adaptiveEdgeSize(hypergraph, he, bloom_filter, cluster_ids), ID(2)) : edge_size;
-        const RatingType score = ScorePolicy::score(
-          hypergraph.edgeWeight(he), edge_size);
+        const RatingType score = _score_policy.score(
+          he, hypergraph.edgeWeight(he), edge_size);
         for ( const HypernodeID& v : hypergraph.pins(he) ) {
           const HypernodeID representative = cluster_ids[v];
           ASSERT(representative < hypergraph.initialNumNodes());
@@ -251,8 +260,8 @@ class MultilevelVertexPairRater {
         if ( num_tmp_rating_map_accesses + edge_size > _vertex_degree_sampling_threshold  ) {
           break;
         }
-        const RatingType score = ScorePolicy::score(
-          hypergraph.edgeWeight(he), edge_size);
+        const RatingType score = _score_policy.score(
+          he, hypergraph.edgeWeight(he), edge_size);
         for ( const HypernodeID& v : hypergraph.pins(he) ) {
           const HypernodeID representative = cluster_ids[v];
           ASSERT(representative < hypergraph.initialNumNodes());
@@ -360,5 +369,8 @@ class MultilevelVertexPairRater {
 
   // ! Marks all matched vertices
   kahypar::ds::FastResetFlagArray<> _already_matched;
+
+  // ! Computes the contribution of a hyperedge to the rating of its pins
+  ScorePolicy _score_policy;
 };
 }  // namespace mt_kahypar
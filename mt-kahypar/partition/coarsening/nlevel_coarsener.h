@@ -41,6 +41,7 @@
 #include "mt-kahypar/partition/coarsening/policies/rating_acceptance_policy.h"
 #include "mt-kahypar/partition/coarsening/policies/rating_heavy_node_penalty_policy.h"
 #include "mt-kahypar/partition/coarsening/policies/rating_score_policy.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
 #include "mt-kahypar/parallel/parallel_prefix_sum.h"
 #include "mt-kahypar/utils/cast.h"
 #include "mt-kahypar/utils/progress_bar.h"
@@ -141,6 +142,7 @@ class NLevelCoarsener : public ICoarsener,
                        utils::cast<Hypergraph>(hypergraph).numRemovedHypernodes()),
     _current_vertices(),
     _tmp_current_vertices(),
+    _round_contractions(),
     _enabled_vertex_flag_array(),
     _cl_tracker(context),
     _pass_nr(0),
@@ -194,13 +196,18 @@ class NLevelCoarsener : public ICoarsener,
 
     HighResClockTimepoint round_start = std::chrono::high_resolution_clock::now();
     _timer.start_timer("clustering", "Clustering");
-    tbb::parallel_for(UL(0), _current_vertices.size(), [&](const size_t i) {
-      if ( _cl_tracker.currentNumNodes() > contraction_limit ) {
-        const HypernodeID& hn = _current_vertices[i];
-        const HypernodeID num_contractions = contract(hn);
-        _cl_tracker.update(num_contractions, contraction_limit);
-      }
-    });
+    _rater.initializeScorePolicy(_hg);
+    if ( _context.coarsening.nlevel_round_size > 0 ) {
+      contractInRounds(contraction_limit);
+    } else {
+      tbb::parallel_for(UL(0), _current_vertices.size(), [&](const size_t i) {
+        if ( _cl_tracker.currentNumNodes() > contraction_limit ) {
+          const HypernodeID& hn = _current_vertices[i];
+          const HypernodeID num_contractions = contract(hn);
+          _cl_tracker.update(num_contractions, contraction_limit);
+        }
+      });
+    }
     _timer.stop_timer("clustering");
 
     // Remove single-pin and parallel nets
@@ -260,6 +267,81 @@ class NLevelCoarsener : public ICoarsener,
     return num_contractions;
   }
 
+  /**
+   * Processes the vertices of the current pass in rounds of nlevel_round_size vertices.
+   * Each round consists of three parallel phases:
+   *  (i) all vertices of the round are rated on the same version of the hypergraph,
+   *  (ii) the resulting contractions are registered in the contraction forest, and
+   *  (iii) all registered contractions are performed.
+   * Rating does not interleave with contractions of other threads, which avoids lock
+   * contention on the hypergraph. The contraction forest and the resulting batch
+   * uncontraction hierarchy are the same as for the interleaved scheme. The number of
+   * successfully registered contractions per round is bounded by the distance to the
+   * contraction limit.
+   */
+  void contractInRounds(const HypernodeID contraction_limit) {
+    const HypernodeWeight max_allowed_node_weight = _context.coarsening.max_allowed_node_weight;
+    const size_t round_size = std::min(_context.coarsening.nlevel_round_size, _current_vertices.size());
+    if ( _round_contractions.size() < round_size ) {
+      _round_contractions.resize(round_size);
+    }
+    size_t start = 0;
+    while ( start < _current_vertices.size() && _cl_tracker.currentNumNodes() > contraction_limit ) {
+      const HypernodeID max_contractions = _cl_tracker.currentNumNodes() - contraction_limit;
+      const size_t end = std::min(start + round_size, _current_vertices.size());
+
+      // (i) Rate all vertices of the round
+      tbb::parallel_for(start, end, [&](const size_t i) {
+        const HypernodeID hn = _current_vertices[i];
+        HypernodeID& target = _round_contractions[i - start];
+        target = kInvalidHypernode;
+        if ( _hg.nodeIsEnabled(hn) ) {
+          target = _rater.rate(_hg, hn, max_allowed_node_weight).target;
+        }
+      });
+
+      // (ii) Register contractions in the contraction forest. Afterwards,
+      // _round_contractions stores the contraction partner v of each registered
+      // contraction (u, v), which is removed from the hypergraph.
+      CAtomic<HypernodeID> num_registered(0);
+      tbb::parallel_for(start, end, [&](const size_t i) {
+        HypernodeID& target = _round_contractions[i - start];
+        if ( target != kInvalidHypernode ) {
+          HypernodeID u = _current_vertices[i];
+          HypernodeID v = target;
+          target = kInvalidHypernode;
+          // In case v is a high degree vertex, we reverse contraction order to improve performance
+          if ( _hg.nodeDegree(u) < _hg.nodeDegree(v) && _hg.nodeDegree(v) > HIGH_DEGREE_VERTEX_THRESHOLD ) {
+            std::swap(u, v);
+          }
+          // Reserve a contraction before registering it and release the reservation
+          // if the registration fails such that only registered contractions count
+          // against the contraction limit
+          if ( num_registered.fetch_add(1, std::memory_order_relaxed) < max_contractions &&
+               _hg.registerContraction(u, v) ) {
+            _rater.markAsMatched(u);
+            _rater.markAsMatched(v);
+            target = v;
+          } else {
+            num_registered.fetch_sub(1, std::memory_order_relaxed);
+          }
+        }
+      });
+
+      // (iii) Perform all registered contractions
+      tbb::parallel_for(start, end, [&](const size_t i) {
+        const HypernodeID v = _round_contractions[i - start];
+        if ( v != kInvalidHypernode ) {
+          const HypernodeID num_contractions = _hg.contract(v, max_allowed_node_weight);
+          _progress_bar += num_contractions;
+          _cl_tracker.update(num_contractions, contraction_limit);
+        }
+      });
+      _cl_tracker.updateCurrentNumNodes();
+      start = end;
+    }
+  }
+
   HypernodeID currentNumberOfNodesImpl() const override {
     return _cl_tracker.currentNumNodes();
   }
@@ -314,6 +396,7 @@ class NLevelCoarsener : public ICoarsener,
   const HypernodeID _initial_num_nodes;
   parallel::scalable_vector<HypernodeID> _current_vertices;
   parallel::scalable_vector<HypernodeID> _tmp_current_vertices;
+  parallel::scalable_vector<HypernodeID> _round_contractions;
   parallel::scalable_vector<size_t> _enabled_vertex_flag_array;
   ContractionLimitTracker _cl_tracker;
   int _pass_nr;
@@ -159,15 +159,18 @@ namespace mt_kahypar {
           }
         });
         _timer.stop_timer("collect_border_vertices", _force_measure_timings);
+        const size_t num_border_vertices = _tmp_refinement_nodes.size();
 
         // We perform localized refinement around the uncontracted nodes if the current number
-        // of border nodes is greater than a predefined threshold.
-        if ( _tmp_refinement_nodes.size() >= _stats.min_num_border_vertices ) {
+        // of border nodes is greater than a threshold (adapted by the batch size controller).
+        if ( _tmp_refinement_nodes.size() >= _batch_size_controller.minNumBorderVertices() ) {
           localizedRefine(*_uncoarseningData.partitioned_hg);
         }
 
         ++_stats.num_batches;
         _stats.total_batch_sizes += batch.size();
+        _stats.max_batch_size = std::max(_stats.max_batch_size, batch.size());
+        _stats.total_border_vertices += num_border_vertices;
         // Update Progress Bar
         _progress.setObjective(_current_metrics.quality);
         _progress += batch.size();
@@ -229,6 +232,11 @@ namespace mt_kahypar {
 
   template<typename TypeTraits>
   void NLevelUncoarsener<TypeTraits>::rebalancingImpl() {
+    if ( _context.type == ContextType::main ) {
+      _refinement_controller.reportStatistics();
+      _batch_size_controller.reportStatistics();
+    }
+
     // If we reach the top-level hypergraph and the partition is still imbalanced,
     // we use a rebalancing algorithm to restore balance.
     if ( _context.type == ContextType::main && !metrics::isBalanced(*_uncoarseningData.partitioned_hg, _context)) {
@@ -306,35 +314,37 @@ namespace mt_kahypar {
           << ", imbalance = " << _current_metrics.imbalance;
     }
 
-    bool improvement_found = true;
-    mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(partitioned_hypergraph);
-    while( improvement_found ) {
-      improvement_found = false;
+    _batch_size_controller.execute(refinement_nodes.size(), _current_metrics, [&] {
+      bool improvement_found = true;
+      mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(partitioned_hypergraph);
+      while( improvement_found ) {
+        improvement_found = false;
 
-      if ( _label_propagation && _context.refinement.label_propagation.algorithm != LabelPropagationAlgorithm::do_nothing ) {
-        _timer.start_timer("label_propagation", "Label Propagation", false, _force_measure_timings);
-        improvement_found |= _label_propagation->refine(phg,
-          refinement_nodes, _current_metrics, std::numeric_limits<double>::max());
-        _timer.stop_timer("label_propagation", _force_measure_timings);
-      }
+        if ( _label_propagation && _context.refinement.label_propagation.algorithm != LabelPropagationAlgorithm::do_nothing ) {
+          _timer.start_timer("label_propagation", "Label Propagation", false, _force_measure_timings);
+          improvement_found |= _label_propagation->refine(phg,
+            refinement_nodes, _current_metrics, std::numeric_limits<double>::max());
+          _timer.stop_timer("label_propagation", _force_measure_timings);
+        }
 
-      if ( _fm && _context.refinement.fm.algorithm != FMAlgorithm::do_nothing ) {
-        _timer.start_timer("fm", "FM", false, _force_measure_timings);
-        improvement_found |= _fm->refine(phg,
-          refinement_nodes, _current_metrics, std::numeric_limits<double>::max());
-        _timer.stop_timer("fm", _force_measure_timings);
-      }
+        if ( _fm && _context.refinement.fm.algorithm != FMAlgorithm::do_nothing ) {
+          _timer.start_timer("fm", "FM", false, _force_measure_timings);
+          improvement_found |= _fm->refine(phg,
+            refinement_nodes, _current_metrics, std::numeric_limits<double>::max());
+          _timer.stop_timer("fm", _force_measure_timings);
+        }
 
-      if ( _context.type == ContextType::main ) {
-        ASSERT(_current_metrics.quality == metrics::quality(partitioned_hypergraph, _context.partition.objective),
-            "Actual metric" << V(metrics::quality(partitioned_hypergraph, _context)) <<
-            "does not match the metric updated by the refiners" << V(_current_metrics.quality));
-      }
+        if ( _context.type == ContextType::main ) {
+          ASSERT(_current_metrics.quality == metrics::quality(partitioned_hypergraph, _context.partition.objective),
+              "Actual metric" << V(metrics::quality(partitioned_hypergraph, _context)) <<
+              "does not match the metric updated by the refiners" << V(_current_metrics.quality));
+        }
 
-      if ( !_context.refinement.refine_until_no_improvement ) {
-        break;
+        if ( !_context.refinement.refine_until_no_improvement ) {
+          break;
+        }
       }
-    }
+    });
 
     if ( _context.type == ContextType::main) {
       DBG << "--------------------------------------------------\n";
@@ -375,24 +385,35 @@ namespace mt_kahypar {
         _context.refinement.fm, _context.refinement.global_fm);
       bool improvement_found = true;
       mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(partitioned_hypergraph);
+      _refinement_controller.startLevel();
       while( improvement_found ) {
         improvement_found = false;
         const HyperedgeWeight metric_before = _current_metrics.quality;
 
-        if ( _fm && _context.refinement.fm.algorithm != FMAlgorithm::do_nothing ) {
-          _timer.start_timer("fm", "FM");
-          improvement_found |= _fm->refine(phg, {}, _current_metrics, time_limit);
-          _timer.stop_timer("fm");
+        if ( _fm && _context.refinement.fm.algorithm != FMAlgorithm::do_nothing &&
+             _refinement_controller.shouldRun(AdaptiveRefinementController::Refiner::fm) ) {
+          improvement_found |= _refinement_controller.execute(
+            AdaptiveRefinementController::Refiner::fm, _current_metrics, [&] {
+            _timer.start_timer("fm", "FM");
+            const bool improved = _fm->refine(phg, {}, _current_metrics, time_limit);
+            _timer.stop_timer("fm");
+            return improved;
+          });
         }
 
-        if ( _flows && _context.refinement.flows.algorithm != FlowAlgorithm::do_nothing ) {
-          _timer.start_timer("initialize_flow_scheduler", "Initialize Flow Scheduler");
-          _flows->initialize(phg);
-          _timer.stop_timer("initialize_flow_scheduler");
-
-          _timer.start_timer("flow_refinement_scheduler", "Flow Refinement Scheduler");
-          improvement_found |= _flows->refine(phg, {}, _current_metrics, time_limit);
-          _timer.stop_timer("flow_refinement_scheduler");
+        if ( _flows && _context.refinement.flows.algorithm != FlowAlgorithm::do_nothing &&
+             _refinement_controller.shouldRun(AdaptiveRefinementController::Refiner::flows) ) {
+          improvement_found |= _refinement_controller.execute(
+            AdaptiveRefinementController::Refiner::flows, _current_metrics, [&] {
+            _timer.start_timer("initialize_flow_scheduler", "Initialize Flow Scheduler");
+            _flows->initialize(phg);
+            _timer.stop_timer("initialize_flow_scheduler");
+
+            _timer.start_timer("flow_refinement_scheduler", "Flow Refinement Scheduler");
+            const bool improved = _flows->refine(phg, {}, _current_metrics, time_limit);
+            _timer.stop_timer("flow_refinement_scheduler");
+            return improved;
+          });
         }
 
         if ( _context.type == ContextType::main ) {
@@ -409,6 +430,7 @@ namespace mt_kahypar {
           break;
         }
       }
+      _refinement_controller.finishLevel();
       // Reset FM context
       applyGlobalFMParameters(_context.refinement.fm, tmp_global_fm);
       _timer.stop_timer("global_refinement");
@@ -33,6 +33,7 @@
 #include "mt-kahypar/partition/coarsening/uncoarsener_base.h"
 #include "mt-kahypar/partition/refinement/i_refiner.h"
 #include "mt-kahypar/partition/coarsening/coarsening_commons.h"
+#include "mt-kahypar/partition/coarsening/adaptive_batch_size_controller.h"
 #include "mt-kahypar/datastructures/streaming_vector.h"
 
 namespace mt_kahypar {
@@ -60,26 +61,30 @@ class NLevelUncoarsener : public IUncoarsener<TypeTraits>,
       utility_id(context.utility_id),
       num_batches(0),
       total_batch_sizes(0),
-      current_number_of_nodes(0),
-      min_num_border_vertices(0) {
-      min_num_border_vertices = std::max(context.refinement.max_batch_size,
-        context.shared_memory.num_threads * context.refinement.min_border_vertices_per_thread);
-    }
+      max_batch_size(0),
+      total_border_vertices(0),
+      current_number_of_nodes(0) { }
 
     ~NLevelStats() {
       double avg_batch_size = static_cast<double>(total_batch_sizes) / num_batches;
+      double avg_border_vertices_per_batch = static_cast<double>(total_border_vertices) / num_batches;
       utils::Utilities::instance().getStats(utility_id).add_stat(
         "num_batches", static_cast<int64_t>(num_batches));
       utils::Utilities::instance().getStats(utility_id).add_stat(
         "avg_batch_size", avg_batch_size);
-      DBG << V(num_batches) << V(avg_batch_size);
+      utils::Utilities::instance().getStats(utility_id).add_stat(
+        "max_batch_size", static_cast<int64_t>(max_batch_size));
+      utils::Utilities::instance().getStats(utility_id).add_stat(
+        "avg_border_vertices_per_batch", avg_border_vertices_per_batch);
+      DBG << V(num_batches) << V(avg_batch_size) << V(max_batch_size) << V(avg_border_vertices_per_batch);
     }
 
     const size_t utility_id;
     size_t num_batches;
     size_t total_batch_sizes;
+    size_t max_batch_size;
+    size_t total_border_vertices;
     HypernodeID current_number_of_nodes;
-    size_t min_num_border_vertices;
   };
 
  public:
@@ -93,6 +98,7 @@ class NLevelUncoarsener : public IUncoarsener<TypeTraits>,
     _tmp_refinement_nodes(),
     _border_vertices_of_batch(hypergraph.initialNumNodes()),
     _stats(context),
+    _batch_size_controller(context),
     _current_metrics(),
     _progress(hypergraph.initialNumNodes(), 0, false),
     _is_timer_disabled(false),
@@ -141,6 +147,7 @@ class NLevelUncoarsener : public IUncoarsener<TypeTraits>,
   using Base::_fm;
   using Base::_flows;
   using Base::_rebalancer;
+  using Base::_refinement_controller;
   using Base::_timer;
 
   const TargetGraph* _target_graph;
@@ -157,6 +164,7 @@ class NLevelUncoarsener : public IUncoarsener<TypeTraits>,
   kahypar::ds::FastResetFlagArray<> _border_vertices_of_batch;
 
   NLevelStats _stats;
+  AdaptiveBatchSizeController _batch_size_controller;
   Metrics _current_metrics;
   utils::ProgressBar _progress;
   bool _is_timer_disabled;
@@ -96,7 +96,8 @@ class NLevelVertexPairRater {
     _local_large_rating_map([&] {
       return construct_large_tmp_rating_map();
     }),
-    _already_matched(num_hypernodes) { }
+    _already_matched(num_hypernodes),
+    _score_policy() { }
 
   NLevelVertexPairRater(const NLevelVertexPairRater&) = delete;
   NLevelVertexPairRater & operator= (const NLevelVertexPairRater &) = delete;
@@ -128,6 +129,14 @@ class NLevelVertexPairRater {
     _already_matched.set(original_id, true);
   }
 
+  // ! Precomputes the information required by the score policy
+  // ! for rating the vertices of the given hypergraph.
+  // ! Note, this function must be called before rating vertices of a new hypergraph.
+  template<typename Hypergraph>
+  void initializeScorePolicy(const Hypergraph& hypergraph) {
+    _score_policy.initialize(hypergraph, _context);
+  }
+
   // ! Note, this function is not thread safe
   void resetMatches() {
     _already_matched.reset();
@@ -194,7 +203,7 @@ class NLevelVertexPairRater {
     for ( const HyperedgeID& he : hypergraph.incidentEdges(u) ) {
       HypernodeID edge_size = hypergraph.edgeSize(he);
       if ( edge_size > 1 && edge_size < _context.partition.ignore_hyperedge_size_threshold ) {
-        const RatingType score = ScorePolicy::score(hypergraph.edgeWeight(he), edge_size);
+        const RatingType score = _score_policy.score(he, hypergraph.edgeWeight(he), edge_size);
         for ( const HypernodeID& v : hypergraph.pins(he) ) {
           tmp_ratings[v] += score;
         }
@@ -215,7 +224,7 @@ class NLevelVertexPairRater {
         if ( num_tmp_rating_map_accesses + edge_size > _vertex_degree_sampling_threshold  ) {
           break;
         }
-        const RatingType score = ScorePolicy::score(hypergraph.edgeWeight(he), edge_size);
+        const RatingType score = _score_policy.score(he, hypergraph.edgeWeight(he), edge_size);
         for ( const HypernodeID& v : hypergraph.pins(he) ) {
           tmp_ratings[v] += score;
           ++num_tmp_rating_map_accesses;
@@ -287,5 +296,8 @@ class NLevelVertexPairRater {
 
   // ! Marks all matched vertices
   kahypar::ds::FastResetFlagArray<> _already_matched;
+
+  // ! Computes the contribution of a hyperedge to the rating of its pins
+  ScorePolicy _score_policy;
 };
 }  // namespace mt_kahypar
@@ -26,33 +26,182 @@
 
 #pragma once
 
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "tbb/parallel_for.h"
+#include "tbb/parallel_reduce.h"
+
 #include "kahypar/meta/policy_registry.h"
 #include "kahypar/meta/typelist.h"
 
 #include "mt-kahypar/datastructures/hypergraph_common.h"
 #include "mt-kahypar/macros.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/utils/hash.h"
 
 namespace mt_kahypar {
+
+/*!
+ * A rating score policy computes the contribution of a hyperedge to the rating
+ * of all pins contained in it. Before each coarsening level, initialize(...) is called
+ * with the current hypergraph such that policies can precompute (and cache)
+ * level-specific information.
+ */
 class HeavyEdgeScore final : public kahypar::meta::PolicyBase {
  public:
-  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE static RatingType score(const HyperedgeWeight edge_weight,
-                                                             const HypernodeID edge_size) {
+  template<typename Hypergraph>
+  void initialize(const Hypergraph&, const Context&) { }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE RatingType score(const HyperedgeID,
+                                                      const HyperedgeWeight edge_weight,
+                                                      const HypernodeID edge_size) const {
     return static_cast<RatingType>(edge_weight) / (edge_size - 1);
   }
 };
 
 #ifdef KAHYPAR_ENABLE_EXPERIMENTAL_FEATURES
+/*!
+ * Heavy edge score weighted by the algebraic distance of a hyperedge.
+ * The algebraic distance of two vertices is computed by a few Jacobi over-relaxation
+ * sweeps on random initial vectors (see Chen and Safro, "Algebraic Distance on Graphs").
+ * Vertices that are strongly connected converge to similar values, while loosely connected
+ * vertices end up far apart. We use the hypergraph variant of Shaydulin et al. which
+ * alternates between hyperedge averages and vertex updates and defines the distance of a
+ * hyperedge as the maximum difference of the values of its pins. The heavy edge score of
+ * a hyperedge is then divided by its distance, which prefers contracting vertices connected
+ * via hyperedges whose pins are close to each other.
+ */
+class AlgebraicDistanceScore final : public kahypar::meta::PolicyBase {
+
+  static constexpr RatingType MIN_DISTANCE = 0.01;
+
+ public:
+  template<typename Hypergraph>
+  void initialize(const Hypergraph& hypergraph, const Context& context) {
+    const HypernodeID num_nodes = hypergraph.initialNumNodes();
+    const HyperedgeID num_edges = hypergraph.initialNumEdges();
+    const HypernodeID max_edge_size = context.partition.ignore_hyperedge_size_threshold;
+    const size_t num_vectors = context.coarsening.rating.algebraic_distance_num_vectors;
+    const size_t num_iterations = context.coarsening.rating.algebraic_distance_num_iterations;
+    const double omega = context.coarsening.rating.algebraic_distance_omega;
+    const uint32_t seed = static_cast<uint32_t>(context.partition.seed);
+
+    _current_values.resize(num_nodes);
+    _next_values.resize(num_nodes);
+    _edge_values.resize(num_edges);
+    _edge_distance.assign(num_edges, 0.0);
+    for ( size_t r = 0; r < num_vectors; ++r ) {
+      // Each test vector is initialized uniformly at random in [-0.5, 0.5]. We use hashing
+      // instead of a random number generator such that the result does not depend on the
+      // scheduling of the threads.
+      tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+        const uint32_t hash = hashing::integer::hash32(
+          hashing::integer::combine32(static_cast<uint32_t>(seed + r), hashing::integer::hash32(hn)));
+        _current_values[hn] = static_cast<double>(hash) /
+          static_cast<double>(std::numeric_limits<uint32_t>::max()) - 0.5;
+      });
+
+      for ( size_t i = 0; i < num_iterations; ++i ) {
+        // Value of a hyperedge is the average value of its pins
+        hypergraph.doParallelForAllEdges([&](const HyperedgeID he) {
+          const HypernodeID edge_size = hypergraph.edgeSize(he);
+          if ( edge_size > 1 && edge_size < max_edge_size ) {
+            double sum = 0.0;
+            for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+              sum += _current_values[pin];
+            }
+            _edge_values[he] = sum / edge_size;
+          }
+        });
+
+        // Jacobi over-relaxation step: Value of a vertex moves towards the
+        // weighted average of the values of its incident hyperedges
+        hypergraph.doParallelForAllNodes([&](const HypernodeID hn) {
+          double weighted_sum = 0.0;
+          double total_weight = 0.0;
+          for ( const HyperedgeID& he : hypergraph.incidentEdges(hn) ) {
+            const HypernodeID edge_size = hypergraph.edgeSize(he);
+            if ( edge_size > 1 && edge_size < max_edge_size ) {
+              const double weight = static_cast<double>(hypergraph.edgeWeight(he)) / (edge_size - 1);
+              weighted_sum += weight * _edge_values[he];
+              total_weight += weight;
+            }
+          }
+          _next_values[hn] = total_weight > 0.0 ?
+            ( 1.0 - omega ) * _current_values[hn] + omega * ( weighted_sum / total_weight ) :
+            _current_values[hn];
+        });
+        _current_values.swap(_next_values);
+      }
+
+      // Rescale values to [-0.5, 0.5] such that the distances of all test vectors are comparable
+      const auto min_max = tbb::parallel_reduce(
+        tbb::blocked_range<HypernodeID>(ID(0), num_nodes), std::make_pair(
+          std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest()),
+        [&](const tbb::blocked_range<HypernodeID>& range, std::pair<double, double> init) {
+          for ( HypernodeID hn = range.begin(); hn < range.end(); ++hn ) {
+            init.first = std::min(init.first, _current_values[hn]);
+            init.second = std::max(init.second, _current_values[hn]);
+          }
+          return init;
+        }, [](const std::pair<double, double>& lhs, const std::pair<double, double>& rhs) {
+          return std::make_pair(std::min(lhs.first, rhs.first), std::max(lhs.second, rhs.second));
+        });
+      const double range = min_max.second - min_max.first;
+
+      // Algebraic distance of a hyperedge is the maximum difference
+      // between the values of its pins over all test vectors
+      hypergraph.doParallelForAllEdges([&](const HyperedgeID he) {
+        const HypernodeID edge_size = hypergraph.edgeSize(he);
+        if ( edge_size > 1 && edge_size < max_edge_size && range > 0.0 ) {
+          double min_value = std::numeric_limits<double>::max();
+          double max_value = std::numeric_limits<double>::lowest();
+          for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+            min_value = std::min(min_value, _current_values[pin]);
+            max_value = std::max(max_value, _current_values[pin]);
+          }
+          _edge_distance[he] = std::max(_edge_distance[he], ( max_value - min_value ) / range);
+        }
+      });
+    }
+  }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE RatingType score(const HyperedgeID he,
+                                                      const HyperedgeWeight edge_weight,
+                                                      const HypernodeID edge_size) const {
+    ASSERT(he < _edge_distance.size());
+    return static_cast<RatingType>(edge_weight) /
+      ( ( edge_size - 1 ) * ( MIN_DISTANCE + _edge_distance[he] ) );
+  }
+
+ private:
+  vec<double> _current_values;
+  vec<double> _next_values;
+  vec<double> _edge_values;
+  vec<RatingType> _edge_distance;
+};
+
 class SamenessScore final : public kahypar::meta::PolicyBase {
  public:
-  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE static RatingType score(const HyperedgeWeight edge_weight,
-                                                             const HypernodeID) {
+  template<typename Hypergraph>
+  void initialize(const Hypergraph&, const Context&) { }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE RatingType score(const HyperedgeID,
+                                                      const HyperedgeWeight edge_weight,
+                                                      const HypernodeID) const {
     return static_cast<RatingType>(edge_weight);
   }
 };
 
-using RatingScorePolicies = kahypar::meta::Typelist<HeavyEdgeScore, SamenessScore>;
+using RatingScorePolicies = kahypar::meta::Typelist<HeavyEdgeScore, AlgebraicDistanceScore, SamenessScore>;
+// ! The algebraic distances are computed once per clustering pass. The n-level
+// ! coarsener contracts vertices while rating, which would use stale distances.
+using NLevelRatingScorePolicies = kahypar::meta::Typelist<HeavyEdgeScore, SamenessScore>;
 #else
 using RatingScorePolicies = kahypar::meta::Typelist<HeavyEdgeScore>;
+using NLevelRatingScorePolicies = RatingScorePolicies;
 #endif
 
 }  // namespace mt_kahypar
@@ -32,6 +32,7 @@
 
 #include "mt-kahypar/partition/context.h"
 #include "mt-kahypar/partition/refinement/i_refiner.h"
+#include "mt-kahypar/partition/refinement/adaptive_refinement_controller.h"
 #include "mt-kahypar/partition/coarsening/coarsening_commons.h"
 #include "mt-kahypar/partition/refinement/flows/scheduler.h"
 #include "mt-kahypar/partition/refinement/gains/gain_cache_ptr.h"
@@ -63,7 +64,8 @@ class UncoarsenerBase {
           _label_propagation(nullptr),
           _fm(nullptr),
           _flows(nullptr),
-          _rebalancer(nullptr) {}
+          _rebalancer(nullptr),
+          _refinement_controller(context) {}
 
   UncoarsenerBase(const UncoarsenerBase&) = delete;
   UncoarsenerBase(UncoarsenerBase&&) = delete;
@@ -84,6 +86,7 @@ class UncoarsenerBase {
   std::unique_ptr<IRefiner> _fm;
   std::unique_ptr<IRefiner> _flows;
   std::unique_ptr<IRefiner> _rebalancer;
+  AdaptiveRefinementController _refinement_controller;
 
  protected:
 
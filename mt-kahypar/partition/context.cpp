@@ -54,6 +54,10 @@ namespace mt_kahypar {
     str << "  Number of V-Cycles:                 " << params.num_vcycles << std::endl;
     str << "  Ignore HE Size Threshold:           " << params.ignore_hyperedge_size_threshold << std::endl;
     str << "  Large HE Size Threshold:            " << params.large_hyperedge_size_threshold << std::endl;
+    if ( params.memory_budget > 0 ) {
+      str << "  Memory Budget:                      " << params.memory_budget << " MB" << std::endl;
+      str << "  Predicted Peak Memory:              " << params.predicted_peak_memory / ( 1024 * 1024 ) << " MB" << std::endl;
+    }
     if ( params.use_individual_part_weights ) {
       str << "  Individual Part Weights:            ";
       for ( const HypernodeWeight& w : params.max_part_weights ) {
@@ -93,6 +97,13 @@ namespace mt_kahypar {
     str << "    Rating Function:                  " << params.rating_function << std::endl;
     str << "    Heavy Node Penalty:               " << params.heavy_node_penalty_policy << std::endl;
     str << "    Acceptance Policy:                " << params.acceptance_policy << std::endl;
+    #ifdef KAHYPAR_ENABLE_EXPERIMENTAL_FEATURES
+    if ( params.rating_function == RatingFunction::algebraic_distance ) {
+      str << "    Algebraic Distance Vectors:       " << params.algebraic_distance_num_vectors << std::endl;
+      str << "    Algebraic Distance Iterations:    " << params.algebraic_distance_num_iterations << std::endl;
+      str << "    Algebraic Distance Omega:         " << params.algebraic_distance_omega << std::endl;
+    }
+    #endif
     return str;
   }
 
@@ -109,6 +120,7 @@ namespace mt_kahypar {
     str << "  Maximum Shrink Factor:              " << params.maximum_shrink_factor << std::endl;
     str << "  Vertex Degree Sampling Threshold:   " << params.vertex_degree_sampling_threshold << std::endl;
     str << "  Number of subrounds (deterministic):" << params.num_sub_rounds_deterministic << std::endl;
+    str << "  N-Level Round Size:                 " << params.nlevel_round_size << std::endl;
     str << std::endl << params.rating;
     return str;
   }
@@ -134,6 +146,7 @@ namespace mt_kahypar {
       out << "    Rollback Bal. Violation Factor:   " << params.rollback_balance_violation_factor << std::endl;
       out << "    Num Seed Nodes:                   " << params.num_seed_nodes << std::endl;
       out << "    Enable Random Shuffle:            " << std::boolalpha << params.shuffle << std::endl;
+      out << "    Locality-Aware Seeds:             " << std::boolalpha << params.locality_aware_seeds << std::endl;
       out << "    Obey Minimal Parallelism:         " << std::boolalpha << params.obey_minimal_parallelism << std::endl;
       out << "    Minimum Improvement Factor:       " << params.min_improvement << std::endl;
       out << "    Release Nodes:                    " << std::boolalpha << params.release_nodes << std::endl;
@@ -169,12 +182,35 @@ namespace mt_kahypar {
       out << "    Skip Small Cuts:                  " << std::boolalpha << params.skip_small_cuts << std::endl;
       out << "    Skip Unpromising Blocks:          " << std::boolalpha << params.skip_unpromising_blocks << std::endl;
       out << "    Pierce in Bulk:                   " << std::boolalpha << params.pierce_in_bulk << std::endl;
+      out << "    Use Graph Flow Cutter:            " << std::boolalpha << params.use_graph_flow_cutter << std::endl;
       out << "    Steiner Tree Policy:              " << params.steiner_tree_policy << std::endl;
       out << std::flush;
     }
     return out;
   }
 
+  std::ostream& operator<<(std::ostream& out, const AdaptiveRefinementParameters& params) {
+    out << "  Adaptive Refinement Parameters: \n";
+    out << "    Enabled:                          " << std::boolalpha << params.enabled << std::endl;
+    if ( params.enabled ) {
+      out << "    Min Relative Efficiency:          " << params.min_relative_efficiency << std::endl;
+      out << "    Probe Interval:                   " << params.probe_interval << std::endl;
+    }
+    out << std::flush;
+    return out;
+  }
+
+  std::ostream& operator<<(std::ostream& out, const AdaptiveBatchSizeParameters& params) {
+    out << "  Adaptive Batch Size Parameters: \n";
+    out << "    Enabled:                          " << std::boolalpha << params.enabled << std::endl;
+    if ( params.enabled ) {
+      out << "    Scaling Factor:                   " << params.scaling_factor << std::endl;
+      out << "    Max Multiplier:                   " << params.max_multiplier << std::endl;
+    }
+    out << std::flush;
+    return out;
+  }
+
   std::ostream& operator<<(std::ostream& out, const DeterministicRefinementParameters& params) {
     out << "    Number of sub-rounds for Sync LP:  " << params.num_sub_rounds_sync_lp << std::endl;
     out << "    Use active node set:               " << std::boolalpha << params.use_active_node_set << std::endl;
@@ -196,6 +232,8 @@ namespace mt_kahypar {
       str << "\n" << params.global_fm;
     }
     str << "\n" << params.flows;
+    str << "\n" << params.adaptive;
+    str << "\n" << params.adaptive_batch_size;
     return str;
   }
 
@@ -207,6 +245,7 @@ namespace mt_kahypar {
     if ( params.use_adaptive_ip_runs ) {
       str << "  Min Adaptive IP Runs:               " << params.min_adaptive_ip_runs << std::endl;
     }
+    str << "  Use Portfolio Racing:               " << std::boolalpha << params.use_portfolio_racing << std::endl;
     str << "  Perform Refinement On Best:         " << std::boolalpha << params.perform_refinement_on_best_partitions << std::endl;
     str << "  Fm Refinement Rounds:               " << params.fm_refinment_rounds << std::endl;
     str << "  Remove Degree-Zero HNs Before IP:   " << std::boolalpha << params.remove_degree_zero_hns_before_ip << std::endl;
@@ -220,20 +259,44 @@ namespace mt_kahypar {
   std::ostream & operator<< (std::ostream& str, const MappingParameters& params) {
     str << "Mapping Parameters:                   " << std::endl;
     str << "  Target Graph File:                  " << params.target_graph_file << std::endl;
+    if ( params.target_hierarchy != "" ) {
+      str << "  Target Hierarchy:                   " << params.target_hierarchy << std::endl;
+      str << "  Target Hierarchy Costs:             " << params.target_hierarchy_costs << std::endl;
+    }
+    if ( params.target_torus != "" ) {
+      str << "  Target Torus:                       " << params.target_torus << std::endl;
+      str << "  Target Torus Costs:                 " << params.target_torus_costs << std::endl;
+    }
     str << "  One-To-One Mapping Strategy:        " << params.strategy << std::endl;
     str << "  Use Local Search:                   " << std::boolalpha << params.use_local_search << std::endl;
     str << "  Use Two-Phase Approach:             " << std::boolalpha << params.use_two_phase_approach << std::endl;
     str << "  Max Precomputed Steiner Tree Size:  " << params.max_steiner_tree_size << std::endl;
+    str << "  Steiner Tree Cache Capacity:        " << params.steiner_tree_cache_capacity << std::endl;
+    str << "  Track Steiner Tree Cache Stats:     " << std::boolalpha << params.track_steiner_tree_cache_stats << std::endl;
     str << "  Large HE Size Threshold:            " << params.large_he_threshold << std::endl;
     return str;
   }
 
+  std::ostream & operator<< (std::ostream& str, const EvolutionaryParameters& params) {
+    str << "Evolutionary Parameters:              " << std::endl;
+    str << "  Population Size:                    " << params.population_size << std::endl;
+    str << "  Number of Generations:              " << params.num_generations << std::endl;
+    str << "  Mutation Chance:                    " << params.mutation_chance << std::endl;
+    str << "  Population Amount of Time:          " << params.dynamic_population_amount_of_time << std::endl;
+    return str;
+  }
+
   std::ostream & operator<< (std::ostream& str, const SharedMemoryParameters& params) {
     str << "Shared Memory Parameters:             " << std::endl;
     str << "  Number of Threads:                  " << params.num_threads << std::endl;
     str << "  Number of used NUMA nodes:          " << TBBInitializer::instance().num_used_numa_nodes() << std::endl;
     str << "  Use Localized Random Shuffle:       " << std::boolalpha << params.use_localized_random_shuffle << std::endl;
     str << "  Random Shuffle Block Size:          " << params.shuffle_block_size << std::endl;
+    str << "  Sequential Pin Threshold:           " << params.sequential_pin_threshold << std::endl;
+    str << "  Huge Pages:                         " << params.huge_pages << std::endl;
+    if ( params.huge_pages != HugePageMode::disabled ) {
+      str << "  Huge Page Cache Size:               " << params.huge_page_cache_size << " MB" << std::endl;
+    }
     return str;
   }
 
@@ -242,6 +305,10 @@ namespace mt_kahypar {
       partition.partition_type == N_LEVEL_HYPERGRAPH_PARTITIONING;
   }
 
+  bool Context::isEvolutionaryPartitioning() const {
+    return partition.mode == Mode::direct && evolutionary.population_size > 1;
+  }
+
   bool Context::forceGainCacheUpdates() const {
     return isNLevelPartitioning() ||
       partition.mode == Mode::deep_multilevel ||
@@ -336,6 +403,17 @@ namespace mt_kahypar {
                     CoarseningAlgorithm::multilevel_coarsener);
     }
 
+    #ifdef KAHYPAR_ENABLE_EXPERIMENTAL_FEATURES
+    if ( isNLevelPartitioning() && coarsening.rating.rating_function == RatingFunction::algebraic_distance ) {
+        ALGO_SWITCH("Rating function" << coarsening.rating.rating_function << "is only supported in multilevel mode."
+                                      << "Do you want to use the heavy edge rating function instead (Y/N)?",
+                    "Rating function" << coarsening.rating.rating_function
+                                      << "in n-level mode is not supported!",
+                    coarsening.rating.rating_function,
+                    RatingFunction::heavy_edge);
+    }
+    #endif
+
     ASSERT(partition.use_individual_part_weights != partition.max_part_weights.empty());
     if (partition.use_individual_part_weights && static_cast<size_t>(partition.k) != partition.max_part_weights.size()) {
       ALGO_SWITCH("Individual part weights specified, but number of parts doesn't match k."
@@ -379,7 +457,10 @@ namespace mt_kahypar {
 
       // disable adaptive IP
       initial_partitioning.use_adaptive_ip_runs = false;
+      initial_partitioning.use_portfolio_racing = false;
 
+      // disable evolutionary mode (offspring are computed concurrently)
+      evolutionary.population_size = 0;
 
       // switch silently
       auto lp_algo = refinement.label_propagation.algorithm;
@@ -462,6 +543,7 @@ namespace mt_kahypar {
     // shared_memory
     shared_memory.use_localized_random_shuffle = false;
     shared_memory.static_balancing_work_packages = 128;
+    shared_memory.sequential_pin_threshold = 0;
 
     // mapping
     mapping.strategy = OneToOneMappingStrategy::greedy_mapping;
@@ -594,6 +676,7 @@ namespace mt_kahypar {
     // shared_memory
     shared_memory.use_localized_random_shuffle = false;
     shared_memory.static_balancing_work_packages = 128;
+    shared_memory.sequential_pin_threshold = 0;
 
     // preprocessing
     preprocessing.use_community_detection = true;
@@ -681,6 +764,7 @@ namespace mt_kahypar {
     // shared_memory
     shared_memory.use_localized_random_shuffle = false;
     shared_memory.static_balancing_work_packages = 128;
+    shared_memory.sequential_pin_threshold = 0;
 
     // mapping
     mapping.strategy = OneToOneMappingStrategy::greedy_mapping;
@@ -830,6 +914,7 @@ namespace mt_kahypar {
     // shared_memory
     shared_memory.use_localized_random_shuffle = false;
     shared_memory.static_balancing_work_packages = 128;
+    shared_memory.sequential_pin_threshold = 0;
 
     // preprocessing
     preprocessing.use_community_detection = true;
@@ -916,6 +1001,10 @@ namespace mt_kahypar {
       str << context.mapping
           << "-------------------------------------------------------------------------------\n";
     }
+    if ( context.isEvolutionaryPartitioning() ) {
+      str << context.evolutionary
+          << "-------------------------------------------------------------------------------\n";
+    }
     str << context.shared_memory
         << "-------------------------------------------------------------------------------";
     return str;
@@ -51,6 +51,9 @@ struct PartitioningParameters {
   bool perform_parallel_recursion_in_deep_multilevel = true;
 
   int time_limit = 0;
+  // ! Memory budget in megabytes (0 = unlimited)
+  size_t memory_budget = 0;
+  size_t predicted_peak_memory = 0;
   bool use_individual_part_weights = false;
   std::vector<HypernodeWeight> perfect_balance_part_weights;
   std::vector<HypernodeWeight> max_part_weights;
@@ -105,6 +108,10 @@ struct RatingParameters {
   RatingFunction rating_function = RatingFunction::UNDEFINED;
   HeavyNodePenaltyPolicy heavy_node_penalty_policy = HeavyNodePenaltyPolicy::UNDEFINED;
   AcceptancePolicy acceptance_policy = AcceptancePolicy::UNDEFINED;
+  // Parameters of the algebraic distance rating function
+  size_t algebraic_distance_num_vectors = 5;
+  size_t algebraic_distance_num_iterations = 20;
+  double algebraic_distance_omega = 0.5;
 };
 
 std::ostream & operator<< (std::ostream& str, const RatingParameters& params);
@@ -120,6 +127,7 @@ struct CoarseningParameters {
   double maximum_shrink_factor = std::numeric_limits<double>::max();
   size_t vertex_degree_sampling_threshold = std::numeric_limits<size_t>::max();
   size_t num_sub_rounds_deterministic = 16;
+  size_t nlevel_round_size = 0;
 
   // Those will be determined dynamically
   HypernodeWeight max_allowed_node_weight = 0;
@@ -153,6 +161,7 @@ struct FMParameters {
   bool rollback_parallel = true;
   bool iter_moves_on_recalc = false;
   bool shuffle = true;
+  bool locality_aware_seeds = false;
   mutable bool obey_minimal_parallelism = false;
   bool release_nodes = true;
 };
@@ -182,6 +191,7 @@ struct FlowParameters {
   bool skip_small_cuts = false;
   bool skip_unpromising_blocks = false;
   bool pierce_in_bulk = false;
+  bool use_graph_flow_cutter = false;
   SteinerTreeFlowValuePolicy steiner_tree_policy = SteinerTreeFlowValuePolicy::UNDEFINED;
 };
 
@@ -195,12 +205,30 @@ struct DeterministicRefinementParameters {
 
 std::ostream& operator<<(std::ostream& out, const DeterministicRefinementParameters& params);
 
+struct AdaptiveRefinementParameters {
+  bool enabled = false;
+  double min_relative_efficiency = 0.1;
+  size_t probe_interval = 4;
+};
+
+std::ostream& operator<<(std::ostream& out, const AdaptiveRefinementParameters& params);
+
+struct AdaptiveBatchSizeParameters {
+  bool enabled = false;
+  double scaling_factor = 2.0;
+  size_t max_multiplier = 16;
+};
+
+std::ostream& operator<<(std::ostream& out, const AdaptiveBatchSizeParameters& params);
+
 struct RefinementParameters {
   LabelPropagationParameters label_propagation;
   FMParameters fm;
   DeterministicRefinementParameters deterministic_refinement;
   NLevelGlobalFMParameters global_fm;
   FlowParameters flows;
+  AdaptiveRefinementParameters adaptive;
+  AdaptiveBatchSizeParameters adaptive_batch_size;
   RebalancingAlgorithm rebalancer = RebalancingAlgorithm::do_nothing;
   bool refine_until_no_improvement = false;
   double relative_improvement_threshold = 0.0;
@@ -221,6 +249,7 @@ struct InitialPartitioningParameters {
   size_t runs = 1;
   bool use_adaptive_ip_runs = false;
   size_t min_adaptive_ip_runs = std::numeric_limits<size_t>::max();
+  bool use_portfolio_racing = false;
   bool perform_refinement_on_best_partitions = false;
   size_t fm_refinment_rounds = 1;
   bool remove_degree_zero_hns_before_ip = false;
@@ -233,10 +262,16 @@ std::ostream & operator<< (std::ostream& str, const InitialPartitioningParameter
 
 struct MappingParameters {
   std::string target_graph_file = "";
+  std::string target_hierarchy = "";
+  std::string target_hierarchy_costs = "";
+  std::string target_torus = "";
+  std::string target_torus_costs = "";
   OneToOneMappingStrategy strategy = OneToOneMappingStrategy::identity;
   bool use_local_search = false;
   bool use_two_phase_approach = false;
   size_t max_steiner_tree_size = 0;
+  size_t steiner_tree_cache_capacity = 1000000;
+  bool track_steiner_tree_cache_stats = false;
   double largest_he_fraction = 0.0;
   double min_pin_coverage_of_largest_hes = 1.0;
   HypernodeID large_he_threshold = std::numeric_limits<HypernodeID>::max();
@@ -244,6 +279,16 @@ struct MappingParameters {
 
 std::ostream & operator<< (std::ostream& str, const MappingParameters& params);
 
+struct EvolutionaryParameters {
+  size_t population_size = 0;
+  size_t num_generations = std::numeric_limits<size_t>::max();
+  double mutation_chance = 0.5;
+  // ! Fraction of the time limit that can be spent on computing the initial population
+  double dynamic_population_amount_of_time = 0.15;
+};
+
+std::ostream & operator<< (std::ostream& str, const EvolutionaryParameters& params);
+
 struct SharedMemoryParameters {
   size_t original_num_threads = 1;
   size_t num_threads = 1;
@@ -251,6 +296,14 @@ struct SharedMemoryParameters {
   bool use_localized_random_shuffle = false;
   size_t shuffle_block_size = 2;
   double degree_of_parallelism = 1.0;
+  HugePageMode huge_pages = HugePageMode::disabled;
+  // ! Maximum size in megabytes of freed huge page allocations kept for reuse
+  size_t huge_page_cache_size = 2048;
+  // ! Inputs with fewer pins are partitioned on a single thread
+  size_t sequential_pin_threshold = 0;
+  // ! If false, partitioning does not (de)activate unused allocations of the
+  // ! process-wide memory pool (e.g., for calls within a session)
+  bool manage_memory_pool = true;
 };
 
 std::ostream & operator<< (std::ostream& str, const SharedMemoryParameters& params);
@@ -263,6 +316,7 @@ class Context {
   InitialPartitioningParameters initial_partitioning { };
   RefinementParameters refinement { };
   MappingParameters mapping { };
+  EvolutionaryParameters evolutionary { };
   SharedMemoryParameters shared_memory { };
   ContextType type = ContextType::main;
 
@@ -278,6 +332,8 @@ class Context {
 
   bool isNLevelPartitioning() const;
 
+  bool isEvolutionaryPartitioning() const;
+
   bool forceGainCacheUpdates() const;
 
   void setupPartWeights(const HypernodeWeight total_hypergraph_weight);
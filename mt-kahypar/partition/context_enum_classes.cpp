@@ -191,6 +191,7 @@ namespace mt_kahypar {
   std::ostream & operator<< (std::ostream& os, const RatingFunction& func) {
     switch (func) {
       case RatingFunction::heavy_edge: return os << "heavy_edge";
+      ENABLE_EXPERIMENTAL_FEATURES(case RatingFunction::algebraic_distance: return os << "algebraic_distance";)
       ENABLE_EXPERIMENTAL_FEATURES(case RatingFunction::sameness: return os << "sameness";)
       case RatingFunction::UNDEFINED: return os << "UNDEFINED";
         // omit default case to trigger compiler warning for missing cases
@@ -257,6 +258,7 @@ namespace mt_kahypar {
   std::ostream & operator<< (std::ostream& os, const OneToOneMappingStrategy& algo) {
       switch (algo) {
         case OneToOneMappingStrategy::greedy_mapping: return os << "greedy_mapping";
+        case OneToOneMappingStrategy::parallel_local_search: return os << "parallel_local_search";
         case OneToOneMappingStrategy::identity: return os << "identity";
           // omit default case to trigger compiler warning for missing cases
       }
@@ -273,6 +275,17 @@ namespace mt_kahypar {
       return os << static_cast<uint8_t>(policy);
   }
 
+  std::ostream & operator<< (std::ostream& os, const HugePageMode& mode) {
+    switch (mode) {
+      case HugePageMode::disabled: return os << "disabled";
+      case HugePageMode::transparent: return os << "transparent";
+      case HugePageMode::explicit_2mb: return os << "explicit_2mb";
+      case HugePageMode::explicit_1gb: return os << "explicit_1gb";
+        // omit default case to trigger compiler warning for missing cases
+    }
+    return os << static_cast<uint8_t>(mode);
+  }
+
   Mode modeFromString(const std::string& mode) {
     if (mode == "rb") {
       return Mode::recursive_bipartitioning;
@@ -397,7 +410,9 @@ namespace mt_kahypar {
       return RatingFunction::heavy_edge;
     }
     #ifdef KAHYPAR_ENABLE_EXPERIMENTAL_FEATURES
-    else  if (function == "sameness") {
+    else if (function == "algebraic_distance") {
+      return RatingFunction::algebraic_distance;
+    } else  if (function == "sameness") {
       return RatingFunction::sameness;
     }
     #endif
@@ -474,6 +489,8 @@ namespace mt_kahypar {
   OneToOneMappingStrategy oneToOneMappingStrategyFromString(const std::string& type) {
     if (type == "greedy_mapping") {
       return OneToOneMappingStrategy::greedy_mapping;
+    } else if (type == "parallel_local_search") {
+      return OneToOneMappingStrategy::parallel_local_search;
     } else if (type == "identity") {
       return OneToOneMappingStrategy::identity;
     }
@@ -490,4 +507,18 @@ namespace mt_kahypar {
     ERR("Illegal option: " + policy);
     return SteinerTreeFlowValuePolicy::UNDEFINED;
   }
+
+  HugePageMode hugePageModeFromString(const std::string& mode) {
+    if (mode == "disabled") {
+      return HugePageMode::disabled;
+    } else if (mode == "transparent") {
+      return HugePageMode::transparent;
+    } else if (mode == "explicit_2mb") {
+      return HugePageMode::explicit_2mb;
+    } else if (mode == "explicit_1gb") {
+      return HugePageMode::explicit_1gb;
+    }
+    ERR("Illegal option: " + mode);
+    return HugePageMode::disabled;
+  }
 }
\ No newline at end of file
@@ -35,6 +35,18 @@
 
 namespace mt_kahypar {
 
+enum class HugePageMode : uint8_t {
+  // ! All allocations are served by the scalable allocator
+  disabled,
+  // ! Large allocations are aligned to 2 MB and marked with madvise(MADV_HUGEPAGE)
+  transparent,
+  // ! Large allocations are placed on reserved 2 MB pages (MAP_HUGETLB)
+  explicit_2mb,
+  // ! Allocations of at least 1 GB are placed on reserved 1 GB pages and
+  // ! smaller ones on reserved 2 MB pages (MAP_HUGETLB)
+  explicit_1gb
+};
+
 enum class Type : int8_t {
   Unweighted = 0,
   EdgeWeights = 1,
@@ -116,6 +128,7 @@ enum class CoarseningAlgorithm : uint8_t {
 
 enum class RatingFunction : uint8_t {
   heavy_edge,
+  ENABLE_EXPERIMENTAL_FEATURES(algebraic_distance COMMA)
   ENABLE_EXPERIMENTAL_FEATURES(sameness COMMA)
   UNDEFINED
 };
@@ -170,6 +183,7 @@ enum class RebalancingAlgorithm : uint8_t {
 
 enum class OneToOneMappingStrategy : uint8_t {
   greedy_mapping,
+  parallel_local_search,
   identity
 };
 
@@ -223,6 +237,8 @@ std::ostream & operator<< (std::ostream& os, const OneToOneMappingStrategy& algo
 
 std::ostream & operator<< (std::ostream& os, const SteinerTreeFlowValuePolicy& policy);
 
+std::ostream & operator<< (std::ostream& os, const HugePageMode& mode);
+
 Mode modeFromString(const std::string& mode);
 
 InstanceType instanceTypeFromString(const std::string& type);
@@ -257,4 +273,6 @@ OneToOneMappingStrategy oneToOneMappingStrategyFromString(const std::string& typ
 
 SteinerTreeFlowValuePolicy steinerTreeFlowValuePolicyFromString(const std::string& policy);
 
+HugePageMode hugePageModeFromString(const std::string& mode);
+
 }  // namesapce mt_kahypar
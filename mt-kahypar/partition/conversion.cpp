@@ -113,4 +113,18 @@ InstanceType to_instance_type(const FileFormat format) {
   return InstanceType::UNDEFINED;
 }
 
+InstanceType to_instance_type(const mt_kahypar_hypergraph_type_t type) {
+  switch ( type ) {
+    case STATIC_GRAPH:
+    case DYNAMIC_GRAPH:
+      return InstanceType::graph;
+    case STATIC_HYPERGRAPH:
+    case DYNAMIC_HYPERGRAPH:
+      return InstanceType::hypergraph;
+    case NULLPTR_HYPERGRAPH:
+      return InstanceType::UNDEFINED;
+  }
+  return InstanceType::UNDEFINED;
+}
+
 }  // namespace mt_kahypar
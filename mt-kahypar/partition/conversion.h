@@ -46,4 +46,6 @@ PresetType to_preset_type(const Mode mode,
 
 InstanceType to_instance_type(const FileFormat format);
 
+InstanceType to_instance_type(const mt_kahypar_hypergraph_type_t type);
+
 }  // namespace mt_kahypar
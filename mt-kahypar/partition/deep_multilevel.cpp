@@ -263,7 +263,9 @@ bool disableTimerAndStats(const Context& context) {
     utils::Utilities::instance().getTimer(context.utility_id).isEnabled();
   if ( context.type == ContextType::main ) {
     utils::Utilities& utils = utils::Utilities::instance();
-    parallel::MemoryPool::instance().deactivate_unused_memory_allocations();
+    if ( context.shared_memory.manage_memory_pool ) {
+      parallel::MemoryPool::instance().deactivate_unused_memory_allocations();
+    }
     utils.getTimer(context.utility_id).disable();
     utils.getStats(context.utility_id).disable();
   }
@@ -273,7 +275,9 @@ bool disableTimerAndStats(const Context& context) {
 void enableTimerAndStats(const Context& context, const bool was_enabled_before) {
   if ( context.type == ContextType::main && was_enabled_before ) {
     utils::Utilities& utils = utils::Utilities::instance();
-    parallel::MemoryPool::instance().activate_unused_memory_allocations();
+    if ( context.shared_memory.manage_memory_pool ) {
+      parallel::MemoryPool::instance().activate_unused_memory_allocations();
+    }
     utils.getTimer(context.utility_id).enable();
     utils.getStats(context.utility_id).enable();
   }
@@ -0,0 +1,320 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/partition/evolutionary.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <random>
+
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/parallel/memory_pool.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/multilevel.h"
+#include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/utilities.h"
+#include "mt-kahypar/utils/timer.h"
+
+namespace mt_kahypar {
+
+namespace evolutionary {
+
+bool isBetter(const Individual& lhs, const Individual& rhs) {
+  if ( lhs.is_balanced != rhs.is_balanced ) {
+    return lhs.is_balanced;
+  } else if ( lhs.is_balanced ) {
+    return lhs.objective < rhs.objective ||
+      ( lhs.objective == rhs.objective && lhs.imbalance < rhs.imbalance );
+  } else {
+    return lhs.imbalance < rhs.imbalance ||
+      ( lhs.imbalance == rhs.imbalance && lhs.objective < rhs.objective );
+  }
+}
+
+} // namespace evolutionary
+
+namespace {
+
+using evolutionary::Individual;
+using evolutionary::isBetter;
+
+template<typename PartitionedHypergraph>
+Individual createIndividual(const PartitionedHypergraph& partitioned_hg,
+                            const Context& context) {
+  Individual individual;
+  individual.partition.assign(partitioned_hg.initialNumNodes(), kInvalidPartition);
+  partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+    individual.partition[hn] = partitioned_hg.partID(hn);
+  });
+  individual.objective = metrics::quality(partitioned_hg, context);
+  individual.imbalance = metrics::imbalance(partitioned_hg, context);
+  individual.is_balanced = metrics::isBalanced(partitioned_hg, context);
+  return individual;
+}
+
+struct Offspring {
+  size_t parent_1 = std::numeric_limits<size_t>::max();
+  size_t parent_2 = std::numeric_limits<size_t>::max();
+  Individual individual;
+
+  bool isCombine() const {
+    return parent_2 != std::numeric_limits<size_t>::max();
+  }
+};
+
+size_t tournamentSelection(const vec<Individual>& population,
+                           std::mt19937& prng,
+                           const size_t excluded = std::numeric_limits<size_t>::max()) {
+  ASSERT(population.size() > 1);
+  std::uniform_int_distribution<size_t> dist(0, population.size() - 1);
+  auto draw = [&] {
+    size_t idx = dist(prng);
+    while ( idx == excluded ) {
+      idx = dist(prng);
+    }
+    return idx;
+  };
+  const size_t lhs = draw();
+  const size_t rhs = draw();
+  return isBetter(population[rhs], population[lhs]) ? rhs : lhs;
+}
+
+size_t worstIndividual(const vec<Individual>& population) {
+  size_t worst = 0;
+  for ( size_t i = 1; i < population.size(); ++i ) {
+    if ( isBetter(population[worst], population[i]) ) {
+      worst = i;
+    }
+  }
+  return worst;
+}
+
+size_t bestIndividual(const vec<Individual>& population) {
+  size_t best = 0;
+  for ( size_t i = 1; i < population.size(); ++i ) {
+    if ( isBetter(population[i], population[best]) ) {
+      best = i;
+    }
+  }
+  return best;
+}
+
+// ! Returns true, if the given fraction of the time limit has elapsed since start
+bool timeLimitReached(const Context& context,
+                      const HighResClockTimepoint& start,
+                      const double fraction = 1.0) {
+  if ( context.partition.time_limit > 0 ) {
+    const double elapsed_time = std::chrono::duration<double>(
+      std::chrono::high_resolution_clock::now() - start).count();
+    return elapsed_time >= fraction * context.partition.time_limit;
+  }
+  return false;
+}
+
+} // namespace
+
+template<typename TypeTraits>
+typename Evolutionary<TypeTraits>::PartitionedHypergraph Evolutionary<TypeTraits>::partition(
+  Hypergraph& hypergraph, const Context& context, const TargetGraph* target_graph) {
+  ASSERT(context.isEvolutionaryPartitioning());
+  const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+
+  // The first individual is computed with the full multilevel algorithm
+  // (including V-cycles) on the input hypergraph
+  PartitionedHypergraph partitioned_hg =
+    Multilevel<TypeTraits>::partition(hypergraph, context, target_graph);
+
+  utils::Utilities& utils = utils::Utilities::instance();
+  utils::Timer& timer = utils.getTimer(context.utility_id);
+  timer.start_timer("evolutionary", "Evolutionary Algorithm");
+  const bool was_enabled_before = timer.isEnabled();
+  if ( context.type == ContextType::main ) {
+    if ( context.shared_memory.manage_memory_pool ) {
+      parallel::MemoryPool::instance().deactivate_unused_memory_allocations();
+    }
+    timer.disable();
+    utils.getStats(context.utility_id).disable();
+  }
+
+  // All other individuals are computed concurrently. Thus, we use
+  // a non-main context which disables timings, statistics and the
+  // top-level rebalancing step.
+  Context e_context(context);
+  e_context.type = ContextType::initial_partitioning;
+  e_context.partition.verbose_output = false;
+  e_context.partition.enable_progress_bar = false;
+  e_context.partition.num_vcycles = 0;
+
+  const size_t population_size = context.evolutionary.population_size;
+  const PartitionID k = context.partition.k;
+  const bool is_combine_possible =
+    k <= std::numeric_limits<PartitionID>::max() / k;
+  HypergraphPool hypergraph_pool(hypergraph);
+  vec<Individual> population(population_size);
+  population[0] = createIndividual(partitioned_hg, context);
+  Individual first_individual;
+  first_individual.objective = population[0].objective;
+  first_individual.imbalance = population[0].imbalance;
+  first_individual.is_balanced = population[0].is_balanced;
+
+  // ################## INITIAL POPULATION ##################
+  createInitialPopulation(hypergraph_pool, e_context, target_graph, start, population);
+
+  // ################## GENERATIONS ##################
+  // Operations and parents are drawn sequentially at the beginning of each
+  // generation and the offspring replace individuals after all offspring
+  // of the generation are computed. Thus, the population is not modified
+  // while offspring are computed.
+  const size_t num_offspring = std::min(population.size(),
+    std::max(UL(1), context.shared_memory.num_threads));
+  std::mt19937 prng(context.partition.seed);
+  std::uniform_real_distribution<double> mutation_dist(0.0, 1.0);
+  vec<Offspring> offspring(num_offspring);
+  for ( size_t generation = 0; population.size() > 1 &&
+        generation < context.evolutionary.num_generations &&
+        !timeLimitReached(context, start); ++generation ) {
+    for ( Offspring& child : offspring ) {
+      child = Offspring();
+      child.parent_1 = tournamentSelection(population, prng);
+      if ( is_combine_possible &&
+           mutation_dist(prng) >= context.evolutionary.mutation_chance ) {
+        child.parent_2 = tournamentSelection(population, prng, child.parent_1);
+        if ( isBetter(population[child.parent_2], population[child.parent_1]) ) {
+          std::swap(child.parent_1, child.parent_2);
+        }
+      }
+    }
+
+    tbb::parallel_for(UL(0), num_offspring, [&](const size_t i) {
+      tbb::this_task_arena::isolate([&] {
+        Offspring& child = offspring[i];
+        std::unique_ptr<Hypergraph> hg = hypergraph_pool.acquire();
+        setCommunityIDsOfParents(*hg, population[child.parent_1].partition,
+          child.isCombine() ? &population[child.parent_2].partition : nullptr, k);
+        {
+          PartitionedHypergraph phg =
+            Multilevel<TypeTraits>::vcycle(*hg, e_context, target_graph);
+          child.individual = createIndividual(phg, e_context);
+        }
+        hypergraph_pool.release(std::move(hg));
+      });
+    });
+
+    for ( Offspring& child : offspring ) {
+      const size_t worst = worstIndividual(population);
+      if ( isBetter(child.individual, population[worst]) ) {
+        population[worst] = std::move(child.individual);
+      }
+    }
+
+    if ( context.partition.verbose_output && context.type == ContextType::main ) {
+      const Individual& best = population[bestIndividual(population)];
+      LOG << "Generation" << (generation + 1) << ":"
+          << context.partition.objective << "=" << best.objective
+          << ", imbalance =" << best.imbalance;
+    }
+  }
+
+  if ( context.type == ContextType::main ) {
+    if ( context.shared_memory.manage_memory_pool ) {
+      parallel::MemoryPool::instance().activate_unused_memory_allocations();
+    }
+    if ( was_enabled_before ) {
+      timer.enable();
+      utils.getStats(context.utility_id).enable();
+    }
+  }
+
+  // Apply best individual to the input hypergraph
+  const Individual& best = population[bestIndividual(population)];
+  if ( isBetter(best, first_individual) ) {
+    partitioned_hg.resetPartition();
+    partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+      partitioned_hg.setOnlyNodePart(hn, best.partition[hn]);
+    });
+    partitioned_hg.initializePartition();
+  }
+  timer.stop_timer("evolutionary");
+
+  return partitioned_hg;
+}
+
+template<typename TypeTraits>
+void Evolutionary<TypeTraits>::createInitialPopulation(HypergraphPool& hypergraph_pool,
+                                                       const Context& context,
+                                                       const TargetGraph* target_graph,
+                                                       const HighResClockTimepoint& start,
+                                                       vec<Individual>& population) {
+  ASSERT(!population.empty());
+  const double amount_of_time = context.evolutionary.dynamic_population_amount_of_time;
+  tbb::parallel_for(UL(1), population.size(), [&](const size_t i) {
+    if ( timeLimitReached(context, start, amount_of_time) ) {
+      return;
+    }
+    tbb::this_task_arena::isolate([&] {
+      std::unique_ptr<Hypergraph> hg = hypergraph_pool.acquire();
+      {
+        PartitionedHypergraph phg =
+          Multilevel<TypeTraits>::partition(*hg, context, target_graph);
+        population[i] = createIndividual(phg, context);
+      }
+      hypergraph_pool.release(std::move(hg));
+    });
+  });
+
+  // Remove individuals that were not computed due to the time limit
+  population.erase(std::remove_if(population.begin() + 1, population.end(),
+    [&](const Individual& individual) {
+      return individual.partition.empty();
+    }), population.end());
+}
+
+template<typename TypeTraits>
+void Evolutionary<TypeTraits>::setCommunityIDsOfParents(Hypergraph& hypergraph,
+                                                        const vec<PartitionID>& parent_1,
+                                                        const vec<PartitionID>* parent_2,
+                                                        const PartitionID k) {
+  if ( parent_2 ) {
+    hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
+      hypergraph.setCommunityID(hn, parent_1[hn] + k * (*parent_2)[hn]);
+    });
+  } else {
+    hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
+      hypergraph.setCommunityID(hn, parent_1[hn]);
+    });
+  }
+}
+
+INSTANTIATE_CLASS_WITH_TYPE_TRAITS(Evolutionary)
+
+}  // namespace mt_kahypar
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <limits>
+#include <memory>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+#include "mt-kahypar/partition/context.h"
+
+namespace mt_kahypar {
+
+// Forward Declaration
+class TargetGraph;
+
+namespace evolutionary {
+
+using HighResClockTimepoint = std::chrono::time_point<std::chrono::high_resolution_clock>;
+
+struct Individual {
+  vec<PartitionID> partition;
+  HyperedgeWeight objective = std::numeric_limits<HyperedgeWeight>::max();
+  double imbalance = std::numeric_limits<double>::max();
+  bool is_balanced = false;
+};
+
+// ! Balanced partitions are always better than imbalanced ones. Among balanced
+// ! partitions, we prefer the one with the better objective and among imbalanced
+// ! partitions the one with the smaller imbalance.
+bool isBetter(const Individual& lhs, const Individual& rhs);
+
+/**
+ * Each individual is computed on its own copy of the input hypergraph
+ * (contraction modifies the hypergraph in the n-level setting and stores
+ * the community IDs). Copies are recycled between individuals such that
+ * we allocate at most as many copies as individuals are computed concurrently.
+ */
+template<typename Hypergraph>
+class HypergraphPool {
+
+ public:
+  explicit HypergraphPool(const Hypergraph& hypergraph) :
+    _hypergraph(hypergraph),
+    _lock(),
+    _free_hypergraphs() { }
+
+  HypergraphPool(const HypergraphPool&) = delete;
+  HypergraphPool & operator= (const HypergraphPool &) = delete;
+
+  std::unique_ptr<Hypergraph> acquire() {
+    std::unique_ptr<Hypergraph> hypergraph;
+    _lock.lock();
+    if ( !_free_hypergraphs.empty() ) {
+      hypergraph = std::move(_free_hypergraphs.back());
+      _free_hypergraphs.pop_back();
+    }
+    _lock.unlock();
+
+    if ( !hypergraph ) {
+      hypergraph = std::make_unique<Hypergraph>(_hypergraph.copy(parallel_tag_t()));
+    }
+    hypergraph->reset();
+    return hypergraph;
+  }
+
+  void release(std::unique_ptr<Hypergraph> hypergraph) {
+    _lock.lock();
+    _free_hypergraphs.emplace_back(std::move(hypergraph));
+    _lock.unlock();
+  }
+
+ private:
+  const Hypergraph& _hypergraph;
+  SpinLock _lock;
+  vec<std::unique_ptr<Hypergraph>> _free_hypergraphs;
+};
+
+} // namespace evolutionary
+
+template<typename TypeTraits>
+class Evolutionary {
+
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+  using Individual = evolutionary::Individual;
+  using HypergraphPool = evolutionary::HypergraphPool<Hypergraph>;
+  using HighResClockTimepoint = evolutionary::HighResClockTimepoint;
+
+ public:
+  // ! Partitions a hypergraph with a memetic algorithm. The first individual is
+  // ! computed with the multilevel paradigm on the input hypergraph. Afterwards,
+  // ! we maintain a population of partitions and compute new offspring concurrently
+  // ! via combine operations (V-cycle that does not contract nodes cut by one of
+  // ! the two parents) and mutations (V-cycle on one parent). An offspring replaces
+  // ! the worst individual of the population if it is better.
+  static PartitionedHypergraph partition(Hypergraph& hypergraph,
+                                         const Context& context,
+                                         const TargetGraph* target_graph = nullptr);
+
+  // ! Computes the individuals 1, ..., population_size - 1 of the initial population
+  // ! concurrently with the multilevel paradigm (population[0] is computed by the caller).
+  // ! If a time limit is given, no further individuals are started once the fraction
+  // ! dynamic_population_amount_of_time of it has elapsed since start. Individuals that
+  // ! were not computed are removed from the population.
+  static void createInitialPopulation(HypergraphPool& hypergraph_pool,
+                                      const Context& context,
+                                      const TargetGraph* target_graph,
+                                      const HighResClockTimepoint& start,
+                                      vec<Individual>& population);
+
+  // ! The V-cycle does not contract nodes with different community IDs and uses
+  // ! the community IDs modulo k as initial partition. For a combine operation,
+  // ! we encode the blocks of both parents as p_1 + k * p_2, which restricts
+  // ! coarsening to nodes not cut by either parent and starts the refinement
+  // ! from the better parent p_1. For a mutation (parent_2 == nullptr), the
+  // ! community IDs are the blocks of p_1.
+  static void setCommunityIDsOfParents(Hypergraph& hypergraph,
+                                       const vec<PartitionID>& parent_1,
+                                       const vec<PartitionID>* parent_2,
+                                       const PartitionID k);
+};
+
+}  // namespace mt_kahypar
@@ -71,7 +71,7 @@ using DeterministicCoarsenerDispatcher = kahypar::meta::StaticMultiDispatchFacto
 using NLevelCoarsenerDispatcher = kahypar::meta::StaticMultiDispatchFactory<NLevelCoarsener,
                                                                             ICoarsener,
                                                                             kahypar::meta::Typelist<TypeTraitsList,
-                                                                                                    RatingScorePolicies,
+                                                                                                    NLevelRatingScorePolicies,
                                                                                                     HeavyNodePenaltyPolicies,
                                                                                                     AcceptancePolicies> >;
 #endif
@@ -64,6 +64,11 @@ void BFSInitialPartitioner<TypeTraits>::partitionImpl() {
     const HypernodeID current_num_nodes =
             hypergraph.initialNumNodes() - hypergraph.numRemovedHypernodes();
     while (num_assigned_hypernodes < current_num_nodes) {
+      if ( _ip_data.should_cancel(InitialPartitioningAlgorithm::bfs) ) {
+        _ip_data.cancel(InitialPartitioningAlgorithm::bfs);
+        return;
+      }
+
       for (PartitionID block = 0; block < _context.partition.k; ++block) {
         HypernodeID hn = kInvalidHypernode;
 
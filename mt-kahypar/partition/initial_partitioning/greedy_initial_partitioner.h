@@ -97,6 +97,11 @@ class GreedyInitialPartitioner : public IInitialPartitioner {
       bool use_perfect_balanced_as_upper_bound = true;
       bool allow_overfitting = false;
       while (true) {
+        if ( _ip_data.should_cancel(_algorithm) ) {
+          _ip_data.cancel(_algorithm);
+          return;
+        }
+
         // If our default block has a weight less than the perfect balanced block weight
         // we terminate greedy initial partitioner in order to prevent that the default block
         // becomes underloaded.
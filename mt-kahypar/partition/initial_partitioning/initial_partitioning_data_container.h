@@ -36,6 +36,7 @@
 #include "mt-kahypar/partition/context.h"
 #include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/partition/factories.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 #include "mt-kahypar/utils/cast.h"
 #include "mt-kahypar/utils/utilities.h"
@@ -144,7 +145,10 @@ class InitialPartitioningDataContainer {
       _stat_mutex(),
       _context(context),
       _stats(),
-      _best_quality(std::numeric_limits<HyperedgeWeight>::max()) {
+      _num_started_runs(static_cast<size_t>(InitialPartitioningAlgorithm::UNDEFINED), 0),
+      _is_dominated(static_cast<size_t>(InitialPartitioningAlgorithm::UNDEFINED), CAtomic<bool>(false)),
+      _best_quality(std::numeric_limits<HyperedgeWeight>::max()),
+      _best_algorithm(InitialPartitioningAlgorithm::UNDEFINED) {
       const uint8_t num_initial_partitioner = static_cast<uint8_t>(InitialPartitioningAlgorithm::UNDEFINED);
       for ( uint8_t algo = 0; algo < num_initial_partitioner; ++algo ) {
         _stats.emplace_back(static_cast<InitialPartitioningAlgorithm>(algo));
@@ -159,7 +163,81 @@ class InitialPartitioningDataContainer {
       _stats[algo_idx].add_run(quality);
       if ( is_feasible && quality < _best_quality ) {
         _best_quality = quality;
+        _best_algorithm = algorithm;
       }
+
+      if ( is_portfolio_racing_enabled() ) {
+        // Publish which algorithms are dominated by the new best partition such
+        // that their running tasks can abort without acquiring the lock.
+        for ( uint8_t algo = 0; algo < _stats.size(); ++algo ) {
+          _is_dominated[algo].store(is_dominated_by_best_partition(
+            static_cast<InitialPartitioningAlgorithm>(algo)), std::memory_order_relaxed);
+        }
+      }
+    }
+
+    bool is_portfolio_racing_enabled() const {
+      return _context.initial_partitioning.use_portfolio_racing && !_context.partition.deterministic;
+    }
+
+    // ! Returns true, if a run of the corresponding initial partitioner has become
+    // ! dominated by runs that finished concurrently and should be cancelled.
+    bool is_dominated(const InitialPartitioningAlgorithm algorithm) const {
+      return _is_dominated[static_cast<uint8_t>(algorithm)].load(std::memory_order_relaxed);
+    }
+
+    // ! Selects the initial partitioner for the next run of the portfolio. Each
+    // ! enabled algorithm first performs min_adaptive_ip_runs runs. Afterwards,
+    // ! the remaining runs are assigned to the non-dominated algorithm with the
+    // ! smallest lower confidence bound on its quality (average - 2 * stddev).
+    // ! Thus, runs of algorithms that are unlikely to improve the best partition
+    // ! are reassigned to the most promising ones instead of being skipped.
+    InitialPartitioningAlgorithm next_algorithm() {
+      std::lock_guard<std::mutex> _lock(_stat_mutex);
+      const std::vector<bool>& enabled = _context.initial_partitioning.enabled_ip_algos;
+      const size_t min_runs = _context.initial_partitioning.min_adaptive_ip_runs;
+      InitialPartitioningAlgorithm selected = InitialPartitioningAlgorithm::UNDEFINED;
+      auto select_if_less_started = [&](const uint8_t algo) {
+        if ( selected == InitialPartitioningAlgorithm::UNDEFINED ||
+             _num_started_runs[algo] < _num_started_runs[static_cast<uint8_t>(selected)] ) {
+          selected = static_cast<InitialPartitioningAlgorithm>(algo);
+        }
+      };
+
+      // Warm-up phase
+      for ( uint8_t algo = 0; algo < _stats.size(); ++algo ) {
+        if ( enabled[algo] && _num_started_runs[algo] < min_runs ) {
+          select_if_less_started(algo);
+        }
+      }
+
+      if ( selected == InitialPartitioningAlgorithm::UNDEFINED ) {
+        double best_lower_bound = std::numeric_limits<double>::max();
+        for ( uint8_t algo = 0; algo < _stats.size(); ++algo ) {
+          const InitialPartitioningAlgorithm algorithm = static_cast<InitialPartitioningAlgorithm>(algo);
+          if ( enabled[algo] && !is_dominated_by_best_partition(algorithm) ) {
+            // Algorithms without a finished run are not preferred, since their
+            // warm-up runs are still in progress
+            const double lower_bound = _stats[algo].n == 0 ? std::numeric_limits<double>::max() :
+              _stats[algo].average_quality - 2.0 * _stats[algo].stddev();
+            if ( lower_bound < best_lower_bound ) {
+              best_lower_bound = lower_bound;
+              selected = algorithm;
+            } else if ( lower_bound == best_lower_bound ) {
+              select_if_less_started(algo);
+            }
+          }
+        }
+      }
+
+      if ( selected == InitialPartitioningAlgorithm::UNDEFINED ) {
+        // The algorithm that computed the best partition is never dominated, so this
+        // is only a safeguard => continue with the algorithm that computed it
+        selected = _best_algorithm;
+      }
+      ASSERT(selected != InitialPartitioningAlgorithm::UNDEFINED);
+      ++_num_started_runs[static_cast<uint8_t>(selected)];
+      return selected;
     }
 
     // ! Decides whether it is beneficial to perform further runs of a specific
@@ -182,12 +260,27 @@ class InitialPartitioningDataContainer {
              _stats[algo_idx].average_quality - 2.0 * _stats[algo_idx].stddev() <= _best_quality;
     }
 
+    // ! The algorithm that computed the best partition is never dominated, otherwise
+    // ! the cancellation of its runs could prevent further improvements
+    bool is_dominated_by_best_partition(const InitialPartitioningAlgorithm algorithm) const {
+      return algorithm != _best_algorithm &&
+        !should_initial_partitioner_run_ignoring_deterministic(algorithm);
+    }
+
     std::mutex _stat_mutex;
     const Context& _context;
     parallel::scalable_vector<InitialPartitioningRunStats> _stats;
+    parallel::scalable_vector<size_t> _num_started_runs;
+    parallel::scalable_vector<CAtomic<bool>> _is_dominated;
     HyperedgeWeight _best_quality;
+    InitialPartitioningAlgorithm _best_algorithm;
   };
 
+  // ! Thread-local data of an initial partitioning thread. Initial partitioning is
+  // ! called many times in recursive bipartitioning and the deep multilevel scheme.
+  // ! Therefore, the local data is not freed after a bipartitioning call, but returned
+  // ! to a global workspace pool (see WorkspacePool). A subsequent call reuses it, if
+  // ! its data structures are large enough to store a partition of its hypergraph.
   struct LocalInitialPartitioningHypergraph {
 
     LocalInitialPartitioningHypergraph(Hypergraph& hypergraph,
@@ -196,7 +289,11 @@ class InitialPartitioningDataContainer {
                                        const bool disable_fm) :
       _partitioned_hypergraph(context.partition.k, hypergraph),
       _context(context),
-      _global_stats(global_stats),
+      _global_stats(&global_stats),
+      _disable_fm(disable_fm),
+      _max_num_nodes(hypergraph.initialNumNodes()),
+      _max_num_edges(numEdgeIDs(hypergraph)),
+      _max_edge_size(hypergraph.maxEdgeSize()),
       _partition(hypergraph.initialNumNodes(), kInvalidPartition),
       _result(InitialPartitioningAlgorithm::UNDEFINED,
               std::numeric_limits<HypernodeWeight>::max(),
@@ -205,7 +302,13 @@ class InitialPartitioningDataContainer {
       _gain_cache(GainCachePtr::constructGainCache(context)),
       _label_propagation(nullptr),
       _twoway_fm(nullptr),
-      _stats() {
+      _stats(),
+      _kway_pq(context.partition.k),
+      _is_kway_pq_initialized(false),
+      _hn_visited(context.partition.k * hypergraph.initialNumNodes()),
+      _he_visited(context.partition.k * numEdgeIDs(hypergraph)),
+      _unassigned_hypernodes(),
+      _unassigned_hypernode_pointer(std::numeric_limits<size_t>::max()) {
 
       for ( uint8_t algo = 0; algo < static_cast<size_t>(InitialPartitioningAlgorithm::UNDEFINED); ++algo ) {
         _stats.emplace_back(static_cast<InitialPartitioningAlgorithm>(algo));
@@ -222,6 +325,74 @@ class InitialPartitioningDataContainer {
       }
     }
 
+    // The refiners store references to the partitioned hypergraph and context
+    LocalInitialPartitioningHypergraph(const LocalInitialPartitioningHypergraph&) = delete;
+    LocalInitialPartitioningHypergraph & operator= (const LocalInitialPartitioningHypergraph &) = delete;
+
+    LocalInitialPartitioningHypergraph(LocalInitialPartitioningHypergraph&&) = delete;
+    LocalInitialPartitioningHypergraph & operator= (LocalInitialPartitioningHypergraph &&) = delete;
+
+    ~LocalInitialPartitioningHypergraph() {
+      _label_propagation.reset();
+      GainCachePtr::deleteGainCache(_gain_cache);
+    }
+
+    static HyperedgeID numEdgeIDs(const Hypergraph& hypergraph) {
+      if constexpr ( Hypergraph::is_graph ) {
+        // The partitioned graph stores its edge data by unique edge IDs
+        return std::max(hypergraph.initialNumEdges(), static_cast<HyperedgeID>(hypergraph.maxUniqueID()));
+      } else {
+        return hypergraph.initialNumEdges();
+      }
+    }
+
+    // ! Returns true, if the local data can be used to partition the given hypergraph
+    bool canBeReusedFor(const Hypergraph& hypergraph,
+                        const Context& context,
+                        const bool disable_fm) const {
+      return _context.partition.k == context.partition.k &&
+             _context.partition.gain_policy == context.partition.gain_policy &&
+             _context.refinement.label_propagation.algorithm == context.refinement.label_propagation.algorithm &&
+             _disable_fm == disable_fm &&
+             hypergraph.initialNumNodes() <= _max_num_nodes &&
+             numEdgeIDs(hypergraph) <= _max_num_edges &&
+             hypergraph.maxEdgeSize() <= _max_edge_size;
+    }
+
+    // ! Prepares the local data for partitioning the hypergraph of a new bipartitioning call.
+    // ! The data structures are sized for the largest hypergraph they were created for
+    // ! and are only resetted here.
+    void bind(Hypergraph& hypergraph,
+              const Context& context,
+              GlobalInitialPartitioningStats& global_stats) {
+      ASSERT(canBeReusedFor(hypergraph, context, _disable_fm));
+      _partitioned_hypergraph.setHypergraph(hypergraph);
+      _partitioned_hypergraph.resetPartition();
+      _context = context;
+      _global_stats = &global_stats;
+      _result = PartitioningResult(InitialPartitioningAlgorithm::UNDEFINED,
+        std::numeric_limits<HypernodeWeight>::max(),
+        std::numeric_limits<HypernodeWeight>::max(),
+        std::numeric_limits<double>::max());
+      for ( utils::InitialPartitionerSummary& stats : _stats ) {
+        stats = utils::InitialPartitionerSummary(stats.algorithm);
+      }
+      _unassigned_hypernodes.clear();
+      _unassigned_hypernode_pointer = std::numeric_limits<size_t>::max();
+
+      if ( _label_propagation ) {
+        // The gain cache of the LP refiner is initialized for a specific hypergraph
+        // and therefore reconstructed. Note that this only happens for direct k-way
+        // initial partitioning, bisections use the 2-way FM refiner.
+        _label_propagation.reset();
+        GainCachePtr::deleteGainCache(_gain_cache);
+        _gain_cache = GainCachePtr::constructGainCache(_context);
+        _label_propagation = LabelPropagationFactory::getInstance().createObject(
+          _context.refinement.label_propagation.algorithm,
+          _max_num_nodes, _max_num_edges, _context, _gain_cache);
+      }
+    }
+
     PartitioningResult refineAndUpdateStats(const InitialPartitioningAlgorithm algorithm, std::mt19937& prng,
                                             const double time = 0.0) {
       ASSERT([&]() {
@@ -250,7 +421,7 @@ class InitialPartitioningDataContainer {
       _stats[algorithm_index].total_time += time;
       ++_stats[algorithm_index].total_calls;
 
-      _global_stats.add_run(algorithm, current_metric.quality,
+      _global_stats->add_run(algorithm, current_metric.quality,
         current_metric.imbalance <= _context.partition.epsilon);
 
       return result;
@@ -329,27 +500,117 @@ class InitialPartitioningDataContainer {
       }
     }
 
-    void freeInternalData() {
-      tbb::parallel_invoke([&] {
-        _partitioned_hypergraph.freeInternalData();
-      }, [&] {
-        parallel::free(_partition);
-      });
-    }
-
     PartitionedHypergraph _partitioned_hypergraph;
-    const Context& _context;
-    GlobalInitialPartitioningStats& _global_stats;
+    Context _context;
+    GlobalInitialPartitioningStats* _global_stats;
+    const bool _disable_fm;
+    const HypernodeID _max_num_nodes;
+    const HyperedgeID _max_num_edges;
+    const HypernodeID _max_edge_size;
     parallel::scalable_vector<PartitionID> _partition;
     PartitioningResult _result;
     gain_cache_t _gain_cache;
     std::unique_ptr<IRefiner> _label_propagation;
     std::unique_ptr<SequentialTwoWayFmRefiner<TypeTraits>> _twoway_fm;
     parallel::scalable_vector<utils::InitialPartitionerSummary> _stats;
+    KWayPriorityQueue _kway_pq;
+    bool _is_kway_pq_initialized;
+    kahypar::ds::FastResetFlagArray<> _hn_visited;
+    kahypar::ds::FastResetFlagArray<> _he_visited;
+    parallel::scalable_vector<HypernodeID> _unassigned_hypernodes;
+    size_t _unassigned_hypernode_pointer;
+  };
+
+  using LocalData = std::unique_ptr<LocalInitialPartitioningHypergraph>;
+  using ThreadLocalHypergraph = tbb::enumerable_thread_specific<LocalData>;
+
+  // ! Global pool of the thread-local data that is currently not used by any
+  // ! initial partitioning call. The local data is grouped into size classes
+  // ! based on the number of nodes it can store, and a call only reuses local
+  // ! data of its own or the next larger size class. This bounds the overhead
+  // ! of resetting data structures that are larger than required.
+  class WorkspacePool {
+
+    static constexpr size_t MAX_SIZE_CLASS_DISTANCE = 1;
+
+   public:
+    WorkspacePool() :
+      _lock(),
+      _workspaces() { }
+
+    LocalData acquire(Hypergraph& hypergraph,
+                      const Context& context,
+                      GlobalInitialPartitioningStats& global_stats,
+                      const bool disable_fm) {
+      const size_t size_class = sizeClass(hypergraph.initialNumNodes());
+      LocalData workspace = nullptr;
+      _lock.lock();
+      for ( size_t c = size_class; c < _workspaces.size() &&
+            c <= size_class + MAX_SIZE_CLASS_DISTANCE && !workspace; ++c ) {
+        vec<LocalData>& workspaces = _workspaces[c];
+        for ( size_t i = 0; i < workspaces.size(); ++i ) {
+          if ( workspaces[i]->canBeReusedFor(hypergraph, context, disable_fm) ) {
+            workspace = std::move(workspaces[i]);
+            workspaces[i] = std::move(workspaces.back());
+            workspaces.pop_back();
+            break;
+          }
+        }
+      }
+      _lock.unlock();
+
+      if ( workspace ) {
+        workspace->bind(hypergraph, context, global_stats);
+      } else {
+        workspace = std::make_unique<LocalInitialPartitioningHypergraph>(
+          hypergraph, context, global_stats, disable_fm);
+      }
+      return workspace;
+    }
+
+    void release(LocalData&& workspace) {
+      const size_t size_class = sizeClass(workspace->_max_num_nodes);
+      _lock.lock();
+      if ( size_class >= _workspaces.size() ) {
+        _workspaces.resize(size_class + 1);
+      }
+      _workspaces[size_class].emplace_back(std::move(workspace));
+      _lock.unlock();
+    }
+
+    size_t size() {
+      _lock.lock();
+      size_t num_workspaces = 0;
+      for ( const vec<LocalData>& workspaces : _workspaces ) {
+        num_workspaces += workspaces.size();
+      }
+      _lock.unlock();
+      return num_workspaces;
+    }
+
+    void clear() {
+      _lock.lock();
+      _workspaces.clear();
+      _lock.unlock();
+    }
+
+   private:
+    static size_t sizeClass(const HypernodeID num_nodes) {
+      size_t size_class = 0;
+      for ( HypernodeID n = num_nodes; n > 1; n >>= 1 ) {
+        ++size_class;
+      }
+      return size_class;
+    }
+
+    SpinLock _lock;
+    vec<vec<LocalData>> _workspaces;
   };
 
-  using ThreadLocalHypergraph = tbb::enumerable_thread_specific<LocalInitialPartitioningHypergraph>;
-  using ThreadLocalUnassignedHypernodes = tbb::enumerable_thread_specific<parallel::scalable_vector<HypernodeID>>;
+  static WorkspacePool& workspace_pool() {
+    static WorkspacePool pool;
+    return pool;
+  }
 
  public:
   InitialPartitioningDataContainer(PartitionedHypergraph& hypergraph,
@@ -362,12 +623,6 @@ class InitialPartitioningDataContainer {
     _local_hg([&] {
       return construct_local_partitioned_hypergraph();
     }),
-    _local_kway_pq(_context.partition.k),
-    _is_local_pq_initialized(false),
-    _local_hn_visited(_context.partition.k * hypergraph.initialNumNodes()),
-    _local_he_visited(_context.partition.k * hypergraph.initialNumEdges()),
-    _local_unassigned_hypernodes(),
-    _local_unassigned_hypernode_pointer(std::numeric_limits<size_t>::max()),
     _max_pop_size(_context.initial_partitioning.population_size)  {
     // Setup Label Propagation IRefiner Config for Initial Partitioning
     _context.refinement = _context.initial_partitioning.refinement;
@@ -388,44 +643,47 @@ class InitialPartitioningDataContainer {
   InitialPartitioningDataContainer & operator= (InitialPartitioningDataContainer &&) = delete;
 
   ~InitialPartitioningDataContainer() {
-    tbb::parallel_invoke([&] {
-      parallel::parallel_free_thread_local_internal_data(
-        _local_hg, [&](LocalInitialPartitioningHypergraph& local_hg) {
-          local_hg.freeInternalData();
-        });
-    }, [&] {
-      parallel::parallel_free_thread_local_internal_data(
-        _local_unassigned_hypernodes, [&](parallel::scalable_vector<HypernodeID>& array) {
-          parallel::free(array);
-        });
-    });
+    // Return the thread-local data to the workspace pool such that
+    // subsequent initial partitioning calls can reuse it
+    for ( LocalData& local_data : _local_hg ) {
+      workspace_pool().release(std::move(local_data));
+    }
+  }
+
+  // ! Frees the thread-local data of all previous initial partitioning calls
+  static void release_workspaces() {
+    workspace_pool().clear();
+  }
+
+  // ! Number of thread-local data objects available for reuse
+  static size_t num_available_workspaces() {
+    return workspace_pool().size();
   }
 
   PartitionedHypergraph& local_partitioned_hypergraph() {
-    return _local_hg.local()._partitioned_hypergraph;
+    return local_data()._partitioned_hypergraph;
   }
 
   KWayPriorityQueue& local_kway_priority_queue() {
-    bool& is_local_pq_initialized = _is_local_pq_initialized.local();
-    KWayPriorityQueue& local_kway_pq = _local_kway_pq.local();
-    if ( !is_local_pq_initialized ) {
-      local_kway_pq.initialize(local_partitioned_hypergraph().initialNumNodes());
-      is_local_pq_initialized = true;
+    LocalInitialPartitioningHypergraph& my_data = local_data();
+    if ( !my_data._is_kway_pq_initialized ) {
+      my_data._kway_pq.initialize(my_data._max_num_nodes);
+      my_data._is_kway_pq_initialized = true;
     }
-    return local_kway_pq;
+    return my_data._kway_pq;
   }
 
   kahypar::ds::FastResetFlagArray<>& local_hypernode_fast_reset_flag_array() {
-    return _local_hn_visited.local();
+    return local_data()._hn_visited;
   }
 
   kahypar::ds::FastResetFlagArray<>& local_hyperedge_fast_reset_flag_array() {
-    return _local_he_visited.local();
+    return local_data()._he_visited;
   }
 
   void reset_unassigned_hypernodes(std::mt19937& prng) {
-    vec<HypernodeID>& unassigned_hypernodes = _local_unassigned_hypernodes.local();
-    size_t& unassigned_hypernode_pointer = _local_unassigned_hypernode_pointer.local();
+    vec<HypernodeID>& unassigned_hypernodes = local_data()._unassigned_hypernodes;
+    size_t& unassigned_hypernode_pointer = local_data()._unassigned_hypernode_pointer;
     if ( unassigned_hypernode_pointer == std::numeric_limits<size_t>::max() || _context.partition.deterministic ) {
       if ( _context.partition.deterministic ) {
         unassigned_hypernodes.clear();
@@ -444,8 +702,8 @@ class InitialPartitioningDataContainer {
   HypernodeID get_unassigned_hypernode(const PartitionID unassigned_block = kInvalidPartition) {
     const PartitionedHypergraph& hypergraph = local_partitioned_hypergraph();
     parallel::scalable_vector<HypernodeID>& unassigned_hypernodes =
-      _local_unassigned_hypernodes.local();
-    size_t& unassigned_hypernode_pointer = _local_unassigned_hypernode_pointer.local();
+      local_data()._unassigned_hypernodes;
+    size_t& unassigned_hypernode_pointer = local_data()._unassigned_hypernode_pointer;
     ASSERT(!unassigned_hypernodes.empty());
     ASSERT(unassigned_hypernode_pointer <= unassigned_hypernodes.size());
 
@@ -467,6 +725,30 @@ class InitialPartitioningDataContainer {
     return _global_stats.should_initial_partitioner_run(algorithm);
   }
 
+  bool is_portfolio_racing_enabled() const {
+    return _global_stats.is_portfolio_racing_enabled();
+  }
+
+  InitialPartitioningAlgorithm next_algorithm() {
+    return _global_stats.next_algorithm();
+  }
+
+  // ! Returns true, if the current run of the initial partitioner should be aborted
+  // ! (only in portfolio racing mode). Initial partitioners check this periodically.
+  bool should_cancel(const InitialPartitioningAlgorithm algorithm) const {
+    return _global_stats.is_dominated(algorithm);
+  }
+
+  /*!
+   * Aborts the current run of the initial partitioner on the local hypergraph.
+   * The partition is discarded without refinement and the local hypergraph is resetted.
+   */
+  void cancel(const InitialPartitioningAlgorithm algorithm) {
+    auto& my_ip_data = local_data();
+    ++my_ip_data._stats[static_cast<uint8_t>(algorithm)].total_cancelled;
+    my_ip_data._partitioned_hypergraph.resetPartition();
+  }
+
   /*!
    * Commits the current partition computed on the local hypergraph. Partition replaces
    * the best local partition, if it has a better quality (or better imbalance).
@@ -474,8 +756,14 @@ class InitialPartitioningDataContainer {
    */
   void commit(const InitialPartitioningAlgorithm algorithm, std::mt19937& prng, size_t deterministic_tag,
               const double time = 0.0) {
+    if ( should_cancel(algorithm) ) {
+      // Skip the refinement of partitions that are dominated
+      cancel(algorithm);
+      return;
+    }
+
     // already commits the result if non-deterministic
-    auto& my_ip_data = _local_hg.local();
+    auto& my_ip_data = local_data();
     auto my_result = my_ip_data.refineAndUpdateStats(algorithm, prng, time);
     const double eps = _context.partition.epsilon;
 
@@ -531,7 +819,7 @@ class InitialPartitioningDataContainer {
     if ( _context.partition.deterministic ) {
       for (auto& p : _local_hg) {
         ++number_of_threads;
-        p.aggregate_stats(stats);
+        p->aggregate_stats(stats);
       }
 
       // bring them in a deterministic order
@@ -541,7 +829,7 @@ class InitialPartitioningDataContainer {
 
       if ( _context.initial_partitioning.perform_refinement_on_best_partitions ) {
         auto refinement_task = [&](size_t i) {
-          auto& my_data = _local_hg.local();
+          auto& my_data = local_data();
           auto& my_phg = my_data._partitioned_hypergraph;
           vec<PartitionID>& my_partition = _best_partitions[i].second;
           PartitioningResult& my_objectives = _best_partitions[i].first;
@@ -586,9 +874,9 @@ class InitialPartitioningDataContainer {
       int thread_counter = 0;
       if ( _context.initial_partitioning.perform_refinement_on_best_partitions ) {
         tbb::task_group fm_refinement_group;
-        for ( LocalInitialPartitioningHypergraph& partition : _local_hg ) {
+        for ( LocalData& partition : _local_hg ) {
           fm_refinement_group.run([&, thread_counter] {
-            partition.performRefinementOnBestPartition(_partitioned_hg.initialNumPins() + thread_counter);
+            partition->performRefinementOnBestPartition(_partitioned_hg.initialNumPins() + thread_counter);
           });
           thread_counter++;
         }
@@ -600,7 +888,8 @@ class InitialPartitioningDataContainer {
       LocalInitialPartitioningHypergraph* worst = nullptr;
       LocalInitialPartitioningHypergraph* best_imbalance = nullptr;
       LocalInitialPartitioningHypergraph* best_objective = nullptr;
-      for ( LocalInitialPartitioningHypergraph& partition : _local_hg ) {
+      for ( LocalData& data : _local_hg ) {
+        LocalInitialPartitioningHypergraph& partition = *data;
         ++number_of_threads;
         partition.aggregate_stats(stats);
         if ( !best || best->_result.is_other_better(partition._result, _context.partition.epsilon) ) {
@@ -652,25 +941,22 @@ class InitialPartitioningDataContainer {
   }
 
  private:
-  LocalInitialPartitioningHypergraph construct_local_partitioned_hypergraph() {
-    return LocalInitialPartitioningHypergraph(
+  LocalData construct_local_partitioned_hypergraph() {
+    return workspace_pool().acquire(
       _partitioned_hg.hypergraph(), _context, _global_stats, _disable_fm);
   }
 
+  LocalInitialPartitioningHypergraph& local_data() {
+    return *_local_hg.local();
+  }
+
   PartitionedHypergraph& _partitioned_hg;
   Context _context;
   const bool _disable_fm;
 
   GlobalInitialPartitioningStats _global_stats;
 
-  // TODO group these objects into one struct --> fewer hash tables
   ThreadLocalHypergraph _local_hg;
-  ThreadLocalKWayPriorityQueue _local_kway_pq;
-  tbb::enumerable_thread_specific<bool> _is_local_pq_initialized;
-  ThreadLocalFastResetFlagArray _local_hn_visited;
-  ThreadLocalFastResetFlagArray _local_he_visited;
-  ThreadLocalUnassignedHypernodes _local_unassigned_hypernodes;
-  tbb::enumerable_thread_specific<size_t> _local_unassigned_hypernode_pointer;
 
   size_t _max_pop_size;
   SpinLock _pop_lock;
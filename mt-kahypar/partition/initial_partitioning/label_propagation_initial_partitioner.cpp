@@ -60,6 +60,10 @@ void LabelPropagationInitialPartitioner<TypeTraits>::partitionImpl() {
 
     bool converged = false;
     for ( size_t i = 0; i < _context.initial_partitioning.lp_maximum_iterations && !converged; ++i ) {
+      if ( _ip_data.should_cancel(InitialPartitioningAlgorithm::label_propagation) ) {
+        _ip_data.cancel(InitialPartitioningAlgorithm::label_propagation);
+        return;
+      }
       converged = true;
 
       for ( const HypernodeID& hn : hg.nodes() ) {
@@ -70,28 +70,41 @@ void Pool<TypeTraits>::bipartition(PartitionedHypergraph& hypergraph,
   tbb::task_group tg;
   InitialPartitioningDataContainer<TypeTraits> ip_data(hypergraph, context);
   ip_data_container_t* ip_data_ptr = ip::to_pointer(ip_data);
+  // In portfolio racing mode, the algorithm of a run is not fixed in advance.
+  // Each run asks the portfolio for the most promising algorithm when it starts,
+  // which reassigns the runs of dominated algorithms to the best-performing ones.
+  const bool use_portfolio = ip_data.is_portfolio_racing_enabled();
+  auto run_initial_partitioner = [&](InitialPartitioningAlgorithm algorithm,
+                                     const int seed, const int tag) {
+    if ( use_portfolio ) {
+      algorithm = ip_data.next_algorithm();
+    }
+    std::unique_ptr<IInitialPartitioner> initial_partitioner =
+      InitialPartitionerFactory::getInstance().createObject(
+        algorithm, algorithm, ip_data_ptr, context, seed, tag);
+    initial_partitioner->partition();
+  };
   for ( const auto& ip_task : _ip_task_lists ) {
     const InitialPartitioningAlgorithm algorithm = std::get<0>(ip_task);
     const int seed = std::get<1>(ip_task);
     const int tag = std::get<2>(ip_task);
     if ( run_parallel ) {
       tg.run([&, algorithm, seed, tag] {
-        std::unique_ptr<IInitialPartitioner> initial_partitioner =
-          InitialPartitionerFactory::getInstance().createObject(
-            algorithm, algorithm, ip_data_ptr, context, seed, tag);
-        initial_partitioner->partition();
+        run_initial_partitioner(algorithm, seed, tag);
       });
     } else {
-      std::unique_ptr<IInitialPartitioner> initial_partitioner =
-        InitialPartitionerFactory::getInstance().createObject(
-          algorithm, algorithm, ip_data_ptr, context, seed, tag);
-      initial_partitioner->partition();
+      run_initial_partitioner(algorithm, seed, tag);
     }
   }
   tg.wait();
   ip_data.apply();
 }
 
+template<typename TypeTraits>
+void Pool<TypeTraits>::releaseWorkspaces() {
+  InitialPartitioningDataContainer<TypeTraits>::release_workspaces();
+}
+
 INSTANTIATE_CLASS_WITH_TYPE_TRAITS(Pool)
 
 } // namespace mt_kahypar
\ No newline at end of file
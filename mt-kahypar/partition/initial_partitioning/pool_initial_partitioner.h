@@ -43,6 +43,10 @@ class Pool {
   static void bipartition(PartitionedHypergraph& hypergraph,
                           const Context& context,
                           const bool run_parallel = true);
+
+  // ! The thread-local data of the initial partitioners is reused across
+  // ! bipartitioning calls. This function frees it.
+  static void releaseWorkspaces();
 };
 
 } // namespace mt_kahypar
@@ -26,6 +26,9 @@
 
 #include "mt-kahypar/partition/mapping/all_pair_shortest_path.h"
 
+#include "tbb/parallel_for.h"
+#include "tbb/parallel_invoke.h"
+
 namespace mt_kahypar {
 
 namespace {
@@ -34,14 +37,10 @@ MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE size_t index(
   ASSERT(u < n && v < n);
   return u + v * n;
 }
-} // namespace
 
-void AllPairShortestPath::compute(const ds::StaticGraph& graph,
-                                  vec<HyperedgeWeight>& distances) {
+void initializeDistances(const ds::StaticGraph& graph,
+                         vec<HyperedgeWeight>& distances) {
   const HypernodeID n = graph.initialNumNodes();
-  ASSERT(static_cast<size_t>(n * n) <= distances.size());
-
-  // Initialize Distance Matrix
   for ( const HypernodeID& u : graph.nodes() ) {
     distances[index(u, u, n)] = 0;
   }
@@ -50,6 +49,85 @@ void AllPairShortestPath::compute(const ds::StaticGraph& graph,
     const HypernodeID v = graph.edgeTarget(e);
     distances[index(u, v, n)] = graph.edgeWeight(e);
   }
+}
+
+struct Tile {
+  HypernodeID begin;
+  HypernodeID end;
+};
+
+/**
+ * Relaxes all distances d(u,v) with u in rows and v in columns via nodes k in pivots.
+ * The matrix is stored in column-major order. Thus, the innermost loop iterates
+ * over two contiguous memory ranges, which enables the compiler to vectorize it.
+ * The loop over k must be the outermost loop, since the tile that we update can
+ * coincide with the tiles we read from (diagonal tile and tiles in the pivot row
+ * and column).
+ */
+void relaxTile(HyperedgeWeight* distances,
+               const HypernodeID n,
+               const Tile rows,
+               const Tile columns,
+               const Tile pivots) {
+  for ( HypernodeID k = pivots.begin; k < pivots.end; ++k ) {
+    const HyperedgeWeight* dist_to_k = distances + static_cast<size_t>(k) * n;
+    for ( HypernodeID v = columns.begin; v < columns.end; ++v ) {
+      // d(u,v) = min(d(u,v), d(u,k) + d(k,v)) does not change for v = k, since d(k,k) = 0
+      if ( v == k ) continue;
+      const HyperedgeWeight dist_k_v = distances[index(k, v, n)];
+      HyperedgeWeight* dist_to_v = distances + static_cast<size_t>(v) * n;
+      for ( HypernodeID u = rows.begin; u < rows.end; ++u ) {
+        dist_to_v[u] = std::min(dist_to_v[u], dist_to_k[u] + dist_k_v);
+      }
+    }
+  }
+}
+} // namespace
+
+void AllPairShortestPath::compute(const ds::StaticGraph& graph,
+                                  vec<HyperedgeWeight>& distances) {
+  const HypernodeID n = graph.initialNumNodes();
+  ASSERT(static_cast<size_t>(n) * n <= distances.size());
+  initializeDistances(graph, distances);
+
+  const HypernodeID num_tiles = ( n + BLOCK_SIZE - 1 ) / BLOCK_SIZE;
+  auto tile = [&](const HypernodeID i) {
+    return Tile { i * BLOCK_SIZE, std::min((i + 1) * BLOCK_SIZE, n) };
+  };
+  HyperedgeWeight* dist = distances.data();
+  for ( HypernodeID k = 0; k < num_tiles; ++k ) {
+    const Tile pivots = tile(k);
+    // Phase 1: Diagonal tile only depends on itself
+    relaxTile(dist, n, pivots, pivots, pivots);
+
+    // Phase 2: Tiles in the same row and column as the diagonal tile
+    // only depend on themselves and the diagonal tile
+    tbb::parallel_invoke([&] {
+      tbb::parallel_for(UL(0), static_cast<size_t>(num_tiles), [&](const size_t i) {
+        if ( i != k ) relaxTile(dist, n, pivots, tile(i), pivots);
+      });
+    }, [&] {
+      tbb::parallel_for(UL(0), static_cast<size_t>(num_tiles), [&](const size_t i) {
+        if ( i != k ) relaxTile(dist, n, tile(i), pivots, pivots);
+      });
+    });
+
+    // Phase 3: All remaining tiles only depend on the tiles of phase 2
+    tbb::parallel_for(UL(0), static_cast<size_t>(num_tiles) * num_tiles, [&](const size_t idx) {
+      const HypernodeID i = idx % num_tiles;
+      const HypernodeID j = idx / num_tiles;
+      if ( i != k && j != k ) {
+        relaxTile(dist, n, tile(i), tile(j), pivots);
+      }
+    });
+  }
+}
+
+void AllPairShortestPath::computeSequential(const ds::StaticGraph& graph,
+                                            vec<HyperedgeWeight>& distances) {
+  const HypernodeID n = graph.initialNumNodes();
+  ASSERT(static_cast<size_t>(n) * n <= distances.size());
+  initializeDistances(graph, distances);
 
   // Floyd Algorithm to compute all shortest paths (O(n^3))
   for ( HypernodeID k = 0;  k < n; ++k) {
@@ -33,10 +33,25 @@ namespace mt_kahypar {
 
 class AllPairShortestPath {
 
+  // ! Number of rows and columns of a tile of the distance matrix.
+  // ! A tile of 64 x 64 distances fits into the L1 cache of most machines.
+  static constexpr HypernodeID BLOCK_SIZE = 64;
+
  public:
+  /**
+   * Computes the shortest path between all pairs of nodes with a cache-blocked
+   * variant of Floyd's algorithm. The distance matrix is partitioned into
+   * BLOCK_SIZE x BLOCK_SIZE tiles. In each round, the diagonal tile is relaxed
+   * first, then all tiles in the same row and column in parallel and finally all
+   * remaining tiles in parallel.
+   */
   static void compute(const ds::StaticGraph& graph,
                       vec<HyperedgeWeight>& distances);
 
+  // ! Sequential version of Floyd's algorithm (used for testing and benchmarking)
+  static void computeSequential(const ds::StaticGraph& graph,
+                                vec<HyperedgeWeight>& distances);
+
  private:
   AllPairShortestPath() { }
 };
@@ -31,6 +31,7 @@
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
 #include "mt-kahypar/partition/mapping/greedy_mapping.h"
+#include "mt-kahypar/partition/mapping/parallel_swap_local_search.h"
 #include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 #include "mt-kahypar/utils/utilities.h"
@@ -168,9 +169,12 @@ void map_to_target_graph(PartitionedHypergraph& communication_hg,
                          const Context& context) {
   using Hypergraph = typename PartitionedHypergraph::UnderlyingHypergraph;
   utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
-  const bool was_unused_memory_allocations_enabled =
+  const bool manage_memory_pool = context.shared_memory.manage_memory_pool;
+  const bool was_unused_memory_allocations_enabled = manage_memory_pool &&
     parallel::MemoryPoolT::instance().is_unused_memory_allocations_activated();
-  parallel::MemoryPoolT::instance().deactivate_unused_memory_allocations();
+  if ( manage_memory_pool ) {
+    parallel::MemoryPoolT::instance().deactivate_unused_memory_allocations();
+  }
   // We contract all blocks of the partition to create an one-to-one mapping problem
   timer.start_timer("contract_partition", "Contract Partition");
   vec<HypernodeID> mapping(communication_hg.initialNumNodes(), kInvalidHypernode);
@@ -202,6 +206,10 @@ void map_to_target_graph(PartitionedHypergraph& communication_hg,
   // Solve one-to-one mapping problem
   if ( context.mapping.strategy == OneToOneMappingStrategy::greedy_mapping ) {
     GreedyMapping<PartitionedHypergraph>::mapToTargetGraph(contracted_phg, target_graph, context);
+  } else if ( context.mapping.strategy == OneToOneMappingStrategy::parallel_local_search ) {
+    timer.start_timer("initial_mapping", "Initial Mapping");
+    ParallelSwapLocalSearch<PartitionedHypergraph>::improve(contracted_phg, target_graph);
+    timer.stop_timer("initial_mapping");
   }
 
   const HyperedgeWeight objective_after = metrics::quality(contracted_phg, Objective::steiner_tree);
@@ -61,14 +61,31 @@ MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE HyperedgeWeight swap_gain(const TargetGraph&
   return (distance_before - distance_after) * edge_weight;
 }
 
-// This function computes the gain of swapping the blocks of node u and v
-// in the communication hypergraph for the steiner tree metric.
+using Swap = std::pair<HypernodeID, HypernodeID>;
+
+struct PQElement {
+  HyperedgeWeight gain;
+  Swap swap;
+};
+
+bool operator<(const PQElement& lhs, const PQElement& rhs) {
+  return lhs.gain < rhs.gain || (lhs.gain == rhs.gain && lhs.swap < rhs.swap);
+}
+
+bool operator>(const PQElement& lhs, const PQElement& rhs) {
+  return lhs.gain > rhs.gain || (lhs.gain == rhs.gain && lhs.swap > rhs.swap);
+}
+
+using PQ = std::priority_queue<PQElement>;
+
+}
+
 template<typename CommunicationHypergraph>
-MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE HyperedgeWeight swap_gain(CommunicationHypergraph& communication_hg,
-                                                             const TargetGraph& target_graph,
-                                                             const HypernodeID u,
-                                                             const HypernodeID v,
-                                                             vec<bool>& marked_hes) {
+HyperedgeWeight KerninghanLin<CommunicationHypergraph>::swapGain(const CommunicationHypergraph& communication_hg,
+                                                                 const TargetGraph& target_graph,
+                                                                 const HypernodeID u,
+                                                                 const HypernodeID v,
+                                                                 vec<bool>& marked_hes) {
   HyperedgeWeight gain = 0;
   const PartitionID block_of_u = communication_hg.partID(u);
   const PartitionID block_of_v = communication_hg.partID(v);
@@ -108,25 +125,6 @@ MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE HyperedgeWeight swap_gain(CommunicationHyperg
   return gain;
 }
 
-using Swap = std::pair<HypernodeID, HypernodeID>;
-
-struct PQElement {
-  HyperedgeWeight gain;
-  Swap swap;
-};
-
-bool operator<(const PQElement& lhs, const PQElement& rhs) {
-  return lhs.gain < rhs.gain || (lhs.gain == rhs.gain && lhs.swap < rhs.swap);
-}
-
-bool operator>(const PQElement& lhs, const PQElement& rhs) {
-  return lhs.gain > rhs.gain || (lhs.gain == rhs.gain && lhs.swap > rhs.swap);
-}
-
-using PQ = std::priority_queue<PQElement>;
-
-}
-
 template<typename CommunicationHypergraph>
 void KerninghanLin<CommunicationHypergraph>::improve(CommunicationHypergraph& communication_hg,
                                                      const TargetGraph& target_graph) {
@@ -147,7 +145,7 @@ void KerninghanLin<CommunicationHypergraph>::improve(CommunicationHypergraph& co
     for ( const HypernodeID& u : communication_hg.nodes() ) {
       for ( const HypernodeID& v : communication_hg.nodes() ) {
         if ( u < v ) {
-          const HyperedgeWeight gain = swap_gain(communication_hg, target_graph, u, v, marked_hes);
+          const HyperedgeWeight gain = swapGain(communication_hg, target_graph, u, v, marked_hes);
           pq.push(PQElement { gain, std::make_pair(u, v) });
         }
       }
@@ -171,7 +169,7 @@ void KerninghanLin<CommunicationHypergraph>::improve(CommunicationHypergraph& co
       }
 
       // Recompute gain
-      const HyperedgeWeight recomputed_gain = swap_gain(communication_hg, target_graph, u, v, marked_hes);
+      const HyperedgeWeight recomputed_gain = swapGain(communication_hg, target_graph, u, v, marked_hes);
       if ( gain != recomputed_gain ) {
         // Lazy update of PQ
         // Note that since we do not immediately update the PQ after a swap operation, we may not be
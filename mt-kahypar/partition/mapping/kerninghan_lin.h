@@ -54,6 +54,14 @@ class KerninghanLin {
   static void improve(CommunicationHypergraph& communication_hg,
                       const TargetGraph& target_graph);
 
+  // ! This function computes the gain of swapping the blocks of node u and v
+  // ! in the communication hypergraph for the steiner tree metric.
+  static HyperedgeWeight swapGain(const CommunicationHypergraph& communication_hg,
+                                  const TargetGraph& target_graph,
+                                  const HypernodeID u,
+                                  const HypernodeID v,
+                                  vec<bool>& marked_hes);
+
  private:
   KerninghanLin() { }
 };
@@ -0,0 +1,209 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/partition/mapping/parallel_swap_local_search.h"
+
+#include "tbb/enumerable_thread_specific.h"
+#include "tbb/parallel_for.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/mapping/kerninghan_lin.h"
+#include "mt-kahypar/partition/mapping/target_graph.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/utils/randomize.h"
+
+namespace mt_kahypar {
+
+namespace {
+
+struct LocalSearchData {
+  LocalSearchData(const HypernodeID num_nodes,
+                  const HyperedgeID num_edges) :
+    marked_hes(num_edges, false),
+    is_candidate(num_nodes, false),
+    candidates(),
+    locked_hes() { }
+
+  vec<bool> marked_hes;
+  vec<bool> is_candidate;
+  vec<HypernodeID> candidates;
+  vec<HyperedgeID> locked_hes;
+};
+
+} // namespace
+
+template<typename CommunicationHypergraph>
+void ParallelSwapLocalSearch<CommunicationHypergraph>::improve(CommunicationHypergraph& communication_hg,
+                                                               const TargetGraph& target_graph,
+                                                               const size_t max_num_candidates) {
+  ASSERT(communication_hg.initialNumNodes() == target_graph.graph().initialNumNodes());
+  using SwapGain = KerninghanLin<CommunicationHypergraph>;
+  const HypernodeID num_nodes = communication_hg.initialNumNodes();
+  const HyperedgeID num_edges = communication_hg.initialNumEdges();
+  const ds::StaticGraph& graph = target_graph.graph();
+
+  vec<CAtomic<HypernodeID>> node_of_block(num_nodes, CAtomic<HypernodeID>(kInvalidHypernode));
+  communication_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+    ASSERT(communication_hg.partID(hn) != kInvalidPartition);
+    node_of_block[communication_hg.partID(hn)].store(hn, std::memory_order_relaxed);
+  });
+  vec<SpinLock> node_locks(num_nodes);
+  vec<SpinLock> edge_locks(num_edges);
+  tbb::enumerable_thread_specific<LocalSearchData> local_data([&] {
+    return LocalSearchData(num_nodes, num_edges);
+  });
+
+  // Collects all nodes placed on processors adjacent to the processors
+  // of the communication partners of u. If there are more than max_num_candidates
+  // such nodes, only a random sample of them is kept.
+  auto collect_candidates = [&](const HypernodeID u, LocalSearchData& data) {
+    const PartitionID block_of_u = communication_hg.partID(u);
+    auto add_candidate = [&](const PartitionID block) {
+      const HypernodeID v = node_of_block[block].load(std::memory_order_relaxed);
+      if ( block != block_of_u && v != kInvalidHypernode && v != u && !data.is_candidate[v] ) {
+        data.is_candidate[v] = true;
+        data.candidates.push_back(v);
+      }
+    };
+    for ( const HyperedgeID& he : communication_hg.incidentEdges(u) ) {
+      for ( const PartitionID block : communication_hg.connectivitySet(he) ) {
+        if ( block != block_of_u ) {
+          add_candidate(block);
+          for ( const HyperedgeID& e : graph.incidentEdges(block) ) {
+            add_candidate(graph.edgeTarget(e));
+          }
+        }
+      }
+    }
+
+    vec<HypernodeID>& candidates = data.candidates;
+    if ( candidates.size() > max_num_candidates ) {
+      const int cpu_id = SCHED_GETCPU;
+      for ( size_t i = 0; i < max_num_candidates; ++i ) {
+        const size_t j = utils::Randomize::instance().getRandomInt(
+          static_cast<int>(i), static_cast<int>(candidates.size() - 1), cpu_id);
+        std::swap(candidates[i], candidates[j]);
+      }
+      for ( size_t i = max_num_candidates; i < candidates.size(); ++i ) {
+        data.is_candidate[candidates[i]] = false;
+      }
+      candidates.resize(max_num_candidates);
+    }
+  };
+
+  // Locks u, v and all incident hyperedges of both nodes, recomputes the gain
+  // and performs the swap if it is still positive. Returns the gain of the swap.
+  auto try_swap = [&](const HypernodeID u, const HypernodeID v, LocalSearchData& data) {
+    HyperedgeWeight gain = 0;
+    const HypernodeID first = std::min(u, v);
+    const HypernodeID second = std::max(u, v);
+    if ( !node_locks[first].tryLock() ) return gain;
+    if ( !node_locks[second].tryLock() ) {
+      node_locks[first].unlock();
+      return gain;
+    }
+
+    // Acquire edge locks in increasing order of their IDs to prevent deadlocks
+    vec<HyperedgeID>& locked_hes = data.locked_hes;
+    for ( const HyperedgeID& he : communication_hg.incidentEdges(u) ) {
+      locked_hes.push_back(communication_hg.uniqueEdgeID(he));
+    }
+    for ( const HyperedgeID& he : communication_hg.incidentEdges(v) ) {
+      locked_hes.push_back(communication_hg.uniqueEdgeID(he));
+    }
+    std::sort(locked_hes.begin(), locked_hes.end());
+    locked_hes.erase(std::unique(locked_hes.begin(), locked_hes.end()), locked_hes.end());
+    for ( const HyperedgeID& he : locked_hes ) {
+      edge_locks[he].lock();
+    }
+
+    // No other thread can modify the connectivity sets of the incident
+    // hyperedges of u and v => gain is exact
+    gain = SwapGain::swapGain(communication_hg, target_graph, u, v, data.marked_hes);
+    if ( gain > 0 ) {
+      const PartitionID block_of_u = communication_hg.partID(u);
+      const PartitionID block_of_v = communication_hg.partID(v);
+      communication_hg.changeNodePart(u, block_of_u, block_of_v);
+      communication_hg.changeNodePart(v, block_of_v, block_of_u);
+      node_of_block[block_of_u].store(v, std::memory_order_relaxed);
+      node_of_block[block_of_v].store(u, std::memory_order_relaxed);
+    }
+
+    for ( const HyperedgeID& he : locked_hes ) {
+      edge_locks[he].unlock();
+    }
+    locked_hes.clear();
+    node_locks[second].unlock();
+    node_locks[first].unlock();
+    return std::max(gain, 0);
+  };
+
+  HyperedgeWeight current_objective = metrics::quality(communication_hg, Objective::steiner_tree);
+  vec<HypernodeID> nodes(num_nodes);
+  std::iota(nodes.begin(), nodes.end(), 0);
+  for ( size_t round = 0; round < MAX_NUMBER_OF_ROUNDS; ++round ) {
+    utils::Randomize::instance().parallelShuffleVector(nodes, UL(0), nodes.size());
+    CAtomic<HyperedgeWeight> round_gain(0);
+    tbb::parallel_for(UL(0), nodes.size(), [&](const size_t i) {
+      const HypernodeID u = nodes[i];
+      if ( !communication_hg.nodeIsEnabled(u) ) return;
+      LocalSearchData& data = local_data.local();
+
+      // Find best swap partner
+      collect_candidates(u, data);
+      HypernodeID best_v = kInvalidHypernode;
+      HyperedgeWeight best_gain = 0;
+      for ( const HypernodeID v : data.candidates ) {
+        const HyperedgeWeight gain = SwapGain::swapGain(
+          communication_hg, target_graph, u, v, data.marked_hes);
+        if ( gain > best_gain ) {
+          best_gain = gain;
+          best_v = v;
+        }
+        data.is_candidate[v] = false;
+      }
+      data.candidates.clear();
+
+      if ( best_v != kInvalidHypernode ) {
+        round_gain.fetch_add(try_swap(u, best_v, data), std::memory_order_relaxed);
+      }
+    });
+
+    current_objective -= round_gain.load(std::memory_order_relaxed);
+    DBG << "Round" << (round + 1) << ": Improved objective by" << round_gain.load()
+        << "( Current Objective =" << current_objective << ")";
+    ASSERT(current_objective == metrics::quality(communication_hg, Objective::steiner_tree));
+    if ( round_gain.load(std::memory_order_relaxed) == 0 ) {
+      break;
+    }
+  }
+  DBG << "Parallel Local Search Result =" << current_objective << "\n";
+}
+
+INSTANTIATE_CLASS_WITH_PARTITIONED_HG(ParallelSwapLocalSearch)
+
+}  // namespace kahypar
@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/partition/context.h"
+
+namespace mt_kahypar {
+
+// Forward Declaration
+class TargetGraph;
+
+template<typename CommunicationHypergraph>
+class ParallelSwapLocalSearch {
+
+  static constexpr bool debug = false;
+
+  // Maximum number of rounds of the local search
+  static constexpr size_t MAX_NUMBER_OF_ROUNDS = 20;
+  // Maximum number of swap partners evaluated per node and round
+  static constexpr size_t MAX_NUMBER_OF_CANDIDATES = 64;
+
+ public:
+  // ! This function improves a given one-to-one mapping of the communication
+  // ! hypergraph onto a target graph with swap operations in parallel. In each
+  // ! round, each node u searches for the best swap partner v among nodes
+  // ! placed on processors adjacent to the processors of its communication partners
+  // ! (in the target graph). On dense target graphs, this can be almost all nodes,
+  // ! so we evaluate a random sample of at most max_num_candidates of them.
+  // ! To resolve conflicts, the thread locks u, v and all
+  // ! incident hyperedges of both nodes, recomputes the gain and only performs
+  // ! the swap if it improves the steiner tree metric. We repeat this until
+  // ! a round does not find an improvement.
+  // ! Note that the function expects that each block contains exactly one node.
+  static void improve(CommunicationHypergraph& communication_hg,
+                      const TargetGraph& target_graph,
+                      const size_t max_num_candidates = MAX_NUMBER_OF_CANDIDATES);
+
+ private:
+  ParallelSwapLocalSearch() { }
+};
+
+}  // namespace kahypar
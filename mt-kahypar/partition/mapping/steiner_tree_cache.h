@@ -0,0 +1,240 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <limits>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/datastructures/static_bitset.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+#include "mt-kahypar/utils/hash.h"
+
+namespace mt_kahypar {
+
+/**
+ * Fixed-capacity lock-free cache that stores the weight of steiner trees for
+ * connectivity sets. The cache is organized as a set-associative hash table where
+ * each bucket occupies one cache line and stores up to BUCKET_SIZE entries.
+ * An entry consists of the full 64-bit hash of the connectivity set (key) and the
+ * weight of the steiner tree. A writer locks the key of an entry while it writes
+ * the weight and readers validate a hit by reading the key again after the weight
+ * (similar to a seqlock; a torn read would require the entry to be replaced twice,
+ * ending with the same key, while a reader loads its weight). If a bucket is full, we evict an entry via the
+ * CLOCK algorithm (approximation of LRU): Each lookup hit sets a reference bit
+ * of the entry and insertions replace the first entry without a reference bit
+ * in round-robin order, while clearing the reference bits of skipped entries.
+ *
+ * Note that two different connectivity sets with the same 64-bit hash are
+ * indistinguishable, which is extremely unlikely.
+ */
+class SteinerTreeCache {
+
+  static constexpr size_t BUCKET_SIZE = 5;
+  static constexpr uint64_t EMPTY_KEY = 0;
+  // ! Marks an entry that is currently written
+  static constexpr uint64_t LOCKED_KEY = std::numeric_limits<uint64_t>::max();
+
+  // ! One bucket fits exactly into a cache line
+  struct alignas(64) Bucket {
+    CAtomic<uint64_t> keys[BUCKET_SIZE];
+    CAtomic<HyperedgeWeight> weights[BUCKET_SIZE];
+    CAtomic<uint8_t> reference_bits;
+    // ! Always in [0, BUCKET_SIZE)
+    CAtomic<uint8_t> clock_hand;
+  };
+  static_assert(sizeof(Bucket) == 64);
+
+ public:
+  struct Stats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t insertions = 0;
+    size_t evictions = 0;
+  };
+
+  explicit SteinerTreeCache(const size_t capacity,
+                            const bool track_stats = false) :
+    _mask(0),
+    _buckets(),
+    _track_stats(track_stats),
+    _hits(0),
+    _misses(0),
+    _insertions(0),
+    _evictions(0) {
+    // Number of buckets is a power of two
+    size_t num_buckets = 1;
+    while ( 2 * num_buckets * BUCKET_SIZE <= capacity ) {
+      num_buckets *= 2;
+    }
+    _mask = num_buckets - 1;
+    _buckets.resize(num_buckets);
+  }
+
+  SteinerTreeCache(const SteinerTreeCache&) = delete;
+  SteinerTreeCache & operator= (const SteinerTreeCache &) = delete;
+
+  SteinerTreeCache(SteinerTreeCache&&) = default;
+  SteinerTreeCache & operator= (SteinerTreeCache &&) = default;
+
+  size_t capacity() const {
+    return _buckets.size() * BUCKET_SIZE;
+  }
+
+  bool isTrackingStats() const {
+    return _track_stats;
+  }
+
+  // ! Hashes the blocks of the connectivity set in O(|set|) time
+  static uint64_t hash(const ds::StaticBitset& connectivity_set) {
+    uint64_t hash = 0;
+    for ( const PartitionID block : connectivity_set ) {
+      hash = combine(hash, hashing::integer::hash64(block));
+    }
+    return hash;
+  }
+
+  // ! Returns true and stores the weight of the steiner tree in weight,
+  // ! if the connectivity set with the given hash is contained in the cache
+  bool find(const uint64_t hash, HyperedgeWeight& weight) const {
+    Bucket& bucket = _buckets[hash & _mask];
+    const uint64_t k = key(hash);
+    for ( size_t i = 0; i < BUCKET_SIZE; ++i ) {
+      if ( bucket.keys[i].load(std::memory_order_acquire) == k ) {
+        const HyperedgeWeight cached_weight = bucket.weights[i].load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if ( bucket.keys[i].load(std::memory_order_relaxed) != k ) {
+          // Entry was replaced while we read its weight
+          continue;
+        }
+        const uint8_t bit = UL(1) << i;
+        if ( !( bucket.reference_bits.load(std::memory_order_relaxed) & bit ) ) {
+          // Only write if the reference bit is not set to avoid cache line bouncing
+          bucket.reference_bits.fetch_or(bit, std::memory_order_relaxed);
+        }
+        weight = cached_weight;
+        if ( _track_stats ) ++_hits;
+        return true;
+      }
+    }
+    if ( _track_stats ) ++_misses;
+    return false;
+  }
+
+  // ! Inserts the weight of the steiner tree for the connectivity set with the
+  // ! given hash. If the corresponding bucket is full, we evict an entry.
+  void insert(const uint64_t hash, const HyperedgeWeight weight) {
+    Bucket& bucket = _buckets[hash & _mask];
+    const uint64_t k = key(hash);
+    // Try to insert into an empty slot first
+    for ( size_t i = 0; i < BUCKET_SIZE; ++i ) {
+      uint64_t current_key = bucket.keys[i].load(std::memory_order_relaxed);
+      if ( current_key == k ) {
+        // Already inserted by another thread
+        return;
+      } else if ( current_key == EMPTY_KEY &&
+                  bucket.keys[i].compare_exchange_strong(
+                    current_key, LOCKED_KEY, std::memory_order_relaxed) ) {
+        write(bucket, i, k, weight);
+        if ( _track_stats ) ++_insertions;
+        return;
+      }
+    }
+
+    // Bucket is full => evict an entry via the CLOCK algorithm. After at most
+    // BUCKET_SIZE + 1 steps, we find an entry without reference bit.
+    for ( size_t step = 0; step <= BUCKET_SIZE; ++step ) {
+      const size_t i = advanceClockHand(bucket);
+      const uint8_t bit = UL(1) << i;
+      if ( bucket.reference_bits.fetch_and(~bit, std::memory_order_relaxed) & bit ) {
+        // Give entry a second chance
+        continue;
+      }
+      uint64_t current_key = bucket.keys[i].load(std::memory_order_relaxed);
+      if ( current_key != LOCKED_KEY &&
+           bucket.keys[i].compare_exchange_strong(
+             current_key, LOCKED_KEY, std::memory_order_relaxed) ) {
+        write(bucket, i, k, weight);
+        if ( _track_stats ) {
+          ++_insertions;
+          ++_evictions;
+        }
+        return;
+      }
+      // Entry is currently written by another thread
+    }
+  }
+
+  Stats stats() const {
+    Stats stats;
+    stats.hits = _hits.load(std::memory_order_relaxed);
+    stats.misses = _misses.load(std::memory_order_relaxed);
+    stats.insertions = _insertions.load(std::memory_order_relaxed);
+    stats.evictions = _evictions.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+  size_t size_in_bytes() const {
+    return _buckets.size() * sizeof(Bucket);
+  }
+
+ private:
+  static uint64_t combine(const uint64_t left, const uint64_t hashed_right) {
+    return left ^ (hashed_right + UINT64_C(0x9e3779b97f4a7c15) + (left << 6) + (left >> 2));
+  }
+
+  // ! Maps the two reserved keys to valid keys
+  static uint64_t key(const uint64_t hash) {
+    return hash == EMPTY_KEY ? UL(1) : ( hash == LOCKED_KEY ? LOCKED_KEY - 1 : hash );
+  }
+
+  // ! Returns the current position of the clock hand and advances it. The hand
+  // ! is always kept in [0, BUCKET_SIZE) such that it never wraps unevenly.
+  static size_t advanceClockHand(Bucket& bucket) {
+    uint8_t hand = bucket.clock_hand.load(std::memory_order_relaxed);
+    while ( !bucket.clock_hand.compare_exchange_weak(hand,
+              static_cast<uint8_t>(( hand + 1 ) % BUCKET_SIZE), std::memory_order_relaxed) ) { }
+    return hand;
+  }
+
+  // ! Writes an entry whose key is locked by the calling thread
+  static void write(Bucket& bucket, const size_t i, const uint64_t key, const HyperedgeWeight weight) {
+    ASSERT(bucket.keys[i].load(std::memory_order_relaxed) == LOCKED_KEY);
+    bucket.weights[i].store(weight, std::memory_order_relaxed);
+    bucket.keys[i].store(key, std::memory_order_release);
+  }
+
+  uint64_t _mask;
+  mutable parallel::scalable_vector<Bucket> _buckets;
+  bool _track_stats;
+  mutable CAtomic<size_t> _hits;
+  mutable CAtomic<size_t> _misses;
+  CAtomic<size_t> _insertions;
+  CAtomic<size_t> _evictions;
+};
+
+}  // namespace mt_kahypar
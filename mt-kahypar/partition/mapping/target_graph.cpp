@@ -35,6 +35,11 @@
 namespace mt_kahypar {
 
 void TargetGraph::precomputeDistances(const size_t max_connectivity) {
+  if ( _topology ) {
+    // Distances are computed in closed form
+    _is_initialized = true;
+    return;
+  }
   const size_t num_entries = std::pow(_k, max_connectivity);
   if ( num_entries > MEMORY_LIMIT ) {
     ERR("Too much memory requested for precomputing steiner trees"
@@ -48,42 +53,26 @@ void TargetGraph::precomputeDistances(const size_t max_connectivity) {
 }
 
 HyperedgeWeight TargetGraph::distance(const ds::StaticBitset& connectivity_set) const {
+  if ( _topology ) {
+    if ( _cache.isTrackingStats() ) ++_stats.topology;
+    return _topology->distance(connectivity_set);
+  }
   const PartitionID connectivity = connectivity_set.popcount();
-  const size_t idx = index(connectivity_set);
   if ( likely(connectivity <= _max_precomputed_connectitivty) ) {
+    const size_t idx = index(connectivity_set);
     ASSERT(idx < _distances.size());
-    if constexpr ( TRACK_STATS ) ++_stats.precomputed;
+    if ( _cache.isTrackingStats() ) ++_stats.precomputed;
     return _distances[idx];
   } else {
     // We have not precomputed the optimal steiner tree for the connectivity set.
-    #ifdef __linux__
-    HashTableHandle& handle = _handles.local();
-    auto res = handle.find(idx);
-    if ( likely( res != handle.end() ) ) {
-      if constexpr ( TRACK_STATS ) ++_stats.cache_hits;
-      return (*res).second;
-    } else {
-      if constexpr ( TRACK_STATS ) ++_stats.cache_misses;
-      // Entry is not cached => Compute 2-approximation of optimal steiner tree
-      const HyperedgeWeight mst_weight =
-        computeWeightOfMSTOnMetricCompletion(connectivity_set);
-      handle.insert(idx, mst_weight);
-      return mst_weight;
-    }
-    #elif _WIN32
-    auto res = _cache.find(idx);
-    if ( likely ( res != _cache.end() ) ) {
-      if constexpr ( TRACK_STATS ) ++_stats.cache_hits;
-      return res->second;
-    } else {
-      if constexpr ( TRACK_STATS ) ++_stats.cache_misses;
+    const uint64_t hash = SteinerTreeCache::hash(connectivity_set);
+    HyperedgeWeight mst_weight = 0;
+    if ( !_cache.find(hash, mst_weight) ) {
       // Entry is not cached => Compute 2-approximation of optimal steiner tree
-      const HyperedgeWeight mst_weight =
-        computeWeightOfMSTOnMetricCompletion(connectivity_set);
-      _cache.insert(std::make_pair(idx, mst_weight));
-      return mst_weight;
+      mst_weight = computeWeightOfMSTOnMetricCompletion(connectivity_set);
+      _cache.insert(hash, mst_weight);
     }
-    #endif
+    return mst_weight;
   }
 }
 
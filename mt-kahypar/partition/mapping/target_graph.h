@@ -27,48 +27,30 @@
 #pragma once
 
 #include <queue>
+#include <memory>
 #include <numeric>
 #include <iostream>
 
 #include "tbb/enumerable_thread_specific.h"
 
-#ifdef __linux__
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wpedantic"
-#include "allocator/alignedallocator.hpp"
-#include "data-structures/hash_table_mods.hpp"
-#include "data-structures/table_config.hpp"
-#pragma GCC diagnostic pop
-#elif _WIN32
-#include "tbb/concurrent_unordered_map.h"
-#endif
-
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/datastructures/static_graph.h"
 #include "mt-kahypar/datastructures/static_bitset.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/partition/mapping/steiner_tree_cache.h"
+#include "mt-kahypar/partition/mapping/target_topology.h"
 
 namespace mt_kahypar {
 
 #ifdef KAHYPAR_ENABLE_STEINER_TREE_METRIC
 class TargetGraph {
 
-  static constexpr size_t INITIAL_HASH_TABLE_CAPACITY = 100000;
+  static constexpr size_t INITIAL_CACHE_CAPACITY = 100000;
   static constexpr size_t MEMORY_LIMIT = 100000000;
 
   using PQElement = std::pair<HyperedgeWeight, PartitionID>;
   using PQ = std::priority_queue<PQElement, vec<PQElement>, std::greater<PQElement>>;
 
-  #ifdef __linux__
-  using hasher_type    = utils_tm::hash_tm::murmur2_hash;
-  using allocator_type = growt::AlignedAllocator<>;
-  using ConcurrentHashTable = typename growt::table_config<
-    size_t, size_t, hasher_type, allocator_type, hmod::growable, hmod::sync>::table_type;
-  using HashTableHandle = typename ConcurrentHashTable::handle_type;
-  #elif _WIN32
-  using ConcurrentHashTable = tbb::concurrent_unordered_map<size_t, size_t>;
-  #endif
-
   struct MSTData {
     MSTData(const size_t n) :
       bitset(n),
@@ -83,16 +65,13 @@ class TargetGraph {
   struct Stats {
     Stats() :
       precomputed(0),
-      cache_misses(0),
-      cache_hits(0) { }
+      topology(0) { }
 
     CAtomic<size_t> precomputed;
-    CAtomic<size_t> cache_misses;
-    CAtomic<size_t> cache_hits;
+    CAtomic<size_t> topology;
   };
 
  public:
-  static constexpr bool TRACK_STATS = false;
 
   explicit TargetGraph(ds::StaticGraph&& graph) :
     _is_initialized(false),
@@ -101,11 +80,22 @@ class TargetGraph {
     _max_precomputed_connectitivty(0),
     _distances(),
     _local_mst_data(graph.initialNumNodes()),
-    _cache(INITIAL_HASH_TABLE_CAPACITY),
-     #ifdef __linux__
-    _handles([&]() { return getHandle(); }),
-     #endif
-    _stats() { }
+    _cache(INITIAL_CACHE_CAPACITY),
+    _stats(),
+    _topology(nullptr) { }
+
+  // ! Target graph whose distances are computed in closed form
+  // ! from a compact description of its topology
+  explicit TargetGraph(TargetTopology&& topology) :
+    _is_initialized(false),
+    _k(topology.numBlocks()),
+    _graph(topology.constructGraph()),
+    _max_precomputed_connectitivty(0),
+    _distances(),
+    _local_mst_data(topology.numBlocks()),
+    _cache(INITIAL_CACHE_CAPACITY),
+    _stats(),
+    _topology(std::make_unique<TargetTopology>(std::move(topology))) { }
 
   TargetGraph(const TargetGraph&) = delete;
   TargetGraph & operator= (const TargetGraph &) = delete;
@@ -125,8 +115,25 @@ class TargetGraph {
     return _graph;
   }
 
+  bool hasTopology() const {
+    return _topology != nullptr;
+  }
+
+  // ! Replaces the cache for steiner trees of non-precomputed connectivity sets
+  // ! by an empty cache with the given capacity (number of entries)
+  void initializeCache(const size_t capacity, const bool track_stats) {
+    _cache = SteinerTreeCache(capacity, track_stats);
+    _stats.precomputed.store(0, std::memory_order_relaxed);
+    _stats.topology.store(0, std::memory_order_relaxed);
+  }
+
+  bool isTrackingStats() const {
+    return _cache.isTrackingStats();
+  }
+
   // ! This function computes the weight of all steiner trees for all
   // ! connectivity sets with connectivity at most m (:= max_connectivity),
+  // ! If the target graph is described by its topology, nothing is precomputed.
   void precomputeDistances(const size_t max_conectivity);
 
   // ! Returns the weight of the optimal steiner tree between all blocks
@@ -185,28 +192,41 @@ class TargetGraph {
   // ! Returns the shortest path between two blocks in the target graph
   HyperedgeWeight distance(const PartitionID i, const PartitionID j) const {
     ASSERT(_is_initialized);
+    if ( _topology ) {
+      return _topology->distance(i, j);
+    }
     return _distances[index(i, j)];
   }
 
   // ! Print statistics
   void printStats() const {
-    const size_t total_requests = _stats.precomputed + _stats.cache_hits + _stats.cache_misses;
+    const SteinerTreeCache::Stats cache_stats = _cache.stats();
+    const size_t total_requests = _stats.precomputed + _stats.topology +
+      cache_stats.hits + cache_stats.misses;
     LOG << "\nTarget Graph Distance Computation Stats:";
     std::cout << "Accessed Precomputed Distance = " << std::setprecision(2)
               << (static_cast<double>(_stats.precomputed) / total_requests) * 100 << "% ("
               << _stats.precomputed << ")" << std::endl;
+    std::cout << "   Computed Topology Distance = " << std::setprecision(2)
+              << (static_cast<double>(_stats.topology) / total_requests) * 100 << "% ("
+              << _stats.topology << ")" << std::endl;
     std::cout << "                 Computed MST = " << std::setprecision(2)
-              << (static_cast<double>(_stats.cache_misses) / total_requests) * 100 << "% ("
-              << _stats.cache_misses << ")" << std::endl;
+              << (static_cast<double>(cache_stats.misses) / total_requests) * 100 << "% ("
+              << cache_stats.misses << ")" << std::endl;
     std::cout << "              Used Cached MST = " << std::setprecision(2)
-              << (static_cast<double>(_stats.cache_hits) / total_requests) * 100 << "% ("
-              << _stats.cache_hits << ")" << std::endl;
+              << (static_cast<double>(cache_stats.hits) / total_requests) * 100 << "% ("
+              << cache_stats.hits << ")" << std::endl;
+    std::cout << "         Evicted Cache Entries = " << cache_stats.evictions
+              << " (Capacity = " << _cache.capacity() << ")" << std::endl;
   }
 
   void printStats(std::stringstream& oss) const {
+    const SteinerTreeCache::Stats cache_stats = _cache.stats();
     oss << " used_precomputed_distance=" << _stats.precomputed
-        << " used_mst=" << _stats.cache_misses
-        << " used_cached_mst=" << _stats.cache_hits;
+        << " used_topology_distance=" << _stats.topology
+        << " used_mst=" << cache_stats.misses
+        << " used_cached_mst=" << cache_stats.hits
+        << " evicted_mst=" << cache_stats.evictions;
   }
 
  private:
@@ -236,12 +256,6 @@ class TargetGraph {
   // ! connecting u and v. This gives a 2-approximation for steiner tree problem.
   HyperedgeWeight computeWeightOfMSTOnMetricCompletion(const ds::StaticBitset& connectivity_set) const;
 
-  #ifdef __linux__
-  HashTableHandle getHandle() const {
-    return _cache.get_handle();
-  }
-  #endif
-
   bool _is_initialized;
 
   // ! Number of blocks
@@ -261,24 +275,22 @@ class TargetGraph {
   mutable tbb::enumerable_thread_specific<MSTData> _local_mst_data;
 
   // ! Cache stores the weight of MST computations
-  mutable ConcurrentHashTable _cache;
-
-  #ifdef __linux__
-  // ! Handle to access concurrent hash table
-  mutable tbb::enumerable_thread_specific<HashTableHandle> _handles;
-  #endif
+  mutable SteinerTreeCache _cache;
 
   // ! Stats
   mutable Stats _stats;
+
+  // ! Compact description of structured target graphs
+  std::unique_ptr<TargetTopology> _topology;
 };
 
 #else
 class TargetGraph {
  public:
-  static constexpr bool TRACK_STATS = false;
-
   explicit TargetGraph(ds::StaticGraph&&) { }
 
+  explicit TargetGraph(TargetTopology&&) { }
+
   TargetGraph(const TargetGraph&) = delete;
   TargetGraph & operator= (const TargetGraph &) = delete;
 
@@ -293,6 +305,12 @@ class TargetGraph {
     return false;
   }
 
+  void initializeCache(const size_t, const bool) { }
+
+  bool isTrackingStats() const {
+    return false;
+  }
+
   void precomputeDistances(const size_t) { }
 
   HyperedgeWeight distance(const ds::StaticBitset&) const {
@@ -0,0 +1,166 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/partition/mapping/target_topology.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "mt-kahypar/datastructures/static_graph_factory.h"
+
+namespace mt_kahypar {
+
+namespace {
+template<typename T>
+vec<T> parseList(const std::string& str) {
+  std::string tmp = str;
+  std::replace(tmp.begin(), tmp.end(), ':', ' ');
+  std::stringstream ss(tmp);
+  vec<T> values;
+  int64_t value;
+  while ( ss >> value ) {
+    values.push_back(static_cast<T>(value));
+  }
+  return values;
+}
+} // namespace
+
+TargetTopology::TargetTopology(const Type type,
+                               const vec<HypernodeID>& dimensions,
+                               const vec<HyperedgeWeight>& costs) :
+  _type(type),
+  _k(1),
+  _dimensions(dimensions),
+  _costs(costs),
+  _group_size(),
+  _local_coordinates() {
+  if ( _dimensions.empty() ) {
+    ERR("Target topology must have at least one level");
+  }
+  if ( _costs.empty() && _type == Type::torus ) {
+    _costs.assign(_dimensions.size(), 1);
+  }
+  if ( _costs.size() != _dimensions.size() ) {
+    ERR("Target topology has" << _dimensions.size() << "levels, but"
+      << _costs.size() << "communication costs are given");
+  }
+  for ( size_t i = 0; i < _dimensions.size(); ++i ) {
+    if ( _dimensions[i] == 0 ) {
+      ERR("Each level of the target topology must contain at least one element");
+    }
+    if ( _type == Type::hierarchy && i > 0 && _costs[i] < _costs[i - 1] ) {
+      ERR("Communication costs of a target hierarchy must be non-decreasing"
+        << "from the innermost to the outermost level");
+    }
+    _group_size.push_back(_k);
+    _k *= _dimensions[i];
+  }
+}
+
+TargetTopology TargetTopology::hierarchy(const vec<HypernodeID>& dimensions,
+                                         const vec<HyperedgeWeight>& costs) {
+  return TargetTopology(Type::hierarchy, dimensions, costs);
+}
+
+TargetTopology TargetTopology::torus(const vec<HypernodeID>& dimensions,
+                                     const vec<HyperedgeWeight>& costs) {
+  return TargetTopology(Type::torus, dimensions, costs);
+}
+
+TargetTopology TargetTopology::fromString(const Type type,
+                                          const std::string& dimensions,
+                                          const std::string& costs) {
+  return TargetTopology(type, parseList<HypernodeID>(dimensions),
+    parseList<HyperedgeWeight>(costs));
+}
+
+HyperedgeWeight TargetTopology::distance(const ds::StaticBitset& connectivity_set) const {
+  HyperedgeWeight weight = 0;
+  if ( _type == Type::hierarchy ) {
+    // The blocks of the connectivity set are enumerated in increasing order.
+    // Connecting consecutive blocks yields an MST of the ultrametric, since each
+    // group of a level is a contiguous range of blocks.
+    PartitionID last_block = kInvalidPartition;
+    for ( const PartitionID block : connectivity_set ) {
+      if ( last_block != kInvalidPartition ) {
+        weight += distance(last_block, block);
+      }
+      last_block = block;
+    }
+  } else {
+    vec<HypernodeID>& coordinates = _local_coordinates.local();
+    for ( size_t d = 0; d < _dimensions.size(); ++d ) {
+      coordinates.clear();
+      for ( const PartitionID block : connectivity_set ) {
+        coordinates.push_back(coordinate(block, d));
+      }
+      if ( coordinates.size() <= 1 ) break;
+      std::sort(coordinates.begin(), coordinates.end());
+      // The minimum circular interval covering all coordinates
+      // leaves out the largest gap between two consecutive coordinates
+      HypernodeID max_gap = coordinates[0] + _dimensions[d] - coordinates.back();
+      for ( size_t i = 1; i < coordinates.size(); ++i ) {
+        max_gap = std::max(max_gap, coordinates[i] - coordinates[i - 1]);
+      }
+      weight += _costs[d] * ( _dimensions[d] - max_gap );
+    }
+  }
+  return weight;
+}
+
+ds::StaticGraph TargetTopology::constructGraph() const {
+  using HyperedgeVector = parallel::scalable_vector<parallel::scalable_vector<HypernodeID>>;
+  HyperedgeVector edges;
+  vec<HyperedgeWeight> edge_weights;
+  if ( _type == Type::hierarchy ) {
+    for ( size_t l = 0; l < _dimensions.size(); ++l ) {
+      const PartitionID group_size = _group_size[l] * _dimensions[l];
+      for ( PartitionID group = 0; group < _k; group += group_size ) {
+        for ( HypernodeID i = 1; i < _dimensions[l]; ++i ) {
+          edges.push_back({ static_cast<HypernodeID>(group + ( i - 1 ) * _group_size[l]),
+                            static_cast<HypernodeID>(group + i * _group_size[l]) });
+          edge_weights.push_back(_costs[l]);
+        }
+      }
+    }
+  } else {
+    for ( PartitionID u = 0; u < _k; ++u ) {
+      for ( size_t d = 0; d < _dimensions.size(); ++d ) {
+        const HypernodeID x = coordinate(u, d);
+        // For a dimension of size two, both neighbors are the same processor
+        if ( _dimensions[d] > 2 || x + 1 < _dimensions[d] ) {
+          const PartitionID v = u - x * _group_size[d] +
+            ( ( x + 1 ) % _dimensions[d] ) * _group_size[d];
+          edges.push_back({ static_cast<HypernodeID>(u), static_cast<HypernodeID>(v) });
+          edge_weights.push_back(_costs[d]);
+        }
+      }
+    }
+  }
+  return ds::StaticGraphFactory::construct(_k, edges.size(), edges, edge_weights.data());
+}
+
+}  // namespace mt_kahypar
@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <string>
+
+#include "tbb/enumerable_thread_specific.h"
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/datastructures/static_graph.h"
+#include "mt-kahypar/datastructures/static_bitset.h"
+
+namespace mt_kahypar {
+
+/**
+ * Compact description of a structured target graph. Instead of storing the
+ * target graph explicitly and precomputing distances and steiner trees, we
+ * compute them in closed form in O(|set| * #levels) time from the description.
+ * We support two topologies:
+ *
+ * 1.) Hierarchy (e.g., cores/sockets/nodes/racks): Level l consists of a_l groups
+ *     of the level below. Two processors communicate with cost c_l, if l is the
+ *     highest level in which they are placed in different groups (same model as in
+ *     tools/hierarchical_process_graph_generator.cc). If the communication costs
+ *     are non-decreasing, the distances form an ultrametric and the optimal steiner
+ *     tree equals an MST, which connects consecutive processors of the set in
+ *     increasing order.
+ *
+ * 2.) Torus: A d-dimensional torus where each processor is connected to its direct
+ *     neighbors in each dimension with cost c_i. Distances are exact. The weight
+ *     of a connectivity set is the weighted sum of the minimum circular
+ *     intervals covering the coordinates of the set in each dimension. This
+ *     is exact for two processors and a lower bound on the optimal steiner tree
+ *     otherwise (similar to the half-perimeter wirelength estimate in VLSI design).
+ *
+ * Processor IDs are enumerated such that the innermost level (resp. first dimension)
+ * varies fastest.
+ */
+class TargetTopology {
+
+ public:
+  enum class Type : uint8_t {
+    hierarchy,
+    torus
+  };
+
+  // ! Dimensions and costs are given from the innermost to the outermost level
+  static TargetTopology hierarchy(const vec<HypernodeID>& dimensions,
+                                  const vec<HyperedgeWeight>& costs);
+
+  // ! If no costs are given, each link has unit cost
+  static TargetTopology torus(const vec<HypernodeID>& dimensions,
+                              const vec<HyperedgeWeight>& costs = {});
+
+  // ! Parses colon-separated dimensions and costs (e.g., "4:8:6" and "1:10:100")
+  static TargetTopology fromString(const Type type,
+                                   const std::string& dimensions,
+                                   const std::string& costs);
+
+  TargetTopology(const TargetTopology&) = delete;
+  TargetTopology & operator= (const TargetTopology &) = delete;
+
+  TargetTopology(TargetTopology&&) = default;
+  TargetTopology & operator= (TargetTopology &&) = default;
+
+  Type type() const {
+    return _type;
+  }
+
+  PartitionID numBlocks() const {
+    return _k;
+  }
+
+  // ! Returns the shortest path between two blocks in the target graph
+  HyperedgeWeight distance(const PartitionID i, const PartitionID j) const {
+    ASSERT(i < _k && j < _k);
+    HyperedgeWeight dist = 0;
+    if ( _type == Type::hierarchy ) {
+      if ( i != j ) {
+        size_t level = _dimensions.size() - 1;
+        while ( i / _group_size[level] == j / _group_size[level] ) {
+          --level;
+        }
+        dist = _costs[level];
+      }
+    } else {
+      for ( size_t d = 0; d < _dimensions.size(); ++d ) {
+        const HypernodeID x = coordinate(i, d);
+        const HypernodeID y = coordinate(j, d);
+        const HypernodeID diff = x < y ? y - x : x - y;
+        dist += _costs[d] * std::min(diff, _dimensions[d] - diff);
+      }
+    }
+    return dist;
+  }
+
+  // ! Returns the weight of the steiner tree connecting all blocks of the set
+  // ! (see class description)
+  HyperedgeWeight distance(const ds::StaticBitset& connectivity_set) const;
+
+  // ! Constructs a sparse graph representation of the topology. For tori, this is
+  // ! the torus itself. For hierarchies, the graph is a spanning tree in which
+  // ! each group is connected via a path between the first processors of its subgroups.
+  ds::StaticGraph constructGraph() const;
+
+ private:
+  TargetTopology(const Type type,
+                 const vec<HypernodeID>& dimensions,
+                 const vec<HyperedgeWeight>& costs);
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE HypernodeID coordinate(const PartitionID block,
+                                                            const size_t dimension) const {
+    return ( block / _group_size[dimension] ) % _dimensions[dimension];
+  }
+
+  Type _type;
+
+  // ! Number of processors
+  PartitionID _k;
+
+  // ! Fan-out of each level (resp. size of each dimension)
+  vec<HypernodeID> _dimensions;
+
+  // ! Communication cost of each level (resp. dimension)
+  vec<HyperedgeWeight> _costs;
+
+  // ! _group_size[i] = product of all dimensions below i
+  vec<PartitionID> _group_size;
+
+  // ! Thread-local buffer to sort the coordinates of a connectivity set
+  mutable tbb::enumerable_thread_specific<vec<HypernodeID>> _local_coordinates;
+};
+
+}  // namespace mt_kahypar
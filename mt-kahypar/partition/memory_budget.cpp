@@ -0,0 +1,273 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "memory_budget.h"
+
+#ifdef __linux__
+#include <sys/resource.h>
+#elif _WIN32
+#include <windows.h>
+#include <psapi.h>
+#endif
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/datastructures/sparse_pin_counts.h"
+#include "mt-kahypar/datastructures/pin_count_in_part.h"
+#include "mt-kahypar/datastructures/connectivity_set.h"
+#include "mt-kahypar/datastructures/priority_queue.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/memory_tree.h"
+#include "mt-kahypar/utils/utilities.h"
+
+namespace mt_kahypar {
+
+  namespace {
+    static constexpr size_t MEGABYTE = 1024 * 1024;
+    // Thread-local delta partitions of localized FM searches only store the pin counts
+    // and gains of the hyperedges and nodes touched by the search. We bound the
+    // number of entries per thread to obtain an estimate of their memory consumption.
+    static constexpr size_t MAX_DELTA_ENTRIES_PER_THREAD = UL(1) << 22;
+    static constexpr size_t SIZE_OF_DELTA_ENTRY = 16;
+
+    size_t to_megabyte(const size_t size_in_bytes) {
+      return size_in_bytes / MEGABYTE;
+    }
+
+    bool useSparsePinCounts(const Context& context) {
+      return context.partition.preset_type == PresetType::large_k ||
+        context.partition.partition_type == LARGE_K_PARTITIONING;
+    }
+
+    // ! Returns the peak resident set size of the process in bytes
+    size_t peakResidentSetSize() {
+      #ifdef __linux__
+      struct rusage usage;
+      if ( getrusage(RUSAGE_SELF, &usage) != 0 ) {
+        return 0;
+      }
+      return static_cast<size_t>(usage.ru_maxrss) * 1024;
+      #elif _WIN32
+      PROCESS_MEMORY_COUNTERS counters;
+      if ( !GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) ) {
+        return 0;
+      }
+      return static_cast<size_t>(counters.PeakWorkingSetSize);
+      #else
+      return 0;
+      #endif
+    }
+
+    template<typename Hypergraph>
+    size_t inputSize(const Hypergraph& hypergraph) {
+      utils::MemoryTreeNode input("Input");
+      hypergraph.memoryConsumption(&input);
+      input.finalize();
+      return input.size_in_bytes();
+    }
+
+    // ! Memory of the star expansion graph used by the community detection
+    template<typename Hypergraph>
+    size_t preprocessingMemory(const Hypergraph& hypergraph, const Context& context) {
+      if ( !context.preprocessing.use_community_detection ) {
+        return 0;
+      }
+      const size_t num_nodes = hypergraph.initialNumNodes() +
+        ( Hypergraph::is_graph ? 0 : hypergraph.initialNumEdges() );
+      const size_t num_arcs = ( Hypergraph::is_graph ? 1 : 2 ) * hypergraph.initialNumPins();
+      size_t memory = ( num_nodes + 1 ) * sizeof(size_t) + num_arcs * sizeof(Arc) + num_nodes * sizeof(ArcWeight);
+      if ( !context.preprocessing.community_detection.low_memory_contraction ) {
+        // Temporary buffers of the parallel contraction
+        memory += ( 2 * num_nodes + 1 ) * sizeof(size_t) + num_arcs * ( sizeof(Arc) + sizeof(size_t) ) +
+          num_nodes * sizeof(ArcWeight);
+      }
+      // The contracted graphs of the louvain levels
+      return 2 * memory;
+    }
+
+    // ! Memory of the coarse hypergraphs and the temporary buffers used during contraction
+    template<typename Hypergraph>
+    size_t coarseningMemory(const Hypergraph& hypergraph, const Context& context, const size_t input_size) {
+      const size_t num_nodes = hypergraph.initialNumNodes();
+      const size_t num_edges = hypergraph.initialNumEdges();
+      if ( context.isNLevelPartitioning() ) {
+        // The dynamic hypergraph is contracted in-place, but
+        // stores the contraction forest and the uncontraction batches
+        return num_nodes * ( 4 * sizeof(HypernodeID) + sizeof(Memento) );
+      }
+      // Each level reduces the number of nodes at least by half, so all coarse levels
+      // together require at most as much memory as the input. The contraction buffers
+      // roughly correspond to a temporary copy of the current hypergraph.
+      return 2 * input_size + num_nodes * ( 2 * sizeof(size_t) + sizeof(HypernodeWeight) ) +
+        num_edges * 2 * sizeof(size_t);
+    }
+
+    // ! Memory of the partitioned hypergraph and the refinement algorithms
+    template<typename Hypergraph>
+    size_t refinementMemory(const Hypergraph& hypergraph, const Context& context) {
+      const size_t num_nodes = hypergraph.initialNumNodes();
+      const size_t num_edges = hypergraph.initialNumEdges();
+      const size_t k = context.partition.k;
+      const bool use_fm = context.refinement.fm.algorithm != FMAlgorithm::do_nothing;
+
+      size_t memory = num_nodes * sizeof(PartitionID);
+      if ( Hypergraph::is_graph ) {
+        memory += num_edges * ( sizeof(SpinLock) + StaticPartitionedGraph::SIZE_OF_EDGE_LOCK );
+        if ( use_fm ) {
+          // Incident weight in each block
+          memory += num_nodes * ( k + 1 ) * sizeof(CAtomic<HyperedgeWeight>);
+        }
+      } else {
+        const HypernodeID max_he_size = hypergraph.maxEdgeSize();
+        if ( useSparsePinCounts(context) ) {
+          memory += ds::SparsePinCounts::num_elements(num_edges, k, max_he_size) *
+            sizeof(ds::SparsePinCounts::Value);
+        } else {
+          memory += ds::PinCountInPart::num_elements(num_edges, k, max_he_size) *
+            sizeof(ds::PinCountInPart::Value);
+          memory += ds::ConnectivitySets::num_elements(num_edges, k) *
+            sizeof(ds::ConnectivitySets::UnsafeBlock);
+        }
+        memory += num_edges * sizeof(SpinLock);
+        if ( use_fm ) {
+          // Gain Cache
+          memory += num_nodes * ( k + 1 ) * sizeof(CAtomic<HyperedgeWeight>);
+          if ( context.partition.objective == Objective::steiner_tree ) {
+            memory += num_nodes * k * sizeof(CAtomic<HyperedgeID>);
+          }
+        }
+      }
+
+      if ( use_fm ) {
+        // Shared FM data
+        memory += num_nodes * ( sizeof(PosT) + sizeof(Move) + sizeof(MoveID) +
+          sizeof(SearchID) + sizeof(PartitionID) );
+        if ( !context.refinement.fm.perform_moves_global ) {
+          memory += context.shared_memory.num_threads * SIZE_OF_DELTA_ENTRY *
+            std::min(MAX_DELTA_ENTRIES_PER_THREAD, num_nodes + num_edges);
+        }
+      }
+      return memory;
+    }
+  }
+
+  template<typename Hypergraph>
+  size_t estimatePeakMemoryConsumption(const Hypergraph& hypergraph, const Context& context) {
+    const size_t input_size = inputSize(hypergraph);
+    // The memory of the community detection is released before coarsening starts. The buffers
+    // of the contraction are reused for the refinement data structures (see memory pool).
+    const size_t coarsening_memory = coarseningMemory(hypergraph, context, input_size);
+    const size_t refinement_memory = refinementMemory(hypergraph, context);
+    return input_size + std::max(preprocessingMemory(hypergraph, context),
+      std::max(coarsening_memory, input_size + refinement_memory));
+  }
+
+  void applyMemoryBudget(const mt_kahypar_hypergraph_t hypergraph, Context& context) {
+    if ( hypergraph.type == STATIC_GRAPH ) {
+      applyMemoryBudget(utils::cast_const<ds::StaticGraph>(hypergraph), context);
+    } else if ( hypergraph.type == DYNAMIC_GRAPH ) {
+      applyMemoryBudget(utils::cast_const<ds::DynamicGraph>(hypergraph), context);
+    } else if ( hypergraph.type == STATIC_HYPERGRAPH ) {
+      applyMemoryBudget(utils::cast_const<ds::StaticHypergraph>(hypergraph), context);
+    } else if ( hypergraph.type == DYNAMIC_HYPERGRAPH ) {
+      applyMemoryBudget(utils::cast_const<ds::DynamicHypergraph>(hypergraph), context);
+    }
+  }
+
+  template<typename Hypergraph>
+  void applyMemoryBudget(const Hypergraph& hypergraph, Context& context) {
+    size_t estimate = estimatePeakMemoryConsumption(hypergraph, context);
+    const size_t budget = context.partition.memory_budget * MEGABYTE;
+
+    // Applies the lower-memory alternative, if the current estimate exceeds the
+    // budget and the alternative actually reduces the estimated peak memory
+    auto try_alternative = [&](const bool applicable, const std::string& description, auto apply) {
+      if ( budget > 0 && estimate > budget && applicable ) {
+        Context tmp_context(context);
+        apply(tmp_context);
+        const size_t new_estimate = estimatePeakMemoryConsumption(hypergraph, tmp_context);
+        if ( new_estimate < estimate ) {
+          if ( context.partition.verbose_output ) {
+            LOG << "Estimated peak memory of" << to_megabyte(estimate) << "MB exceeds memory budget of"
+                << context.partition.memory_budget << "MB =>" << description;
+          }
+          apply(context);
+          estimate = new_estimate;
+        }
+      }
+    };
+
+    try_alternative(context.preprocessing.use_community_detection &&
+      !context.preprocessing.community_detection.low_memory_contraction,
+      "Use low-memory contraction in community detection", [](Context& c) {
+        c.preprocessing.community_detection.low_memory_contraction = true;
+      });
+    try_alternative(context.refinement.fm.algorithm != FMAlgorithm::do_nothing &&
+      !context.refinement.fm.perform_moves_global,
+      "Apply FM moves directly to the global partition", [](Context& c) {
+        c.refinement.fm.perform_moves_global = true;
+      });
+    #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+    try_alternative(context.partition.partition_type == MULTILEVEL_HYPERGRAPH_PARTITIONING,
+      "Use sparse pin count data structure", [](Context& c) {
+        c.partition.partition_type = LARGE_K_PARTITIONING;
+      });
+    #endif
+    try_alternative(context.refinement.fm.algorithm != FMAlgorithm::do_nothing,
+      "Disable FM refinement (no gain cache)", [](Context& c) {
+        c.refinement.fm.algorithm = FMAlgorithm::do_nothing;
+        c.refinement.global_fm.use_global_fm = false;
+      });
+
+    if ( budget > 0 && estimate > budget ) {
+      WARNING("Estimated peak memory of" << to_megabyte(estimate) << "MB still exceeds memory budget of"
+        << context.partition.memory_budget << "MB");
+    }
+    context.partition.predicted_peak_memory = estimate;
+  }
+
+  void reportPeakMemoryConsumption(const Context& context) {
+    const size_t actual_peak_memory = peakResidentSetSize();
+    utils::Stats& stats = utils::Utilities::instance().getStats(context.utility_id);
+    stats.add_stat("predicted_peak_memory_mb", static_cast<int64_t>(to_megabyte(context.partition.predicted_peak_memory)));
+    stats.add_stat("actual_peak_memory_mb", static_cast<int64_t>(to_megabyte(actual_peak_memory)));
+    if ( context.partition.verbose_output && context.partition.memory_budget > 0 ) {
+      LOG << "Peak Memory Consumption:";
+      LOG << "  Budget    =" << context.partition.memory_budget << "MB";
+      LOG << "  Predicted =" << to_megabyte(context.partition.predicted_peak_memory) << "MB";
+      LOG << "  Actual    =" << to_megabyte(actual_peak_memory) << "MB";
+    }
+  }
+
+  namespace {
+  #define ESTIMATE_PEAK_MEMORY_CONSUMPTION(X) size_t estimatePeakMemoryConsumption(const X& hypergraph, const Context& context)
+  #define APPLY_MEMORY_BUDGET(X) void applyMemoryBudget(const X& hypergraph, Context& context)
+  }
+
+  INSTANTIATE_FUNC_WITH_HYPERGRAPHS(ESTIMATE_PEAK_MEMORY_CONSUMPTION)
+  INSTANTIATE_FUNC_WITH_HYPERGRAPHS(APPLY_MEMORY_BUDGET)
+
+} // namespace mt_kahypar
@@ -0,0 +1,51 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include "include/libmtkahypartypes.h"
+
+#include "mt-kahypar/partition/context.h"
+
+namespace mt_kahypar {
+
+// ! Estimates the peak memory consumption (in bytes) of partitioning the
+// ! hypergraph with the given configuration
+template<typename Hypergraph>
+size_t estimatePeakMemoryConsumption(const Hypergraph& hypergraph, const Context& context);
+
+// ! If a memory budget is specified, we switch to lower-memory alternatives
+// ! of the configured algorithms until the estimated peak memory consumption
+// ! fits into the budget. Must be called before the memory pool is initialized.
+void applyMemoryBudget(const mt_kahypar_hypergraph_t hypergraph, Context& context);
+
+template<typename Hypergraph>
+void applyMemoryBudget(const Hypergraph& hypergraph, Context& context);
+
+// ! Reports the predicted and the actual peak memory consumption
+void reportPeakMemoryConsumption(const Context& context);
+
+} // namespace mt_kahypar
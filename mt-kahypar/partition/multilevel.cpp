@@ -56,7 +56,9 @@ namespace {
   void disableTimerAndStats(const Context& context) {
     if ( context.type == ContextType::main && context.partition.mode == Mode::direct ) {
       utils::Utilities& utils = utils::Utilities::instance();
-      parallel::MemoryPool::instance().deactivate_unused_memory_allocations();
+      if ( context.shared_memory.manage_memory_pool ) {
+        parallel::MemoryPool::instance().deactivate_unused_memory_allocations();
+      }
       utils.getTimer(context.utility_id).disable();
       utils.getStats(context.utility_id).disable();
     }
@@ -65,7 +67,9 @@ namespace {
   void enableTimerAndStats(const Context& context) {
     if ( context.type == ContextType::main && context.partition.mode == Mode::direct ) {
       utils::Utilities& utils = utils::Utilities::instance();
-      parallel::MemoryPool::instance().activate_unused_memory_allocations();
+      if ( context.shared_memory.manage_memory_pool ) {
+        parallel::MemoryPool::instance().activate_unused_memory_allocations();
+      }
       utils.getTimer(context.utility_id).enable();
       utils.getStats(context.utility_id).enable();
     }
@@ -138,11 +142,13 @@ namespace {
       degree_zero_hn_remover.restoreDegreeZeroHypernodes(phg);
     } else {
       // When performing a V-cycle, we store the block IDs
-      // of the input hypergraph as community IDs
+      // of the input hypergraph as community IDs. A combine operation
+      // of the evolutionary algorithm encodes the blocks of two parents
+      // as p_1 + k * p_2, which is why we use the ID modulo k.
       const Hypergraph& hypergraph = phg.hypergraph();
       phg.doParallelForAllNodes([&](const HypernodeID hn) {
-        const PartitionID part_id = hypergraph.communityID(hn);
-        ASSERT(part_id != kInvalidPartition && part_id < context.partition.k);
+        ASSERT(hypergraph.communityID(hn) >= 0);
+        const PartitionID part_id = hypergraph.communityID(hn) % context.partition.k;
         ASSERT(phg.partID(hn) == kInvalidPartition);
         phg.setOnlyNodePart(hn, part_id);
       });
@@ -225,16 +231,9 @@ void Multilevel<TypeTraits>::partitionVCycle(Hypergraph& hypergraph,
 
   for ( size_t i = 0; i < context.partition.num_vcycles; ++i ) {
     // Reset memory pool
-    hypergraph.reset();
     parallel::MemoryPool::instance().reset();
     parallel::MemoryPool::instance().release_mem_group("Preprocessing");
 
-    if ( context.isNLevelPartitioning() ) {
-      // Workaround: reset() function of hypergraph reinserts all removed hyperedges again.
-      LargeHyperedgeRemover<TypeTraits> large_he_remover(context);
-      large_he_remover.removeLargeHyperedgesInNLevelVCycle(hypergraph);
-    }
-
     // The block IDs of the current partition are stored as community IDs.
     // This way coarsening does not contract nodes that do not belong to same block
     // of the input partition. For initial partitioning, we use the community IDs of
@@ -245,9 +244,21 @@ void Multilevel<TypeTraits>::partitionVCycle(Hypergraph& hypergraph,
 
     // Perform V-cycle
     io::printVCycleBanner(context, i + 1);
-    partitioned_hg = multilevel_partitioning<TypeTraits>(
-      hypergraph, context, target_graph, true /* V-cycle flag */ );
+    partitioned_hg = vcycle(hypergraph, context, target_graph);
+  }
+}
+
+template<typename TypeTraits>
+typename Multilevel<TypeTraits>::PartitionedHypergraph Multilevel<TypeTraits>::vcycle(
+  Hypergraph& hypergraph, const Context& context, const TargetGraph* target_graph) {
+  hypergraph.reset();
+  if ( context.isNLevelPartitioning() ) {
+    // Workaround: reset() function of hypergraph reinserts all removed hyperedges again.
+    LargeHyperedgeRemover<TypeTraits> large_he_remover(context);
+    large_he_remover.removeLargeHyperedgesInNLevelVCycle(hypergraph);
   }
+  return multilevel_partitioning<TypeTraits>(
+    hypergraph, context, target_graph, true /* V-cycle flag */ );
 }
 
 INSTANTIATE_CLASS_WITH_TYPE_TRAITS(Multilevel)
@@ -57,6 +57,14 @@ class Multilevel {
                               PartitionedHypergraph& partitioned_hg,
                               const Context& context,
                               const TargetGraph* target_graph = nullptr);
+
+  // ! Performs a single V-cycle. Coarsening does not contract nodes with different
+  // ! community IDs and the community IDs (modulo k) of the coarsest hypergraph are
+  // ! used as initial partition. Thus, the caller must store a partition
+  // ! (or a refinement of it) as community IDs in the hypergraph.
+  static PartitionedHypergraph vcycle(Hypergraph& hypergraph,
+                                      const Context& context,
+                                      const TargetGraph* target_graph = nullptr);
 };
 
 }  // namespace mt_kahypar
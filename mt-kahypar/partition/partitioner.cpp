@@ -29,6 +29,7 @@
 
 #include "tbb/parallel_sort.h"
 #include "tbb/parallel_reduce.h"
+#include "tbb/task_arena.h"
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/io/partitioning_output.h"
@@ -38,6 +39,8 @@
 #include "mt-kahypar/partition/preprocessing/community_detection/parallel_louvain.h"
 #include "mt-kahypar/partition/recursive_bipartitioning.h"
 #include "mt-kahypar/partition/deep_multilevel.h"
+#include "mt-kahypar/partition/evolutionary.h"
+#include "mt-kahypar/partition/initial_partitioning/pool_initial_partitioner.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
 #ifdef KAHYPAR_ENABLE_STEINER_TREE_METRIC
 #include "mt-kahypar/partition/mapping/initial_mapping.h"
@@ -87,12 +90,12 @@ namespace mt_kahypar {
         const double covered_pins_percentage =
           static_cast<double>(tbb::parallel_reduce(
             tbb::blocked_range<size_t>(UL(0), percentile),
-            0, [&](const tbb::blocked_range<size_t>& range, int init) {
+            UL(0), [&](const tbb::blocked_range<size_t>& range, size_t init) {
                   for ( size_t i = range.begin(); i < range.end(); ++i ) {
                     init += he_sizes[i];
                   }
                   return init;
-                }, [&](const int lhs, const int rhs) {
+                }, [&](const size_t lhs, const size_t rhs) {
                   return lhs + rhs;
                 })) / hypergraph.initialNumPins();
         if ( covered_pins_percentage >= context.mapping.min_pin_coverage_of_largest_hes ) {
@@ -228,6 +231,8 @@ namespace mt_kahypar {
       const size_t max_steiner_tree_size = std::min(
         std::min(context.mapping.max_steiner_tree_size, UL(context.partition.k)),
         static_cast<size_t>(hypergraph.maxEdgeSize()));
+      target_graph->initializeCache(context.mapping.steiner_tree_cache_capacity,
+        context.mapping.track_steiner_tree_cache_stats);
       target_graph->precomputeDistances(max_steiner_tree_size);
       timer.stop_timer("precompute_steiner_trees");
     }
@@ -276,9 +281,48 @@ namespace mt_kahypar {
     parallel::MemoryPool::instance().release_mem_group("Preprocessing");
   }
 
+  // ! For small inputs, the overheads of the parallel code paths (task scheduling,
+  // ! contention on shared data structures) outweigh their benefits. If enabled
+  // ! (sequential_pin_threshold > 0), inputs with at most that many pins are partitioned
+  // ! on a single thread.
+  // ! The deterministic preset is excluded, since the fast path changes the number of threads it runs with.
+  template<typename Hypergraph>
+  bool useSequentialFastPath(const Hypergraph& hypergraph, const Context& context) {
+    return context.shared_memory.num_threads > 1 &&
+      context.shared_memory.sequential_pin_threshold > 0 &&
+      hypergraph.initialNumPins() <= context.shared_memory.sequential_pin_threshold &&
+      context.partition.preset_type != PresetType::deterministic &&
+      !context.isEvolutionaryPartitioning();
+  }
+
+  // ! Calls f with a single-threaded copy of the context inside a task arena with one thread.
+  // ! Afterwards, the context receives all changes made by f except for the number of threads.
+  template<typename F>
+  void runSequentially(Context& context, const F& f) {
+    utils::Utilities::instance().getStats(context.utility_id).add_stat("sequential_fast_path", true);
+    Context sequential_context(context);
+    sequential_context.shared_memory.num_threads = 1;
+    sequential_context.shared_memory.original_num_threads = 1;
+    tbb::task_arena sequential_arena(1);
+    sequential_arena.execute([&] {
+      f(sequential_context);
+    });
+    sequential_context.shared_memory.num_threads = context.shared_memory.num_threads;
+    sequential_context.shared_memory.original_num_threads = context.shared_memory.original_num_threads;
+    context = sequential_context;
+  }
+
   template<typename TypeTraits>
   typename Partitioner<TypeTraits>::PartitionedHypergraph Partitioner<TypeTraits>::partition(
     Hypergraph& hypergraph, Context& context, TargetGraph* target_graph) {
+    if ( useSequentialFastPath(hypergraph, context) ) {
+      PartitionedHypergraph partitioned_hypergraph;
+      runSequentially(context, [&](Context& sequential_context) {
+        partitioned_hypergraph = partition(hypergraph, sequential_context, target_graph);
+      });
+      return partitioned_hypergraph;
+    }
+
     configurePreprocessing(hypergraph, context);
     setupContext(hypergraph, context, target_graph);
 
@@ -307,7 +351,9 @@ namespace mt_kahypar {
 
     // ################## MULTILEVEL & VCYCLE ##################
     PartitionedHypergraph partitioned_hypergraph;
-    if (context.partition.mode == Mode::direct) {
+    if (context.partition.mode == Mode::direct && context.isEvolutionaryPartitioning()) {
+      partitioned_hypergraph = Evolutionary<TypeTraits>::partition(hypergraph, context, target_graph);
+    } else if (context.partition.mode == Mode::direct) {
       partitioned_hypergraph = Multilevel<TypeTraits>::partition(hypergraph, context, target_graph);
     } else if (context.partition.mode == Mode::recursive_bipartitioning) {
       partitioned_hypergraph = RecursiveBipartitioning<TypeTraits>::partition(hypergraph, context, target_graph);
@@ -317,6 +363,7 @@ namespace mt_kahypar {
     } else {
       ERR("Invalid mode: " << context.partition.mode);
     }
+    Pool<TypeTraits>::releaseWorkspaces();
 
     // ################## POSTPROCESSING ##################
     timer.start_timer("postprocessing", "Postprocessing");
@@ -350,6 +397,13 @@ namespace mt_kahypar {
                                                 Context& context,
                                                 TargetGraph* target_graph) {
     Hypergraph& hypergraph = partitioned_hg.hypergraph();
+    if ( useSequentialFastPath(hypergraph, context) ) {
+      runSequentially(context, [&](Context& sequential_context) {
+        partitionVCycle(partitioned_hg, sequential_context, target_graph);
+      });
+      return;
+    }
+
     configurePreprocessing(hypergraph, context);
     setupContext(hypergraph, context, target_graph);
 
@@ -378,6 +432,7 @@ namespace mt_kahypar {
     } else {
       ERR("Invalid V-cycle mode: " << context.partition.mode);
     }
+    Pool<TypeTraits>::releaseWorkspaces();
 
     // ################## POSTPROCESSING ##################
     timer.start_timer("postprocessing", "Postprocessing");
@@ -27,14 +27,20 @@
 
 #include "mt-kahypar/partition/partitioner_facade.h"
 
+#include "tbb/enumerable_thread_specific.h"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/partitioner.h"
+#include "mt-kahypar/partition/memory_budget.h"
 #include "mt-kahypar/io/partitioning_output.h"
 #include "mt-kahypar/io/hypergraph_io.h"
 #include "mt-kahypar/io/csv_output.h"
 #include "mt-kahypar/io/sql_plottools_serializer.h"
 #include "mt-kahypar/utils/cast.h"
 #include "mt-kahypar/utils/randomize.h"
+#include "mt-kahypar/utils/utilities.h"
 #include "mt-kahypar/partition/conversion.h"
 
 namespace mt_kahypar {
@@ -52,6 +58,7 @@ namespace internal {
     // Partition Hypergraph
     PartitionedHypergraph partitioned_hg =
       Partitioner<TypeTraits>::partition(hg, context, target_graph);
+    reportPeakMemoryConsumption(context);
 
     return mt_kahypar_partitioned_hypergraph_t {
       reinterpret_cast<mt_kahypar_partitioned_hypergraph_s*>(
@@ -91,13 +98,44 @@ namespace internal {
     #endif
   }
 
+  // ! Resources of a thread that partitions instances of a batch. The single-threaded
+  // ! task arena ensures that the parallel constructs within the partitioner do not
+  // ! steal work from other instances of the batch. The random number generators
+  // ! make the result of an instance independent of the other instances.
+  struct BatchWorkspace {
+    BatchWorkspace() :
+      arena(1),
+      rand(),
+      utility_id(utils::Utilities::instance().registerNewUtilityObjects()) { }
+
+    tbb::task_arena arena;
+    utils::Randomize rand;
+    const size_t utility_id;
+  };
+
+  BatchWorkspace& local_batch_workspace() {
+    // Workspaces are reused across batches. They are intentionally never
+    // destroyed, since task arenas must not outlive the TBB runtime.
+    static auto* workspaces = new tbb::enumerable_thread_specific<BatchWorkspace>();
+    return workspaces->local();
+  }
+
 } // namespace internal
 
   mt_kahypar_partitioned_hypergraph_t PartitionerFacade::partition(mt_kahypar_hypergraph_t hypergraph,
                                                                    Context& context,
                                                                    TargetGraph* target_graph) {
-    const mt_kahypar_partition_type_t type = to_partition_c_type(
-      context.partition.preset_type, context.partition.instance_type);
+    if ( context.partition.predicted_peak_memory == 0 ) {
+      // Callers that initialize the memory pool must apply the
+      // memory budget before, otherwise we do it here
+      applyMemoryBudget(hypergraph, context);
+    }
+
+    // The partition type can differ from the preset, e.g., if we switch to
+    // sparse pin counts in order to stay within a memory budget
+    const mt_kahypar_partition_type_t type = context.partition.partition_type != NULLPTR_PARTITION ?
+      context.partition.partition_type : to_partition_c_type(
+        context.partition.preset_type, context.partition.instance_type);
     internal::check_if_feature_is_enabled(type);
     switch ( type ) {
       #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
@@ -125,6 +163,36 @@ namespace internal {
   }
 
 
+  void PartitionerFacade::partitionBatch(const mt_kahypar_hypergraph_t* hypergraphs,
+                                         const size_t num_hypergraphs,
+                                         const Context& context,
+                                         mt_kahypar_partitioned_hypergraph_t* partitioned_hgs) {
+    tbb::parallel_for(UL(0), num_hypergraphs, [&](const size_t i) {
+      internal::BatchWorkspace& workspace = internal::local_batch_workspace();
+      utils::Utilities& utils = utils::Utilities::instance();
+      utils.getTimer(workspace.utility_id).clear();
+      utils.getStats(workspace.utility_id).clear();
+
+      Context instance_context(context);
+      instance_context.partition.instance_type = to_instance_type(hypergraphs[i].type);
+      instance_context.partition.partition_type = to_partition_c_type(
+        instance_context.partition.preset_type, instance_context.partition.instance_type);
+      instance_context.partition.verbose_output = false;
+      instance_context.shared_memory.original_num_threads = 1;
+      instance_context.shared_memory.num_threads = 1;
+      instance_context.utility_id = workspace.utility_id;
+      // The memory pool is shared by all instances of the batch
+      instance_context.shared_memory.manage_memory_pool = false;
+      workspace.rand.setSeed(instance_context.partition.seed);
+      workspace.arena.execute([&] {
+        utils::Randomize* bound_rand = utils::Randomize::boundInstance();
+        utils::Randomize::bind(&workspace.rand);
+        partitioned_hgs[i] = partition(hypergraphs[i], instance_context);
+        utils::Randomize::bind(bound_rand);
+      });
+    }, tbb::simple_partitioner());
+  }
+
   void PartitionerFacade::improve(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                                   Context& context,
                                   TargetGraph* target_graph) {
@@ -43,6 +43,15 @@ class PartitionerFacade {
                                                        Context& context,
                                                        TargetGraph* target_graph = nullptr);
 
+  // ! Partitions several (hyper)graphs with the same configuration. Instances are
+  // ! distributed across threads and each instance is partitioned sequentially
+  // ! by a single thread, which avoids the overheads of the parallel code paths
+  // ! for small inputs. Writes the partition of hypergraphs[i] to partitioned_hgs[i].
+  static void partitionBatch(const mt_kahypar_hypergraph_t* hypergraphs,
+                             const size_t num_hypergraphs,
+                             const Context& context,
+                             mt_kahypar_partitioned_hypergraph_t* partitioned_hgs);
+
   // ! Improves a given partition
   static void improve(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                       Context& context,
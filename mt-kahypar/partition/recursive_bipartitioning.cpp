@@ -345,7 +345,9 @@ void RecursiveBipartitioning<TypeTraits>::partition(PartitionedHypergraph& hyper
   }
 
   if (context.type == ContextType::main) {
-    parallel::MemoryPool::instance().deactivate_unused_memory_allocations();
+    if ( context.shared_memory.manage_memory_pool ) {
+      parallel::MemoryPool::instance().deactivate_unused_memory_allocations();
+    }
     utils.getTimer(context.utility_id).disable();
     utils.getStats(context.utility_id).disable();
   }
@@ -370,7 +372,9 @@ void RecursiveBipartitioning<TypeTraits>::partition(PartitionedHypergraph& hyper
       rb_context.partition.epsilon }, already_cut);
 
   if (context.type == ContextType::main) {
-    parallel::MemoryPool::instance().activate_unused_memory_allocations();
+    if ( context.shared_memory.manage_memory_pool ) {
+      parallel::MemoryPool::instance().activate_unused_memory_allocations();
+    }
     utils.getTimer(context.utility_id).enable();
     utils.getStats(context.utility_id).enable();
   }
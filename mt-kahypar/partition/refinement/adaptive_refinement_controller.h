@@ -0,0 +1,169 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <string>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/utils/efficiency_estimator.h"
+#include "mt-kahypar/utils/utilities.h"
+
+namespace mt_kahypar {
+
+/*!
+ * Decides on each level of the multilevel hierarchy which refinement algorithms are executed.
+ * For each refiner, we track its improvement per second (efficiency) on the previous levels
+ * as an exponential moving average. A refiner is skipped on the next level, if its efficiency
+ * is smaller than min_relative_efficiency times the overall efficiency of all refiners
+ * executed on the previous levels. Since the behavior of the refiners changes on finer levels,
+ * a skipped refiner is executed again after probe_interval levels to re-evaluate its efficiency.
+ * Setting min_relative_efficiency to zero executes all refiners on all levels, larger values
+ * trade solution quality for running time.
+ */
+class AdaptiveRefinementController {
+
+  static constexpr bool debug = false;
+
+ public:
+  enum class Refiner : uint8_t {
+    label_propagation = 0,
+    fm = 1,
+    flows = 2
+  };
+
+ private:
+  static constexpr size_t NUM_REFINERS = 3;
+
+  struct RefinerState {
+    utils::EfficiencyEstimator efficiency;
+    bool run_on_current_level = true;
+    size_t levels_since_last_run = 0;
+    HyperedgeWeight level_gain = 0;
+    double level_time = 0.0;
+    size_t num_executed_levels = 0;
+    size_t num_skipped_levels = 0;
+  };
+
+ public:
+  explicit AdaptiveRefinementController(const Context& context) :
+    _context(context),
+    _states(),
+    _overall_efficiency() { }
+
+  AdaptiveRefinementController(const AdaptiveRefinementController&) = delete;
+  AdaptiveRefinementController(AdaptiveRefinementController&&) = delete;
+  AdaptiveRefinementController & operator= (const AdaptiveRefinementController &) = delete;
+  AdaptiveRefinementController & operator= (AdaptiveRefinementController &&) = delete;
+
+  // ! Decides which refiners are executed on the next level.
+  // ! Must be called before refinement starts on a new level.
+  void startLevel() {
+    const AdaptiveRefinementParameters& params = _context.refinement.adaptive;
+    for ( RefinerState& state : _states ) {
+      state.level_gain = 0;
+      state.level_time = 0.0;
+      state.run_on_current_level = !params.enabled ||
+        !state.efficiency.isMeasured() || !_overall_efficiency.isMeasured() ||
+        state.efficiency.average() >= params.min_relative_efficiency * _overall_efficiency.average() ||
+        state.levels_since_last_run + 1 >= params.probe_interval;
+    }
+  }
+
+  // ! Updates the efficiency of all refiners executed on the current level
+  void finishLevel() {
+    HyperedgeWeight total_gain = 0;
+    double total_time = 0.0;
+    for ( size_t i = 0; i < NUM_REFINERS; ++i ) {
+      RefinerState& state = _states[i];
+      if ( state.run_on_current_level && state.level_time > 0.0 ) {
+        state.efficiency.add(state.level_gain, state.level_time);
+        state.levels_since_last_run = 0;
+        ++state.num_executed_levels;
+        total_gain += state.level_gain;
+        total_time += state.level_time;
+        DBG << "Refiner" << i << ": gain =" << state.level_gain << ", time =" << state.level_time
+            << "s, efficiency =" << state.efficiency.average();
+      } else if ( !state.run_on_current_level ) {
+        ++state.levels_since_last_run;
+        ++state.num_skipped_levels;
+      }
+    }
+
+    if ( total_time > 0.0 ) {
+      _overall_efficiency.add(total_gain, total_time);
+    }
+  }
+
+  // ! Returns whether or not the refiner should be executed on the current level
+  bool shouldRun(const Refiner refiner) const {
+    return _states[index(refiner)].run_on_current_level;
+  }
+
+  // ! Executes the refinement function and measures its improvement
+  // ! of the objective function and its running time
+  template<typename F>
+  bool execute(const Refiner refiner, const Metrics& current_metrics, const F& refine) {
+    const HyperedgeWeight quality_before = current_metrics.quality;
+    HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    const bool improvement_found = refine();
+    HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+    RefinerState& state = _states[index(refiner)];
+    state.level_gain += std::max(quality_before - current_metrics.quality, 0);
+    state.level_time += std::chrono::duration<double>(end - start).count();
+    return improvement_found;
+  }
+
+  // ! Reports how often each refiner was skipped
+  void reportStatistics() const {
+    if ( _context.refinement.adaptive.enabled ) {
+      utils::Stats& stats = utils::Utilities::instance().getStats(_context.utility_id);
+      const std::array<std::string, NUM_REFINERS> names = { "label_propagation", "fm", "flows" };
+      for ( size_t i = 0; i < NUM_REFINERS; ++i ) {
+        stats.add_stat("adaptive_refinement_executed_" + names[i],
+          static_cast<int64_t>(_states[i].num_executed_levels));
+        stats.add_stat("adaptive_refinement_skipped_" + names[i],
+          static_cast<int64_t>(_states[i].num_skipped_levels));
+      }
+    }
+  }
+
+ private:
+  static size_t index(const Refiner refiner) {
+    return static_cast<size_t>(refiner);
+  }
+
+  const Context& _context;
+  std::array<RefinerState, NUM_REFINERS> _states;
+  // ! Improvement per second of all refiners
+  utils::EfficiencyEstimator _overall_efficiency;
+};
+
+}  // namespace mt_kahypar
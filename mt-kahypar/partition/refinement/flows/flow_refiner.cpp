@@ -40,6 +40,10 @@ MoveSequence FlowRefiner<TypeTraits, GainTypes>::refineImpl(mt_kahypar_partition
                                                             const Subhypergraph& sub_hg,
                                                             const HighResClockTimepoint& start) {
   const PartitionedHypergraph& phg = utils::cast_const<PartitionedHypergraph>(hypergraph);
+  if ( useGraphFlowCutter() ) {
+    return refineWithGraphFlowCutter(phg, sub_hg, start);
+  }
+
   MoveSequence sequence { { }, 0 };
   utils::Timer& timer = utils::Utilities::instance().getTimer(_context.utility_id);
   // Construct flow network that contains all vertices given in refinement nodes
@@ -172,6 +176,165 @@ FlowProblem FlowRefiner<TypeTraits, GainTypes>::constructFlowHypergraph(const Pa
   return flow_problem;
 }
 
+template<typename TypeTraits, typename GainTypes>
+bool FlowRefiner<TypeTraits, GainTypes>::useGraphFlowCutter() const {
+  const bool sequential = _context.shared_memory.num_threads == _context.refinement.flows.num_parallel_searches;
+  return PartitionedHypergraph::is_graph && sequential &&
+    std::is_same<typename GainTypes::FlowNetworkConstruction, CutFlowNetworkConstruction>::value &&
+    _context.refinement.flows.use_graph_flow_cutter;
+}
+
+template<typename TypeTraits, typename GainTypes>
+MoveSequence FlowRefiner<TypeTraits, GainTypes>::refineWithGraphFlowCutter(const PartitionedHypergraph& phg,
+                                                                           const Subhypergraph& sub_hg,
+                                                                           const HighResClockTimepoint& start) {
+  MoveSequence sequence { { }, 0 };
+  utils::Timer& timer = utils::Utilities::instance().getTimer(_context.utility_id);
+  timer.start_timer("construct_flow_network", "Construct Flow Network", true);
+  HypernodeID source = kInvalidHypernode;
+  HypernodeID sink = kInvalidHypernode;
+  FlowProblem flow_problem = constructGraphFlowNetwork(phg, sub_hg, source, sink);
+  timer.stop_timer("construct_flow_network");
+  if ( flow_problem.total_cut - flow_problem.non_removable_cut > 0 ) {
+    bool time_limit_reached = false;
+    size_t iteration = 0;
+    auto on_cut = [&] {
+      if (++iteration == 25) {
+        iteration = 0;
+        double elapsed = RUNNING_TIME(start);
+        if (elapsed > _time_limit) {
+          time_limit_reached = true;
+          return false;
+        }
+      }
+      return true;
+    };
+
+    timer.start_timer("hyper_flow_cutter", "HyperFlowCutter", true);
+    _graph_flow_cutter.setMaxBlockWeight(0, std::max(
+      flow_problem.weight_of_block_0, _context.partition.max_part_weights[_block_0]));
+    _graph_flow_cutter.setMaxBlockWeight(1, std::max(
+      flow_problem.weight_of_block_1, _context.partition.max_part_weights[_block_1]));
+    _graph_flow_cutter.reset();
+    _graph_flow_cutter.setFlowBound(flow_problem.total_cut - flow_problem.non_removable_cut);
+    const bool flowcutter_succeeded =
+      _graph_flow_cutter.enumerateCutsUntilBalancedOrFlowBoundExceeded(source, sink, on_cut);
+    timer.stop_timer("hyper_flow_cutter");
+
+    if ( flowcutter_succeeded ) {
+      const HyperedgeWeight new_cut = flow_problem.non_removable_cut + _graph_flow_cutter.flowValue();
+      const HypernodeWeight max_part_weight =
+        std::max(_graph_flow_cutter.sourceWeight(), _graph_flow_cutter.sinkWeight());
+      const bool improved_solution = new_cut < flow_problem.total_cut ||
+        (new_cut == flow_problem.total_cut && max_part_weight < std::max(flow_problem.weight_of_block_0, flow_problem.weight_of_block_1));
+
+      if ( improved_solution ) {
+        sequence.expected_improvement = flow_problem.total_cut - new_cut;
+        for ( HypernodeID u = 0; u < _graph_flow_network.numNodes(); ++u ) {
+          const HypernodeID hn = _whfc_to_node[u];
+          if ( hn != kInvalidHypernode ) {
+            const PartitionID from = phg.partID(hn);
+            const PartitionID to = _graph_flow_cutter.isSource(u) ? _block_0 : _block_1;
+            if ( from != to ) {
+              sequence.moves.push_back(Move { from, to, hn, kInvalidGain });
+            }
+          }
+        }
+      }
+    } else if ( time_limit_reached ) {
+      sequence.state = MoveSequenceState::TIME_LIMIT;
+    }
+  }
+  return sequence;
+}
+
+template<typename TypeTraits, typename GainTypes>
+FlowProblem FlowRefiner<TypeTraits, GainTypes>::constructGraphFlowNetwork(const PartitionedHypergraph& phg,
+                                                                          const Subhypergraph& sub_hg,
+                                                                          HypernodeID& source,
+                                                                          HypernodeID& sink) {
+  using FlowNetworkConstruction = typename GainTypes::FlowNetworkConstruction;
+  _block_0 = sub_hg.block_0;
+  _block_1 = sub_hg.block_1;
+  ASSERT(_block_0 != kInvalidPartition && _block_1 != kInvalidPartition);
+  FlowProblem flow_problem;
+  flow_problem.total_cut = 0;
+  flow_problem.non_removable_cut = 0;
+  _graph_flow_network.clear();
+  _node_to_graph_flow.clear();
+  _whfc_to_node.resize(sub_hg.numNodes() + 2);
+
+  // Same node layout as the hypergraph construction: source, nodes of
+  // block 0, sink, nodes of block 1
+  auto add_nodes = [&](const vec<HypernodeID>& nodes) {
+    for ( const HypernodeID& hn : nodes ) {
+      const HypernodeID u = _graph_flow_network.addNode(phg.nodeWeight(hn));
+      _whfc_to_node[u] = hn;
+      _node_to_graph_flow[hn] = u;
+    }
+  };
+  source = _graph_flow_network.addNode(
+    std::max(0, phg.partWeight(_block_0) - sub_hg.weight_of_block_0));
+  _whfc_to_node[source] = kInvalidHypernode;
+  add_nodes(sub_hg.nodes_of_block_0);
+  sink = _graph_flow_network.addNode(
+    std::max(0, phg.partWeight(_block_1) - sub_hg.weight_of_block_1));
+  _whfc_to_node[sink] = kInvalidHypernode;
+  add_nodes(sub_hg.nodes_of_block_1);
+  flow_problem.weight_of_block_0 = _graph_flow_network.nodeWeight(source) + sub_hg.weight_of_block_0;
+  flow_problem.weight_of_block_1 = _graph_flow_network.nodeWeight(sink) + sub_hg.weight_of_block_1;
+
+  for ( const HyperedgeID& he : sub_hg.hes ) {
+    if ( FlowNetworkConstruction::dropHyperedge(phg, he, _block_0, _block_1) ) {
+      continue;
+    }
+    const HyperedgeWeight capacity = FlowNetworkConstruction::capacity(phg, _context, he, _block_0, _block_1);
+    if ( phg.pinCountInPart(he, _block_0) > 0 && phg.pinCountInPart(he, _block_1) > 0 ) {
+      flow_problem.total_cut += capacity;
+    }
+
+    // An edge contains at most two endpoints. Endpoints outside of the
+    // region are replaced by the terminal of their block.
+    HypernodeID endpoints[2];
+    size_t num_endpoints = 0;
+    bool connect_to_source = false;
+    bool connect_to_sink = false;
+    for ( const HypernodeID& pin : phg.pins(he) ) {
+      ASSERT(num_endpoints < 2);
+      if ( _node_to_graph_flow.contains(pin) ) {
+        endpoints[num_endpoints++] = _node_to_graph_flow[pin];
+      } else if ( phg.partID(pin) == _block_0 ) {
+        connect_to_source = true;
+        endpoints[num_endpoints++] = source;
+      } else {
+        connect_to_sink = true;
+        endpoints[num_endpoints++] = sink;
+      }
+    }
+
+    if ( connect_to_source && connect_to_sink ) {
+      flow_problem.non_removable_cut += capacity;
+    } else if ( num_endpoints == 2 && endpoints[0] != endpoints[1] ) {
+      _graph_flow_network.addEdge(endpoints[0], endpoints[1], capacity);
+    }
+  }
+
+  if ( _graph_flow_network.nodeWeight(source) == 0 ||
+       _graph_flow_network.nodeWeight(sink) == 0 ) {
+    // Source or sink not connected to vertices in the flow problem
+    flow_problem.non_removable_cut = 0;
+    flow_problem.total_cut = 0;
+  } else {
+    _graph_flow_network.finalize();
+  }
+
+  DBG << "Graph Flow Network [ Nodes =" << _graph_flow_network.numNodes()
+      << ", Arcs =" << _graph_flow_network.numArcs()
+      << ", Blocks = (" << _block_0 << "," << _block_1 << ") ]";
+
+  return flow_problem;
+}
+
 namespace {
 #define FLOW_REFINER(X, Y) FlowRefiner<X, Y>
 }
@@ -41,6 +41,7 @@
 #include "mt-kahypar/partition/refinement/flows/sequential_construction.h"
 #include "mt-kahypar/partition/refinement/flows/parallel_construction.h"
 #include "mt-kahypar/partition/refinement/flows/flow_hypergraph_builder.h"
+#include "mt-kahypar/partition/refinement/flows/graph_flow_cutter.h"
 #include "mt-kahypar/utils/cast.h"
 
 namespace mt_kahypar {
@@ -63,6 +64,9 @@ class FlowRefiner final : public IFlowRefiner {
     _flow_hg(),
     _sequential_hfc(_flow_hg, context.partition.seed),
     _parallel_hfc(_flow_hg, context.partition.seed),
+    _graph_flow_network(),
+    _graph_flow_cutter(_graph_flow_network, context.partition.seed),
+    _node_to_graph_flow(),
     _whfc_to_node(),
     _sequential_construction(num_hyperedges, _flow_hg, _sequential_hfc, context),
     _parallel_construction(num_hyperedges, _flow_hg, _parallel_hfc, context) {
@@ -94,6 +98,7 @@ class FlowRefiner final : public IFlowRefiner {
     _block_0 = kInvalidPartition;
     _block_1 = kInvalidPartition;
     _flow_hg.clear();
+    _graph_flow_network.clear();
     _whfc_to_node.clear();
   }
 
@@ -108,6 +113,19 @@ class FlowRefiner final : public IFlowRefiner {
   FlowProblem constructFlowHypergraph(const PartitionedHypergraph& phg,
                                       const Subhypergraph& sub_hg);
 
+  // ! The graph flow cutter is only used for sequential searches on graphs
+  // ! where each edge translates to at most one edge in the flow network
+  bool useGraphFlowCutter() const;
+
+  MoveSequence refineWithGraphFlowCutter(const PartitionedHypergraph& phg,
+                                         const Subhypergraph& sub_hg,
+                                         const HighResClockTimepoint& start);
+
+  FlowProblem constructGraphFlowNetwork(const PartitionedHypergraph& phg,
+                                        const Subhypergraph& sub_hg,
+                                        HypernodeID& source,
+                                        HypernodeID& sink);
+
   PartitionID maxNumberOfBlocksPerSearchImpl() const override {
     return 2;
   }
@@ -126,6 +144,9 @@ class FlowRefiner final : public IFlowRefiner {
   FlowHypergraphBuilder _flow_hg;
   whfc::HyperFlowCutter<whfc::SequentialPushRelabel> _sequential_hfc;
   whfc::HyperFlowCutter<whfc::ParallelPushRelabel> _parallel_hfc;
+  GraphFlowNetwork _graph_flow_network;
+  GraphFlowCutter _graph_flow_cutter;
+  ds::DynamicSparseMap<HypernodeID, HypernodeID> _node_to_graph_flow;
 
   vec<HypernodeID> _whfc_to_node;
   SequentialConstruction<TypeTraits, GainTypes> _sequential_construction;
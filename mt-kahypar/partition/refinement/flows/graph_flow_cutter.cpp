@@ -0,0 +1,300 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/partition/refinement/flows/graph_flow_cutter.h"
+
+#include <algorithm>
+
+namespace mt_kahypar {
+
+void GraphFlowNetwork::finalize() {
+  const HypernodeID num_nodes = numNodes();
+  _first_out.assign(num_nodes + 1, 0);
+  for ( const TmpEdge& e : _tmp_edges ) {
+    ++_first_out[e.u + 1];
+    ++_first_out[e.v + 1];
+  }
+  for ( HypernodeID u = 0; u < num_nodes; ++u ) {
+    _first_out[u + 1] += _first_out[u];
+  }
+
+  const size_t num_arcs = 2 * _tmp_edges.size();
+  _head.resize(num_arcs);
+  _capacity.resize(num_arcs);
+  _reverse.resize(num_arcs);
+  vec<ArcID> pos(_first_out.begin(), _first_out.end() - 1);
+  for ( const TmpEdge& e : _tmp_edges ) {
+    const ArcID a = pos[e.u]++;
+    const ArcID b = pos[e.v]++;
+    _head[a] = e.v;
+    _head[b] = e.u;
+    _capacity[a] = e.capacity;
+    _capacity[b] = e.capacity;
+    _reverse[a] = b;
+    _reverse[b] = a;
+  }
+  _tmp_edges.clear();
+}
+
+void GraphFlowCutter::reset() {
+  const HypernodeID num_nodes = _network.numNodes();
+  _flow_value = 0;
+  _source_weight = 0;
+  _sink_weight = 0;
+  _flow.assign(_network.numArcs(), 0);
+  _terminal.assign(num_nodes, Side::NONE);
+  _source_terminals.clear();
+  _sink_terminals.clear();
+  _level.assign(num_nodes, -1);
+  _current_arc.assign(num_nodes, 0);
+  _in_source_reach.assign(num_nodes, false);
+  _in_sink_reach.assign(num_nodes, false);
+  _is_source.assign(num_nodes, false);
+}
+
+void GraphFlowCutter::addTerminal(const HypernodeID u, const Side side) {
+  ASSERT(u < _terminal.size());
+  ASSERT(_terminal[u] == Side::NONE || _terminal[u] == side);
+  if ( _terminal[u] == Side::NONE ) {
+    _terminal[u] = side;
+    if ( side == Side::SOURCE ) {
+      _source_terminals.push_back(u);
+    } else {
+      _sink_terminals.push_back(u);
+    }
+  }
+}
+
+bool GraphFlowCutter::augmentFlow() {
+  while ( computeLevels() ) {
+    for ( HypernodeID u = 0; u < _network.numNodes(); ++u ) {
+      _current_arc[u] = _network.firstArc(u);
+    }
+    for ( const HypernodeID& s : _source_terminals ) {
+      HyperedgeWeight delta = 0;
+      while ( ( delta = augmentingPath(s) ) > 0 ) {
+        _flow_value += delta;
+        if ( _flow_value > _flow_bound ) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+bool GraphFlowCutter::computeLevels() {
+  std::fill(_level.begin(), _level.end(), -1);
+  _queue.clear();
+  for ( const HypernodeID& s : _source_terminals ) {
+    _level[s] = 0;
+    _queue.push_back(s);
+  }
+
+  bool reached_sink = false;
+  for ( size_t i = 0; i < _queue.size(); ++i ) {
+    const HypernodeID u = _queue[i];
+    for ( GraphFlowNetwork::ArcID a = _network.firstArc(u); a < _network.firstInvalidArc(u); ++a ) {
+      const HypernodeID v = _network.head(a);
+      if ( _level[v] == -1 && residual(a) > 0 ) {
+        _level[v] = _level[u] + 1;
+        if ( _terminal[v] == Side::SINK ) {
+          // Paths end at sink terminals
+          reached_sink = true;
+        } else {
+          _queue.push_back(v);
+        }
+      }
+    }
+  }
+  return reached_sink;
+}
+
+HyperedgeWeight GraphFlowCutter::augmentingPath(const HypernodeID s) {
+  _path.clear();
+  HypernodeID u = s;
+  while ( true ) {
+    if ( _terminal[u] == Side::SINK ) {
+      HyperedgeWeight bottleneck = kInfiniteCapacity;
+      for ( const GraphFlowNetwork::ArcID& a : _path ) {
+        bottleneck = std::min(bottleneck, residual(a));
+      }
+      for ( const GraphFlowNetwork::ArcID& a : _path ) {
+        _flow[a] += bottleneck;
+        _flow[_network.reverse(a)] -= bottleneck;
+      }
+      return bottleneck;
+    }
+
+    bool advanced = false;
+    for ( ; _current_arc[u] < _network.firstInvalidArc(u); ++_current_arc[u] ) {
+      const GraphFlowNetwork::ArcID a = _current_arc[u];
+      const HypernodeID v = _network.head(a);
+      if ( residual(a) > 0 && _level[v] == _level[u] + 1 ) {
+        _path.push_back(a);
+        u = v;
+        advanced = true;
+        break;
+      }
+    }
+
+    if ( !advanced ) {
+      if ( _path.empty() ) {
+        return 0;
+      }
+      // Dead end => remove u from level graph and retreat
+      _level[u] = -1;
+      const GraphFlowNetwork::ArcID a = _path.back();
+      _path.pop_back();
+      u = _network.head(_network.reverse(a));
+      ++_current_arc[u];
+    }
+  }
+}
+
+HypernodeWeight GraphFlowCutter::computeSourceReachableSet() {
+  std::fill(_in_source_reach.begin(), _in_source_reach.end(), false);
+  _queue.clear();
+  for ( const HypernodeID& s : _source_terminals ) {
+    _in_source_reach[s] = true;
+    _queue.push_back(s);
+  }
+
+  HypernodeWeight weight = 0;
+  for ( size_t i = 0; i < _queue.size(); ++i ) {
+    const HypernodeID u = _queue[i];
+    ASSERT(_terminal[u] != Side::SINK);
+    weight += _network.nodeWeight(u);
+    for ( GraphFlowNetwork::ArcID a = _network.firstArc(u); a < _network.firstInvalidArc(u); ++a ) {
+      const HypernodeID v = _network.head(a);
+      if ( !_in_source_reach[v] && residual(a) > 0 ) {
+        _in_source_reach[v] = true;
+        _queue.push_back(v);
+      }
+    }
+  }
+  return weight;
+}
+
+HypernodeWeight GraphFlowCutter::computeSinkReachableSet() {
+  std::fill(_in_sink_reach.begin(), _in_sink_reach.end(), false);
+  _queue.clear();
+  for ( const HypernodeID& t : _sink_terminals ) {
+    _in_sink_reach[t] = true;
+    _queue.push_back(t);
+  }
+
+  HypernodeWeight weight = 0;
+  for ( size_t i = 0; i < _queue.size(); ++i ) {
+    const HypernodeID u = _queue[i];
+    ASSERT(_terminal[u] != Side::SOURCE);
+    weight += _network.nodeWeight(u);
+    for ( GraphFlowNetwork::ArcID a = _network.firstArc(u); a < _network.firstInvalidArc(u); ++a ) {
+      const HypernodeID v = _network.head(a);
+      // v reaches u, if the arc (v,u) has residual capacity
+      if ( !_in_sink_reach[v] && residual(_network.reverse(a)) > 0 ) {
+        _in_sink_reach[v] = true;
+        _queue.push_back(v);
+      }
+    }
+  }
+  return weight;
+}
+
+bool GraphFlowCutter::pierce(const Side side, const HypernodeWeight side_weight) {
+  const vec<bool>& reach = side == Side::SOURCE ? _in_source_reach : _in_sink_reach;
+  const vec<bool>& other_reach = side == Side::SOURCE ? _in_sink_reach : _in_source_reach;
+  const HypernodeWeight max_weight = _max_block_weight[side == Side::SOURCE ? 0 : 1];
+  const HypernodeID num_nodes = _network.numNodes();
+
+  // All nodes reachable from the terminals of the growing side become terminals
+  for ( HypernodeID u = 0; u < num_nodes; ++u ) {
+    if ( reach[u] ) {
+      addTerminal(u, side);
+    }
+  }
+
+  // A piercing node that is not reachable from the other side does not
+  // create an augmenting path and therefore does not increase the flow.
+  // Ties are broken uniformly at random.
+  HypernodeID piercing_node = kInvalidHypernode;
+  bool avoids_augmenting_path = false;
+  size_t num_candidates = 0;
+  auto consider = [&](const HypernodeID v) {
+    if ( !reach[v] && _terminal[v] == Side::NONE &&
+         side_weight + _network.nodeWeight(v) <= max_weight ) {
+      const bool avoids_path = !other_reach[v];
+      if ( avoids_path && !avoids_augmenting_path ) {
+        piercing_node = v;
+        avoids_augmenting_path = true;
+        num_candidates = 1;
+      } else if ( avoids_path == avoids_augmenting_path ) {
+        if ( _prng() % ++num_candidates == 0 ) {
+          piercing_node = v;
+        }
+      }
+    }
+  };
+
+  // Prefer nodes on the border of the reachable set
+  for ( HypernodeID u = 0; u < num_nodes; ++u ) {
+    if ( reach[u] ) {
+      for ( GraphFlowNetwork::ArcID a = _network.firstArc(u); a < _network.firstInvalidArc(u); ++a ) {
+        consider(_network.head(a));
+      }
+    }
+  }
+  if ( piercing_node == kInvalidHypernode ) {
+    for ( HypernodeID v = 0; v < num_nodes; ++v ) {
+      consider(v);
+    }
+  }
+
+  if ( piercing_node == kInvalidHypernode ) {
+    return false;
+  }
+  addTerminal(piercing_node, side);
+  return true;
+}
+
+void GraphFlowCutter::assignSides(const Side side, const HypernodeWeight side_weight) {
+  const HypernodeID num_nodes = _network.numNodes();
+  if ( side == Side::SOURCE ) {
+    for ( HypernodeID u = 0; u < num_nodes; ++u ) {
+      _is_source[u] = _in_source_reach[u];
+    }
+    _source_weight = side_weight;
+    _sink_weight = _network.totalWeight() - side_weight;
+  } else {
+    for ( HypernodeID u = 0; u < num_nodes; ++u ) {
+      _is_source[u] = !_in_sink_reach[u];
+    }
+    _sink_weight = side_weight;
+    _source_weight = _network.totalWeight() - side_weight;
+  }
+}
+
+}  // namespace mt_kahypar
@@ -0,0 +1,308 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <limits>
+#include <random>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+
+namespace mt_kahypar {
+
+/**
+ * Flow network for two-way flow refinement on graphs. In contrast to the
+ * flow hypergraph used by WHFC, each edge is represented as a pair of arcs
+ * between its two endpoints without any auxiliary nodes for the edge itself.
+ * Undirected edges are modeled by two opposite arcs that both have the
+ * capacity of the edge.
+ */
+class GraphFlowNetwork {
+
+  struct TmpEdge {
+    HypernodeID u;
+    HypernodeID v;
+    HyperedgeWeight capacity;
+  };
+
+ public:
+  using ArcID = size_t;
+
+  GraphFlowNetwork() :
+    _node_weights(),
+    _total_weight(0),
+    _tmp_edges(),
+    _first_out(),
+    _head(),
+    _capacity(),
+    _reverse() { }
+
+  void clear() {
+    _node_weights.clear();
+    _total_weight = 0;
+    _tmp_edges.clear();
+    _first_out.clear();
+    _head.clear();
+    _capacity.clear();
+    _reverse.clear();
+  }
+
+  HypernodeID addNode(const HypernodeWeight weight) {
+    _node_weights.push_back(weight);
+    _total_weight += weight;
+    return _node_weights.size() - 1;
+  }
+
+  // ! Adds an undirected edge. Must be called before finalize().
+  void addEdge(const HypernodeID u, const HypernodeID v, const HyperedgeWeight capacity) {
+    ASSERT(u < numNodes() && v < numNodes() && u != v);
+    _tmp_edges.push_back(TmpEdge { u, v, capacity });
+  }
+
+  // ! Builds the adjacency array of the flow network
+  void finalize();
+
+  HypernodeID numNodes() const {
+    return _node_weights.size();
+  }
+
+  size_t numArcs() const {
+    return _head.size();
+  }
+
+  HypernodeWeight nodeWeight(const HypernodeID u) const {
+    ASSERT(u < numNodes());
+    return _node_weights[u];
+  }
+
+  HypernodeWeight totalWeight() const {
+    return _total_weight;
+  }
+
+  // ! Index of the first outgoing arc of u
+  ArcID firstArc(const HypernodeID u) const {
+    ASSERT(u < numNodes());
+    return _first_out[u];
+  }
+
+  // ! Index after the last outgoing arc of u
+  ArcID firstInvalidArc(const HypernodeID u) const {
+    ASSERT(u < numNodes());
+    return _first_out[u + 1];
+  }
+
+  HypernodeID head(const ArcID a) const {
+    return _head[a];
+  }
+
+  HyperedgeWeight capacity(const ArcID a) const {
+    return _capacity[a];
+  }
+
+  ArcID reverse(const ArcID a) const {
+    return _reverse[a];
+  }
+
+ private:
+  vec<HypernodeWeight> _node_weights;
+  HypernodeWeight _total_weight;
+  vec<TmpEdge> _tmp_edges;
+
+  vec<ArcID> _first_out;
+  vec<HypernodeID> _head;
+  vec<HyperedgeWeight> _capacity;
+  vec<ArcID> _reverse;
+};
+
+/**
+ * Sequential FlowCutter on a GraphFlowNetwork. The algorithm computes a maximum
+ * flow with Dinic's algorithm and checks whether the minimum cut closest to the
+ * source or to the sink induces a balanced bipartition. If not, the lighter side
+ * is grown by turning all nodes reachable from it into terminals and piercing one
+ * additional node on its border. Nodes that do not create an augmenting path are
+ * preferred as piercing nodes. The flow is augmented incrementally between
+ * two piercing steps.
+ */
+class GraphFlowCutter {
+
+  static constexpr HyperedgeWeight kInfiniteCapacity = std::numeric_limits<HyperedgeWeight>::max();
+
+  enum class Side : uint8_t {
+    NONE,
+    SOURCE,
+    SINK
+  };
+
+ public:
+  explicit GraphFlowCutter(const GraphFlowNetwork& network, const int seed) :
+    _network(network),
+    _prng(seed),
+    _max_block_weight { 0, 0 },
+    _flow_bound(kInfiniteCapacity),
+    _flow_value(0),
+    _source_weight(0),
+    _sink_weight(0),
+    _flow(),
+    _terminal(),
+    _source_terminals(),
+    _sink_terminals(),
+    _level(),
+    _current_arc(),
+    _path(),
+    _in_source_reach(),
+    _in_sink_reach(),
+    _queue(),
+    _is_source() { }
+
+  GraphFlowCutter(const GraphFlowCutter&) = delete;
+  GraphFlowCutter & operator= (const GraphFlowCutter &) = delete;
+
+  void setMaxBlockWeight(const int side, const HypernodeWeight max_weight) {
+    ASSERT(side == 0 || side == 1);
+    _max_block_weight[side] = max_weight;
+  }
+
+  void setFlowBound(const HyperedgeWeight flow_bound) {
+    _flow_bound = flow_bound;
+  }
+
+  // ! Resets the flow and terminal sets to the current flow network
+  void reset();
+
+  /**
+   * Enumerates minimum cuts with increasing flow value until one of them induces
+   * a balanced bipartition (returns true) or the flow value exceeds the flow bound,
+   * no further piercing node exists or on_cut() returns false (returns false).
+   */
+  template<typename F>
+  bool enumerateCutsUntilBalancedOrFlowBoundExceeded(const HypernodeID source,
+                                                     const HypernodeID sink,
+                                                     const F& on_cut) {
+    addTerminal(source, Side::SOURCE);
+    addTerminal(sink, Side::SINK);
+    while ( true ) {
+      if ( !augmentFlow() ) {
+        return false;
+      }
+      const HypernodeWeight source_reach_weight = computeSourceReachableSet();
+      const HypernodeWeight sink_reach_weight = computeSinkReachableSet();
+      if ( !on_cut() ) {
+        return false;
+      }
+      if ( isBalanced(source_reach_weight, _network.totalWeight() - source_reach_weight) ) {
+        assignSides(Side::SOURCE, source_reach_weight);
+        return true;
+      } else if ( isBalanced(_network.totalWeight() - sink_reach_weight, sink_reach_weight) ) {
+        assignSides(Side::SINK, sink_reach_weight);
+        return true;
+      }
+
+      // Grow the side with smaller weight
+      const Side side = source_reach_weight <= sink_reach_weight ? Side::SOURCE : Side::SINK;
+      if ( !pierce(side, side == Side::SOURCE ? source_reach_weight : sink_reach_weight) ) {
+        return false;
+      }
+    }
+  }
+
+  HyperedgeWeight flowValue() const {
+    return _flow_value;
+  }
+
+  // ! Weight of the source side of the last balanced cut
+  HypernodeWeight sourceWeight() const {
+    return _source_weight;
+  }
+
+  // ! Weight of the sink side of the last balanced cut
+  HypernodeWeight sinkWeight() const {
+    return _sink_weight;
+  }
+
+  // ! Returns true, if u is on the source side of the last balanced cut
+  bool isSource(const HypernodeID u) const {
+    ASSERT(u < _is_source.size());
+    return _is_source[u];
+  }
+
+ private:
+  HyperedgeWeight residual(const GraphFlowNetwork::ArcID a) const {
+    return _network.capacity(a) - _flow[a];
+  }
+
+  bool isBalanced(const HypernodeWeight source_weight,
+                  const HypernodeWeight sink_weight) const {
+    return source_weight <= _max_block_weight[0] && sink_weight <= _max_block_weight[1];
+  }
+
+  void addTerminal(const HypernodeID u, const Side side);
+
+  // ! Computes a maximum flow between the current terminal sets.
+  // ! Returns false, if the flow value exceeds the flow bound.
+  bool augmentFlow();
+
+  // ! Computes the distance labels of Dinic's algorithm.
+  // ! Returns true, if a sink terminal is reachable.
+  bool computeLevels();
+
+  // ! Searches an augmenting path starting at the source terminal s in the level graph
+  HyperedgeWeight augmentingPath(const HypernodeID s);
+
+  HypernodeWeight computeSourceReachableSet();
+
+  HypernodeWeight computeSinkReachableSet();
+
+  // ! Turns the reachable set of the given side into terminals and adds a piercing node
+  bool pierce(const Side side, const HypernodeWeight side_weight);
+
+  void assignSides(const Side side, const HypernodeWeight side_weight);
+
+  const GraphFlowNetwork& _network;
+  std::mt19937 _prng;
+  HypernodeWeight _max_block_weight[2];
+  HyperedgeWeight _flow_bound;
+  HyperedgeWeight _flow_value;
+  HypernodeWeight _source_weight;
+  HypernodeWeight _sink_weight;
+
+  vec<HyperedgeWeight> _flow;
+  vec<Side> _terminal;
+  vec<HypernodeID> _source_terminals;
+  vec<HypernodeID> _sink_terminals;
+
+  vec<int> _level;
+  vec<GraphFlowNetwork::ArcID> _current_arc;
+  vec<GraphFlowNetwork::ArcID> _path;
+
+  vec<bool> _in_source_reach;
+  vec<bool> _in_sink_reach;
+  vec<HypernodeID> _queue;
+  vec<bool> _is_source;
+};
+
+}  // namespace mt_kahypar
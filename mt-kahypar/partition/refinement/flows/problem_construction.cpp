@@ -27,9 +27,13 @@
 
 #include "mt-kahypar/partition/refinement/flows/problem_construction.h"
 
+#include <algorithm>
 #include <unordered_map>
 
 #include "tbb/parallel_for.h"
+#include "tbb/parallel_invoke.h"
+#include "tbb/parallel_sort.h"
+#include "tbb/task_arena.h"
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
@@ -49,9 +53,10 @@ void ProblemConstruction<TypeTraits>::BFSData::reset() {
   queue_weight_block_1 = 0;
   lock_queue = false;
   clearQueue();
-  std::fill(visited_hn.begin(), visited_hn.end(), false);
-  std::fill(visited_he.begin(), visited_he.end(), false);
-  std::fill(contained_hes.begin(), contained_hes.end(), false);
+  frontier.clear();
+  visited_hn.reset();
+  visited_he.reset();
+  contained_hes.reset();
   std::fill(locked_blocks.begin(), locked_blocks.end(), false);
 }
 
@@ -71,9 +76,9 @@ void ProblemConstruction<TypeTraits>::BFSData::add_pins_of_hyperedge_to_queue(
   const HypernodeWeight max_weight_block_0,
   const HypernodeWeight max_weight_block_1) {
   if ( current_distance <= max_bfs_distance && !lock_queue ) {
-    if ( !visited_he[he] ) {
+    if ( !visited_he.isSet(he) ) {
       for ( const HypernodeID& pin : phg.pins(he) ) {
-        if ( !visited_hn[pin] ) {
+        if ( !visited_hn.isSet(pin) ) {
           const PartitionID block = phg.partID(pin);
           const bool is_block_0 = blocks.i == block;
           const bool is_block_1 = blocks.j == block;
@@ -82,10 +87,10 @@ void ProblemConstruction<TypeTraits>::BFSData::add_pins_of_hyperedge_to_queue(
             queue_weight_block_0 += is_block_0 ? phg.nodeWeight(pin) : 0;
             queue_weight_block_1 += is_block_1 ? phg.nodeWeight(pin) : 0;
           }
-          visited_hn[pin] = true;
+          visited_hn.set(pin);
         }
       }
-      visited_he[he] = true;
+      visited_he.set(he);
     }
   }
 
@@ -102,7 +107,8 @@ namespace {
 template<typename TypeTraits>
 Subhypergraph ProblemConstruction<TypeTraits>::construct(const SearchID search_id,
                                                          QuotientGraph<TypeTraits>& quotient_graph,
-                                                         const PartitionedHypergraph& phg) {
+                                                         const PartitionedHypergraph& phg,
+                                                         const size_t num_threads) {
   Subhypergraph sub_hg;
   BFSData& bfs = _local_bfs.local();
   bfs.reset();
@@ -128,38 +134,10 @@ Subhypergraph ProblemConstruction<TypeTraits>::construct(const SearchID search_i
   });
   bfs.swap_with_next_queue();
 
-  // BFS
-  while ( !bfs.is_empty() &&
-          !isMaximumProblemSizeReached(sub_hg,
-            max_weight_block_0, max_weight_block_1, bfs.locked_blocks) ) {
-    HypernodeID hn = bfs.pop_hypernode();
-    PartitionID block = phg.partID(hn);
-    const bool is_block_contained = block == sub_hg.block_0 || block == sub_hg.block_1;
-    if ( is_block_contained && !bfs.locked_blocks[block] ) {
-      if ( sub_hg.block_0  == block ) {
-        sub_hg.nodes_of_block_0.push_back(hn);
-        sub_hg.weight_of_block_0 += phg.nodeWeight(hn);
-      } else {
-        ASSERT(sub_hg.block_1 == block);
-        sub_hg.nodes_of_block_1.push_back(hn);
-        sub_hg.weight_of_block_1 += phg.nodeWeight(hn);
-      }
-      sub_hg.num_pins += phg.nodeDegree(hn);
-
-      // Push all neighbors of the added vertex into the queue
-      for ( const HyperedgeID& he : phg.incidentEdges(hn) ) {
-        bfs.add_pins_of_hyperedge_to_queue(he, phg, max_bfs_distance,
-          max_weight_block_0, max_weight_block_1);
-        if ( !bfs.contained_hes[phg.uniqueEdgeID(he)] ) {
-          sub_hg.hes.push_back(he);
-          bfs.contained_hes[phg.uniqueEdgeID(he)] = true;
-        }
-      }
-    }
-
-    if ( bfs.is_empty() ) {
-      bfs.swap_with_next_queue();
-    }
+  if ( num_threads > 1 ) {
+    growRegionInParallel(phg, bfs, sub_hg, max_weight_block_0, max_weight_block_1, num_threads);
+  } else {
+    growRegion(phg, bfs, sub_hg, max_weight_block_0, max_weight_block_1);
   }
   DBG << "Search ID:" << search_id << "-" << sub_hg;
 
@@ -211,6 +189,169 @@ Subhypergraph ProblemConstruction<TypeTraits>::construct(const SearchID search_i
   return sub_hg;
 }
 
+template<typename TypeTraits>
+void ProblemConstruction<TypeTraits>::growRegion(const PartitionedHypergraph& phg,
+                                                 BFSData& bfs,
+                                                 Subhypergraph& sub_hg,
+                                                 const HypernodeWeight max_weight_block_0,
+                                                 const HypernodeWeight max_weight_block_1) {
+  const size_t max_bfs_distance = _context.refinement.flows.max_bfs_distance;
+  while ( !bfs.is_empty() &&
+          !isMaximumProblemSizeReached(sub_hg,
+            max_weight_block_0, max_weight_block_1, bfs.locked_blocks) ) {
+    HypernodeID hn = bfs.pop_hypernode();
+    PartitionID block = phg.partID(hn);
+    const bool is_block_contained = block == sub_hg.block_0 || block == sub_hg.block_1;
+    if ( is_block_contained && !bfs.locked_blocks[block] ) {
+      if ( sub_hg.block_0  == block ) {
+        sub_hg.nodes_of_block_0.push_back(hn);
+        sub_hg.weight_of_block_0 += phg.nodeWeight(hn);
+      } else {
+        ASSERT(sub_hg.block_1 == block);
+        sub_hg.nodes_of_block_1.push_back(hn);
+        sub_hg.weight_of_block_1 += phg.nodeWeight(hn);
+      }
+      sub_hg.num_pins += phg.nodeDegree(hn);
+
+      // Push all neighbors of the added vertex into the queue
+      for ( const HyperedgeID& he : phg.incidentEdges(hn) ) {
+        bfs.add_pins_of_hyperedge_to_queue(he, phg, max_bfs_distance,
+          max_weight_block_0, max_weight_block_1);
+        if ( !bfs.contained_hes.isSet(phg.uniqueEdgeID(he)) ) {
+          sub_hg.hes.push_back(he);
+          bfs.contained_hes.set(phg.uniqueEdgeID(he));
+        }
+      }
+    }
+
+    if ( bfs.is_empty() ) {
+      bfs.swap_with_next_queue();
+    }
+  }
+}
+
+template<typename TypeTraits>
+void ProblemConstruction<TypeTraits>::growRegionInParallel(const PartitionedHypergraph& phg,
+                                                           BFSData& bfs,
+                                                           Subhypergraph& sub_hg,
+                                                           const HypernodeWeight max_weight_block_0,
+                                                           const HypernodeWeight max_weight_block_1,
+                                                           const size_t num_threads) {
+  const size_t max_bfs_distance = _context.refinement.flows.max_bfs_distance;
+  // The search only runs on the threads assigned to it. The arena is only
+  // recreated if the number of threads assigned to the searches changes.
+  if ( !bfs.arena || bfs.arena->max_concurrency() != static_cast<int>(num_threads) ) {
+    bfs.arena = std::make_unique<tbb::task_arena>(static_cast<int>(num_threads));
+  }
+  tbb::task_arena& arena = *bfs.arena;
+  for ( vec<HypernodeID>& next_frontier : bfs.local_next_frontier ) {
+    next_frontier.clear();
+  }
+  for ( vec<HyperedgeID>& hes : bfs.local_hes ) {
+    hes.clear();
+  }
+
+  bfs.frontier.clear();
+  while ( !bfs.is_empty() ) {
+    bfs.frontier.push_back(bfs.pop_hypernode());
+  }
+  std::sort(bfs.frontier.begin(), bfs.frontier.end());
+
+  // The BFS proceeds layer by layer. The vertices of the current layer are added
+  // to the region sequentially, which is cheap compared to scanning their incident
+  // hyperedges and pins. The expensive part, collecting the next layer, is then
+  // done in parallel. Each layer and the hyperedges found with it are sorted
+  // afterwards, so the region does not depend on the number of threads or on the
+  // order in which they scan the layer.
+  bool is_maximum_problem_size_reached = false;
+  while ( !bfs.frontier.empty() && !is_maximum_problem_size_reached ) {
+    size_t num_added_nodes = 0;
+    for ( const HypernodeID& hn : bfs.frontier ) {
+      if ( isMaximumProblemSizeReached(sub_hg,
+             max_weight_block_0, max_weight_block_1, bfs.locked_blocks) ) {
+        is_maximum_problem_size_reached = true;
+        break;
+      }
+
+      const PartitionID block = phg.partID(hn);
+      const bool is_block_contained = block == sub_hg.block_0 || block == sub_hg.block_1;
+      if ( is_block_contained && !bfs.locked_blocks[block] ) {
+        if ( sub_hg.block_0  == block ) {
+          sub_hg.nodes_of_block_0.push_back(hn);
+          sub_hg.weight_of_block_0 += phg.nodeWeight(hn);
+        } else {
+          ASSERT(sub_hg.block_1 == block);
+          sub_hg.nodes_of_block_1.push_back(hn);
+          sub_hg.weight_of_block_1 += phg.nodeWeight(hn);
+        }
+        sub_hg.num_pins += phg.nodeDegree(hn);
+        bfs.frontier[num_added_nodes++] = hn;
+      }
+    }
+    bfs.frontier.resize(num_added_nodes);
+
+    // Collect the next layer and all hyperedges incident to the added vertices
+    const bool expand_region = bfs.current_distance <= max_bfs_distance && !bfs.lock_queue;
+    arena.execute([&] {
+      tbb::parallel_for(UL(0), bfs.frontier.size(), [&](const size_t i) {
+        const HypernodeID hn = bfs.frontier[i];
+        vec<HypernodeID>& next_frontier = bfs.local_next_frontier.local();
+        vec<HyperedgeID>& hes = bfs.local_hes.local();
+        for ( const HyperedgeID& he : phg.incidentEdges(hn) ) {
+          if ( expand_region && bfs.visited_he.atomicSet(he) ) {
+            for ( const HypernodeID& pin : phg.pins(he) ) {
+              if ( bfs.visited_hn.atomicSet(pin) ) {
+                const PartitionID block = phg.partID(pin);
+                if ( (sub_hg.block_0 == block || sub_hg.block_1 == block) &&
+                     !bfs.locked_blocks[block] ) {
+                  next_frontier.push_back(pin);
+                }
+              }
+            }
+          }
+          if ( bfs.contained_hes.atomicSet(phg.uniqueEdgeID(he)) ) {
+            hes.push_back(he);
+          }
+        }
+      });
+    });
+
+    const size_t num_hes = sub_hg.hes.size();
+    for ( vec<HyperedgeID>& hes : bfs.local_hes ) {
+      sub_hg.hes.insert(sub_hg.hes.end(), hes.begin(), hes.end());
+      hes.clear();
+    }
+    bfs.frontier.clear();
+    for ( vec<HypernodeID>& next_frontier : bfs.local_next_frontier ) {
+      bfs.frontier.insert(bfs.frontier.end(), next_frontier.begin(), next_frontier.end());
+      next_frontier.clear();
+    }
+    arena.execute([&] {
+      tbb::parallel_invoke([&] {
+        tbb::parallel_sort(sub_hg.hes.begin() + num_hes, sub_hg.hes.end());
+      }, [&] {
+        tbb::parallel_sort(bfs.frontier.begin(), bfs.frontier.end());
+      });
+    });
+
+    // The next layer ends with the vertex that lets the weights of both blocks
+    // reach their limit. The sequential BFS stops adding vertices at that point, too.
+    for ( size_t i = 0; i < bfs.frontier.size(); ++i ) {
+      const HypernodeID pin = bfs.frontier[i];
+      const PartitionID block = phg.partID(pin);
+      bfs.queue_weight_block_0 += sub_hg.block_0 == block ? phg.nodeWeight(pin) : 0;
+      bfs.queue_weight_block_1 += sub_hg.block_1 == block ? phg.nodeWeight(pin) : 0;
+      if ( bfs.queue_weight_block_0 >= max_weight_block_0 &&
+           bfs.queue_weight_block_1 >= max_weight_block_1 ) {
+        bfs.lock_queue = true;
+        bfs.frontier.resize(i + 1);
+        break;
+      }
+    }
+    ++bfs.current_distance;
+  }
+}
+
 template<typename TypeTraits>
 void ProblemConstruction<TypeTraits>::changeNumberOfBlocks(const PartitionID new_k) {
   ASSERT(new_k == _context.partition.k);
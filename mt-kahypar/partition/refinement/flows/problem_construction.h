@@ -26,10 +26,14 @@
 
 #pragma once
 
+#include <memory>
+
 #include "tbb/enumerable_thread_specific.h"
+#include "tbb/task_arena.h"
 
 #include "mt-kahypar/partition/context.h"
 #include "mt-kahypar/datastructures/sparse_map.h"
+#include "mt-kahypar/datastructures/bitset.h"
 #include "mt-kahypar/partition/refinement/flows/refiner_adapter.h"
 #include "mt-kahypar/partition/refinement/flows/quotient_graph.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
@@ -56,13 +60,17 @@ class ProblemConstruction {
       current_distance(0),
       queue(),
       next_queue(),
-      visited_hn(num_nodes, false),
-      visited_he(num_edges, false),
-      contained_hes(num_edges, false),
+      frontier(),
+      visited_hn(num_nodes),
+      visited_he(num_edges),
+      contained_hes(num_edges),
       locked_blocks(k, false),
       queue_weight_block_0(0),
       queue_weight_block_1(0),
-      lock_queue(false)  { }
+      lock_queue(false),
+      arena(),
+      local_next_frontier(),
+      local_hes() { }
 
     void clearQueue();
 
@@ -95,13 +103,19 @@ class ProblemConstruction {
     size_t current_distance;
     parallel::scalable_queue<HypernodeID> queue;
     parallel::scalable_queue<HypernodeID> next_queue;
-    vec<bool> visited_hn;
-    vec<bool> visited_he;
-    vec<bool> contained_hes;
+    vec<HypernodeID> frontier;
+    ds::Bitset visited_hn;
+    ds::Bitset visited_he;
+    ds::Bitset contained_hes;
     vec<bool> locked_blocks;
     HypernodeWeight queue_weight_block_0;
     HypernodeWeight queue_weight_block_1;
     bool lock_queue;
+    // ! Task arena and thread-local buffers of the parallel BFS. They are
+    // ! reused by all searches of the thread, since they are expensive to create.
+    std::unique_ptr<tbb::task_arena> arena;
+    tbb::enumerable_thread_specific<vec<HypernodeID>> local_next_frontier;
+    tbb::enumerable_thread_specific<vec<HyperedgeID>> local_hes;
   };
 
  public:
@@ -127,9 +141,14 @@ class ProblemConstruction {
   ProblemConstruction & operator= (const ProblemConstruction &) = delete;
   ProblemConstruction & operator= (ProblemConstruction &&) = delete;
 
+  // ! Grows a region around the cut of the block pair associated with the search.
+  // ! If more than one thread is assigned to the search, the BFS expands each
+  // ! layer in parallel. The resulting region is the same for any number of
+  // ! threads greater than one, but may differ from the sequential BFS.
   Subhypergraph construct(const SearchID search_id,
                           QuotientGraph<TypeTraits>& quotient_graph,
-                          const PartitionedHypergraph& phg);
+                          const PartitionedHypergraph& phg,
+                          const size_t num_threads = 1);
 
   void changeNumberOfBlocks(const PartitionID new_k);
 
@@ -138,6 +157,19 @@ class ProblemConstruction {
     return BFSData(_num_hypernodes, _num_hyperedges, _context.partition.k);
   }
 
+  void growRegion(const PartitionedHypergraph& phg,
+                  BFSData& bfs,
+                  Subhypergraph& sub_hg,
+                  const HypernodeWeight max_weight_block_0,
+                  const HypernodeWeight max_weight_block_1);
+
+  void growRegionInParallel(const PartitionedHypergraph& phg,
+                            BFSData& bfs,
+                            Subhypergraph& sub_hg,
+                            const HypernodeWeight max_weight_block_0,
+                            const HypernodeWeight max_weight_block_1,
+                            const size_t num_threads);
+
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE bool isMaximumProblemSizeReached(
     const Subhypergraph& sub_hg,
     const HypernodeWeight max_weight_block_0,
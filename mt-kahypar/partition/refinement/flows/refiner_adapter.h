@@ -143,6 +143,16 @@ public:
     _threads.terminateRefiner();
   }
 
+  // ! Acquires the share of free threads of a search for work done outside
+  // ! of the refiner (e.g., growing the region of the flow problem)
+  size_t acquireFreeThreads() {
+    return _threads.acquireFreeThreads();
+  }
+
+  void releaseThreads(const size_t num_threads) {
+    _threads.releaseThreads(num_threads);
+  }
+
   size_t numAvailableRefiner() const {
     return _num_parallel_refiners;
   }
@@ -55,6 +55,10 @@ void FlowRefinementScheduler<TypeTraits, GainTypes>::RefinementStats::update_glo
     failed_updates_due_to_balance_constraint.load(std::memory_order_relaxed));
   _stats.update_stat("total_flow_refinement_improvement",
     total_improvement.load(std::memory_order_relaxed));
+  _stats.update_stat("flow_region_growing_time",
+    region_growing_time_us.load(std::memory_order_relaxed) / 1000000.0);
+  _stats.update_stat("flow_refinement_time",
+    refinement_time_us.load(std::memory_order_relaxed) / 1000000.0);
 }
 
 template<typename TypeTraits, typename GainTypes>
@@ -79,16 +83,33 @@ bool FlowRefinementScheduler<TypeTraits, GainTypes>::refineImpl(
             << "( Blocks =" << blocksOfSearch(search_id)
             << ", Refiner =" << i << ")";
         timer.start_timer("region_growing", "Grow Region", true);
+        HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+        // Region growing shares the threads assigned to the search
+        const size_t num_threads = _refiner.acquireFreeThreads();
         const Subhypergraph sub_hg =
-          _constructor.construct(search_id, _quotient_graph, phg);
+          _constructor.construct(search_id, _quotient_graph, phg, num_threads);
+        _refiner.releaseThreads(num_threads);
         _quotient_graph.finalizeConstruction(search_id);
+        HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+        const int64_t region_growing_time_us =
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        _stats.region_growing_time_us += region_growing_time_us;
         timer.stop_timer("region_growing");
 
         HyperedgeWeight delta = 0;
         bool improved_solution = false;
         if ( sub_hg.numNodes() > 0 ) {
           ++_stats.num_refinements;
+          start = std::chrono::high_resolution_clock::now();
           MoveSequence sequence = _refiner.refine(search_id, phg, sub_hg);
+          end = std::chrono::high_resolution_clock::now();
+          const int64_t refinement_time_us =
+            std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+          _stats.refinement_time_us += refinement_time_us;
+          DBG << "Search" << search_id << "( Threads =" << num_threads
+              << ", Nodes =" << sub_hg.numNodes()
+              << ", Region Growing =" << region_growing_time_us << "us"
+              << ", Flow Refinement =" << refinement_time_us << "us )";
 
           if ( !sequence.moves.empty() ) {
             timer.start_timer("apply_moves", "Apply Moves", true);
@@ -75,7 +75,9 @@ class FlowRefinementScheduler final : public IRefiner {
       failed_updates_due_to_conflicting_moves(0),
       failed_updates_due_to_conflicting_moves_without_rollback(0),
       failed_updates_due_to_balance_constraint(0),
-      total_improvement(0) { }
+      total_improvement(0),
+      region_growing_time_us(0),
+      refinement_time_us(0) { }
 
     void reset() {
       num_refinements.store(0);
@@ -87,6 +89,8 @@ class FlowRefinementScheduler final : public IRefiner {
       failed_updates_due_to_conflicting_moves_without_rollback.store(0);
       failed_updates_due_to_balance_constraint.store(0);
       total_improvement.store(0);
+      region_growing_time_us.store(0);
+      refinement_time_us.store(0);
     }
 
     void update_global_stats();
@@ -101,6 +105,10 @@ class FlowRefinementScheduler final : public IRefiner {
     CAtomic<int64_t> failed_updates_due_to_conflicting_moves_without_rollback;
     CAtomic<int64_t> failed_updates_due_to_balance_constraint;
     CAtomic<HyperedgeWeight> total_improvement;
+    // ! Accumulated time spent in region growing and in the flow refiner
+    // ! (network construction + max-flow computation) of all searches
+    CAtomic<int64_t> region_growing_time_us;
+    CAtomic<int64_t> refinement_time_us;
   };
 
   struct PartWeightUpdateResult {
@@ -137,6 +145,8 @@ class FlowRefinementScheduler final : public IRefiner {
     str << "+ Time Limits                       = "
         << progress_bar(stats.num_time_limits, stats.num_refinements,
             [&](const double percentage) { return percentage < 0.0025 ? GREEN : percentage < 0.01 ? YELLOW : RED; }) << "\n";
+    str << "Region Growing Time                 = " << stats.region_growing_time_us / 1000000.0 << " s\n";
+    str << "Flow Refinement Time                = " << stats.refinement_time_us / 1000000.0 << " s\n";
     str << "---------------------------------------------------------------";
     return str;
   }
@@ -193,7 +193,7 @@ struct FMSharedData {
     }, [&] {
       vertexPQHandles.resize(numNodes, invalid_position);
     }, [&] {
-      refinementNodes.tls_queues.resize(numThreads);
+      refinementNodes.resize(numThreads);
     }, [&] {
       targetPart.resize(numNodes, kInvalidPartition);
     });
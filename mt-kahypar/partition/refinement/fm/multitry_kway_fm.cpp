@@ -87,6 +87,8 @@ namespace mt_kahypar {
         auto& fm = ets_fm.local();
         while(sharedData.finishedTasks.load(std::memory_order_relaxed) < sharedData.finishedTasksLimit
               && fm.findMoves(phg, task_id, num_seeds)) { /* keep running*/ }
+        // hand back seeds this task stole but did not use, such that running tasks can still pick them up
+        sharedData.refinementNodes.release_stolen_elements(task_id);
         sharedData.finishedTasks.fetch_add(1, std::memory_order_relaxed);
       };
       size_t num_tasks = std::min(num_border_nodes, size_t(TBBInitializer::instance().total_number_of_threads()));
@@ -204,6 +206,13 @@ namespace mt_kahypar {
       sharedData.refinementNodes.shuffle();
     }
 
+    // group seed nodes by their block such that seeds popped or stolen together are clustered
+    if (context.refinement.fm.locality_aware_seeds) {
+      sharedData.refinementNodes.sort_by_key([&](const HypernodeID u) {
+        return phg.partID(u);
+      });
+    }
+
     // requesting new searches activates all nodes by raising the deactivated node marker
     // also clears the array tracking search IDs in case of overflow
     sharedData.nodeTracker.requestNewSearches(static_cast<SearchID>(sharedData.refinementNodes.unsafe_size()));
@@ -63,12 +63,13 @@ void Km1GainCache::initializeGainCache(const PartitionedHypergraph& partitioned_
       }
     });
 
+  const bool unit_edge_weights = partitioned_hg.hasUnitEdgeWeights();
   auto aggregate_contribution_of_he_for_node =
     [&](const PartitionID block_of_u,
         const HyperedgeID he,
         HyperedgeWeight& penalty_aggregator,
         vec<HyperedgeWeight>& benefit_aggregator) {
-    HyperedgeWeight edge_weight = partitioned_hg.edgeWeight(he);
+    HyperedgeWeight edge_weight = unit_edge_weights ? 1 : partitioned_hg.edgeWeight(he);
     if (partitioned_hg.pinCountInPart(he, block_of_u) > 1) {
       penalty_aggregator += edge_weight;
     }
@@ -242,8 +243,10 @@ void Km1GainCache::initializeGainCacheEntryForNode(const PartitionedHypergraph&
                                                   vec<Gain>& benefit_aggregator) {
   PartitionID from = partitioned_hg.partID(u);
   Gain penalty = 0;
+  // On unweighted inputs, we avoid touching the hyperedge array for each incident net
+  const bool unit_edge_weights = partitioned_hg.hasUnitEdgeWeights();
   for (const HyperedgeID& e : partitioned_hg.incidentEdges(u)) {
-    HyperedgeWeight ew = partitioned_hg.edgeWeight(e);
+    HyperedgeWeight ew = unit_edge_weights ? 1 : partitioned_hg.edgeWeight(e);
     if ( partitioned_hg.pinCountInPart(e, from) > 1 ) {
       penalty += ew;
     }
@@ -73,7 +73,7 @@ namespace mt_kahypar {
 
       const HypernodeID num_hypernodes = hypergraph.initialNumNodes();
       const HyperedgeID num_hyperedges = hypergraph.initialNumEdges();
-      const HypernodeID num_pins = hypergraph.initialNumPins();
+      const size_t num_pins = hypergraph.initialNumPins();
 
       auto& pool = parallel::MemoryPool::instance();
 
@@ -143,7 +143,8 @@ namespace mt_kahypar {
         }
       } else {
         const HypernodeID max_he_size = hypergraph.maxEdgeSize();
-        if ( context.partition.preset_type == PresetType::large_k ) {
+        if ( context.partition.preset_type == PresetType::large_k ||
+             context.partition.partition_type == LARGE_K_PARTITIONING ) {
           pool.register_memory_chunk("Refinement", "pin_count_in_part",
                                     ds::SparsePinCounts::num_elements(num_hyperedges, context.partition.k, max_he_size),
                                     sizeof(ds::SparsePinCounts::Value));
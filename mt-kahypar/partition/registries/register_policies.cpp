@@ -68,6 +68,8 @@ REGISTER_POLICY(mt_kahypar_partition_type_t, N_LEVEL_HYPERGRAPH_PARTITIONING,
 REGISTER_POLICY(RatingFunction, RatingFunction::heavy_edge,
                 HeavyEdgeScore);
 #ifdef KAHYPAR_ENABLE_EXPERIMENTAL_FEATURES
+REGISTER_POLICY(RatingFunction, RatingFunction::algebraic_distance,
+                AlgebraicDistanceScore);
 REGISTER_POLICY(RatingFunction, RatingFunction::sameness,
                 SamenessScore);
 #endif
@@ -0,0 +1,163 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <utility>
+
+#include "tbb/task_arena.h"
+#include "tbb/task_scheduler_observer.h"
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/parallel/tbb_initializer.h"
+#include "mt-kahypar/utils/randomize.h"
+#include "mt-kahypar/utils/utilities.h"
+
+namespace mt_kahypar {
+
+/**
+ * A session owns the resources of one partitioning request: a task arena
+ * with a fixed number of threads, its own random number generators as well
+ * as its own timer and statistics. Several sessions can be used concurrently
+ * from different threads within the same process. Each call is reproducible
+ * for a fixed seed, since it only draws random numbers from the generators
+ * of its session. Calls of a session do not modify the process-wide memory pool.
+ *
+ * The number of threads of a session is bounded by the number of threads of
+ * the global thread pool (see TBBInitializer), since several data structures
+ * are sized by the total number of threads.
+ */
+class Session {
+
+ public:
+  explicit Session(const size_t num_threads) :
+    _num_threads(std::max(UL(1), std::min(num_threads,
+      static_cast<size_t>(TBBInitializer::instance().total_number_of_threads())))),
+    _utility_id(utils::Utilities::instance().registerNewUtilityObjects()),
+    _arena(static_cast<int>(_num_threads)),
+    _rand(),
+    _rand_observer(_arena, _rand) { }
+
+  Session(const Session&) = delete;
+  Session & operator= (const Session &) = delete;
+
+  Session(Session&&) = delete;
+  Session & operator= (Session &&) = delete;
+
+  size_t numThreads() const {
+    return _num_threads;
+  }
+
+  size_t utilityID() const {
+    return _utility_id;
+  }
+
+  utils::Timer& timer() const {
+    return utils::Utilities::instance().getTimer(_utility_id);
+  }
+
+  utils::Stats& stats() const {
+    return utils::Utilities::instance().getStats(_utility_id);
+  }
+
+  // ! Binds the context to the threads, timer and statistics of this session
+  void prepare(Context& context) const {
+    context.shared_memory.original_num_threads = _num_threads;
+    context.shared_memory.num_threads = _num_threads;
+    context.utility_id = _utility_id;
+    context.shared_memory.manage_memory_pool = false;
+  }
+
+  // ! Executes f inside the task arena of this session after seeding the random
+  // ! number generators of the session with the seed of the context. Timer and
+  // ! statistics are reset before such that they only report the last call.
+  template<typename F>
+  auto execute(const Context& context, F&& f) -> decltype(f()) {
+    _rand.setSeed(context.partition.seed);
+    timer().clear();
+    stats().clear();
+    RandomizeBinding binding(&_rand);
+    return _arena.execute(std::forward<F>(f));
+  }
+
+ private:
+  // ! Binds the calling thread to the random number generators of the
+  // ! session and restores the previous binding on destruction
+  class RandomizeBinding {
+   public:
+    explicit RandomizeBinding(utils::Randomize* rand) :
+      _previous(utils::Randomize::boundInstance()) {
+      utils::Randomize::bind(rand);
+    }
+
+    ~RandomizeBinding() {
+      utils::Randomize::bind(_previous);
+    }
+
+   private:
+    utils::Randomize* _previous;
+  };
+
+  // ! Binds the worker threads that join the task arena of
+  // ! the session to the random number generators of the session
+  class RandomizeObserver : public tbb::task_scheduler_observer {
+   public:
+    explicit RandomizeObserver(tbb::task_arena& arena, utils::Randomize& rand) :
+      tbb::task_scheduler_observer(arena),
+      _rand(rand) {
+      observe(true);
+    }
+
+    ~RandomizeObserver() {
+      observe(false);
+    }
+
+    void on_scheduler_entry(bool is_worker) override {
+      if ( is_worker ) {
+        utils::Randomize::bind(&_rand);
+      }
+    }
+
+    void on_scheduler_exit(bool is_worker) override {
+      if ( is_worker ) {
+        utils::Randomize::bind(nullptr);
+      }
+    }
+
+   private:
+    utils::Randomize& _rand;
+  };
+
+  const size_t _num_threads;
+  const size_t _utility_id;
+  tbb::task_arena _arena;
+  utils::Randomize _rand;
+  RandomizeObserver _rand_observer;
+};
+
+}  // namespace mt_kahypar
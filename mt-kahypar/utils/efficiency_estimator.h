@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+
+namespace mt_kahypar {
+namespace utils {
+
+/*!
+ * Exponential moving average of the improvement per second (efficiency) of an
+ * algorithm that is executed repeatedly, e.g., a refiner on each level of the
+ * multilevel hierarchy or a localized search on each batch of uncontractions.
+ */
+class EfficiencyEstimator {
+
+  static constexpr double SMOOTHING_FACTOR = 0.5;
+  static constexpr double MIN_TIME = 1e-6;
+
+ public:
+  EfficiencyEstimator() :
+    _average(0.0),
+    _is_measured(false) { }
+
+  // ! Improvement per second of a single execution
+  static double efficiency(const HyperedgeWeight gain, const double time) {
+    return static_cast<double>(gain) / std::max(time, MIN_TIME);
+  }
+
+  // ! Adds an execution that improved the objective function by gain in time seconds
+  void add(const HyperedgeWeight gain, const double time) {
+    const double current = efficiency(gain, time);
+    _average = _is_measured ? SMOOTHING_FACTOR * current +
+      ( 1.0 - SMOOTHING_FACTOR ) * _average : current;
+    _is_measured = true;
+  }
+
+  double average() const {
+    return _average;
+  }
+
+  bool isMeasured() const {
+    return _is_measured;
+  }
+
+ private:
+  double _average;
+  bool _is_measured;
+};
+
+}  // namespace utils
+}  // namespace mt_kahypar
@@ -42,7 +42,8 @@ struct InitialPartitionerSummary {
     total_sum_quality(0),
     total_time(0.0),
     total_best(0),
-    total_calls(0) { }
+    total_calls(0),
+    total_cancelled(0) { }
 
   friend std::ostream & operator<< (std::ostream& str, const InitialPartitionerSummary& summary);
 
@@ -51,6 +52,7 @@ struct InitialPartitionerSummary {
     total_sum_quality += summary.total_sum_quality;
     total_time += summary.total_time;
     total_calls += summary.total_calls;
+    total_cancelled += summary.total_cancelled;
   }
 
   double average_quality() const {
@@ -70,12 +72,14 @@ struct InitialPartitionerSummary {
   double total_time;
   size_t total_best;
   size_t total_calls;
+  size_t total_cancelled;
 };
 
 inline std::ostream & operator<< (std::ostream& str, const InitialPartitionerSummary& summary) {
   str << " avg_quality_" << summary.algorithm << "=" << summary.average_quality()
       << " total_time_" << summary.algorithm << "=" << summary.total_time
-      << " total_best_" << summary.algorithm << "=" << summary.total_best;
+      << " total_best_" << summary.algorithm << "=" << summary.total_best
+      << " total_cancelled_" << summary.algorithm << "=" << summary.total_cancelled;
   return str;
 }
 
@@ -106,9 +106,26 @@ class Randomize {
   };
 
  public:
+  explicit Randomize() :
+    _rand(std::thread::hardware_concurrency()),
+    _perform_localized_random_shuffle(false),
+    _localized_random_shuffle_block_size(1024) { }
+
+  // ! Returns the instance bound to the calling thread (see bind(...)) or
+  // ! the process-wide instance, if no instance is bound to the thread.
   static Randomize& instance() {
-    static Randomize instance;
-    return instance;
+    Randomize* rand = bound_instance();
+    return rand ? *rand : global_instance();
+  }
+
+  // ! Binds the calling thread to the given instance. Passing nullptr
+  // ! binds the thread to the process-wide instance again.
+  static void bind(Randomize* rand) {
+    bound_instance() = rand;
+  }
+
+  static Randomize* boundInstance() {
+    return bound_instance();
   }
 
   void enableLocalizedParallelShuffle(const size_t localized_random_shuffle_block_size) {
@@ -243,10 +260,15 @@ class Randomize {
   }
 
  private:
-  explicit Randomize() :
-    _rand(std::thread::hardware_concurrency()),
-    _perform_localized_random_shuffle(false),
-    _localized_random_shuffle_block_size(1024) { }
+  static Randomize& global_instance() {
+    static Randomize instance;
+    return instance;
+  }
+
+  static Randomize*& bound_instance() {
+    static thread_local Randomize* rand = nullptr;
+    return rand;
+  }
 
   template <typename T>
   void swapBlocks(parallel::scalable_vector<T>& vector,
@@ -27,6 +27,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <pybind11/functional.h>
+#include <pybind11/numpy.h>
 
 #include "tbb/parallel_for.h"
 
@@ -42,6 +43,7 @@
 #include "mt-kahypar/partition/conversion.h"
 #include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/partition/partitioner.h"
+#include "mt-kahypar/partition/session.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
 #include "mt-kahypar/io/command_line_options.h"
 #include "mt-kahypar/io/hypergraph_factory.h"
@@ -71,6 +73,146 @@ namespace {
     hwloc_bitmap_free(cpuset);
   }
 
+  template<typename T>
+  using NumpyArray = py::array_t<T, py::array::c_style | py::array::forcecast>;
+
+  // ! Calls f with a pointer to the contiguous data of an integer NumPy array.
+  // ! Arrays with 32- or 64-bit integers are used in place (signed integers are
+  // ! reinterpreted as unsigned integers of the same width), all other integer
+  // ! types are converted to 32-bit unsigned integers.
+  template<typename F>
+  auto with_integer_array(const py::array& array, F f) {
+    const char kind = array.dtype().kind();
+    if ( kind != 'i' && kind != 'u' ) {
+      throw py::type_error("Expected an array with an integer data type");
+    }
+    if ( array.itemsize() == 4 || array.itemsize() == 8 ) {
+      const py::array contiguous = py::array::ensure(array, py::array::c_style);
+      if ( !contiguous ) {
+        throw py::error_already_set();
+      }
+      if ( contiguous.itemsize() == 4 ) {
+        return f(static_cast<const uint32_t*>(contiguous.data()));
+      } else {
+        return f(static_cast<const uint64_t*>(contiguous.data()));
+      }
+    }
+    const NumpyArray<uint32_t> converted = NumpyArray<uint32_t>::ensure(array);
+    if ( !converted ) {
+      throw py::error_already_set();
+    }
+    return f(converted.data());
+  }
+
+  // ! Checks that all IDs are in the range [0, num_ids). Negative IDs of signed
+  // ! arrays are reinterpreted as large unsigned integers and therefore rejected.
+  template<typename T>
+  void check_ids(const T* ids,
+                 const size_t num_entries,
+                 const size_t num_ids,
+                 const std::string& name) {
+    for ( size_t i = 0; i < num_entries; ++i ) {
+      if ( static_cast<size_t>(ids[i]) >= num_ids ) {
+        throw py::value_error(name + " contains invalid ID " + std::to_string(ids[i]) +
+          " at position " + std::to_string(i) + " (expected 0 <= ID < " + std::to_string(num_ids) + ")");
+      }
+    }
+  }
+
+  template<typename T>
+  void check_size(const NumpyArray<T>& array,
+                  const size_t expected_size,
+                  const std::string& name) {
+    if ( static_cast<size_t>(array.size()) != expected_size ) {
+      throw py::value_error(name + " must contain " + std::to_string(expected_size) + " entries");
+    }
+  }
+
+  ds::StaticGraph construct_graph(const HypernodeID num_nodes,
+                                  const HyperedgeID num_edges,
+                                  const py::array& edges,
+                                  const HypernodeWeight* node_weights,
+                                  const HyperedgeWeight* edge_weights) {
+    if ( static_cast<size_t>(edges.size()) != 2 * UL(num_edges) ||
+         ( edges.ndim() == 2 && edges.shape(1) != 2 ) ) {
+      throw py::value_error("edges must be an array of shape (num_edges, 2)");
+    }
+    return with_integer_array(edges, [&](const auto* edge_data) {
+      check_ids(edge_data, 2 * UL(num_edges), num_nodes, "edges");
+      py::gil_scoped_release release;
+      return ds::StaticGraphFactory::construct_from_graph_edges(
+        num_nodes, num_edges, edge_data, edge_weights, node_weights, true);
+    });
+  }
+
+  ds::StaticHypergraph construct_hypergraph(const HypernodeID num_hypernodes,
+                                            const HyperedgeID num_hyperedges,
+                                            const py::array& hyperedge_indices,
+                                            const py::array& hyperedges,
+                                            const HypernodeWeight* node_weights,
+                                            const HyperedgeWeight* hyperedge_weights) {
+    const NumpyArray<size_t> indices = NumpyArray<size_t>::ensure(hyperedge_indices);
+    if ( !indices ) {
+      throw py::error_already_set();
+    }
+    check_size(indices, UL(num_hyperedges) + 1, "hyperedge_indices");
+    const size_t* index_data = indices.data();
+    if ( index_data[0] != 0 ) {
+      throw py::value_error("hyperedge_indices must start with 0");
+    }
+    for ( HyperedgeID he = 0; he < num_hyperedges; ++he ) {
+      if ( index_data[he] > index_data[he + 1] ) {
+        throw py::value_error("hyperedge_indices must be non-decreasing (position " +
+          std::to_string(he + 1) + ")");
+      }
+    }
+    if ( static_cast<size_t>(hyperedges.size()) != index_data[num_hyperedges] ) {
+      throw py::value_error("hyperedges must contain hyperedge_indices[num_hyperedges] entries");
+    }
+    return with_integer_array(hyperedges, [&](const auto* pins) {
+      check_ids(pins, index_data[num_hyperedges], num_hypernodes, "hyperedges");
+      py::gil_scoped_release release;
+      return ds::StaticHypergraphFactory::construct(num_hypernodes, num_hyperedges,
+        index_data, pins, hyperedge_weights, node_weights, true);
+    });
+  }
+
+  template<typename PartitionedHypergraph, typename Hypergraph>
+  PartitionedHypergraph create_partitioned_hypergraph(Hypergraph& hypergraph,
+                                                      const PartitionID num_blocks,
+                                                      const PartitionID* partition) {
+    PartitionedHypergraph partitioned_hg(num_blocks, hypergraph, parallel_tag_t { });
+    partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+      if ( partition[hn] < 0 || partition[hn] >= num_blocks ) {
+        ERR("Invalid block ID for node" << hn << "( block ID =" << partition[hn] << ")");
+      }
+      partitioned_hg.setOnlyNodePart(hn, partition[hn]);
+    });
+    partitioned_hg.initializePartition();
+    return partitioned_hg;
+  }
+
+  template<typename PartitionedHypergraph, typename Hypergraph>
+  PartitionedHypergraph create_partitioned_hypergraph(Hypergraph& hypergraph,
+                                                      const PartitionID num_blocks,
+                                                      const NumpyArray<PartitionID>& partition) {
+    check_size(partition, hypergraph.initialNumNodes(), "partition");
+    const PartitionID* partition_data = partition.data();
+    py::gil_scoped_release release;
+    return create_partitioned_hypergraph<PartitionedHypergraph>(hypergraph, num_blocks, partition_data);
+  }
+
+  // ! Returns a read-only NumPy view on the block IDs of all nodes. The view
+  // ! keeps the partitioned hypergraph alive and reflects later changes of the partition.
+  template<typename PartitionedHypergraph>
+  py::array_t<PartitionID> block_ids(const py::object& self) {
+    const PartitionedHypergraph& partitioned_hg = self.cast<const PartitionedHypergraph&>();
+    py::array_t<PartitionID> view(static_cast<py::ssize_t>(partitioned_hg.initialNumNodes()),
+      partitioned_hg.partIDs(), self);
+    view.attr("flags").attr("writeable") = false;
+    return view;
+  }
+
   template<typename PartitionedHypergraph>
   double imbalance(const PartitionedHypergraph& partitioned_graph) {
     const mt_kahypar::HypernodeWeight perfectly_balanced_weight =
@@ -84,8 +226,9 @@ namespace {
   }
 
   template<typename TypeTraits>
-  typename TypeTraits::PartitionedHypergraph partition(typename TypeTraits::Hypergraph& hypergraph,
-                                                       Context& context) {
+  typename TypeTraits::PartitionedHypergraph partition_in_session(typename TypeTraits::Hypergraph& hypergraph,
+                                                                  Context& context,
+                                                                  Session* session) {
     using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
     const bool is_graph = PartitionedHypergraph::TYPE == MULTILEVEL_GRAPH_PARTITIONING ||
                           PartitionedHypergraph::TYPE == N_LEVEL_HYPERGRAPH_PARTITIONING;
@@ -97,9 +240,11 @@ namespace {
           context.partition.instance_type = lib::get_instance_type(hg);
           context.partition.partition_type = to_partition_c_type(
             context.partition.preset_type, context.partition.instance_type);
-          lib::prepare_context(context);
+          lib::prepare_context(context, session);
           context.partition.num_vcycles = 0;
-          return Partitioner<TypeTraits>::partition(hypergraph, context);
+          return lib::execute(session, context, [&] {
+            return Partitioner<TypeTraits>::partition(hypergraph, context);
+          });
         } else {
           WARNING(lib::incompatibility_description(hg));
         }
@@ -112,9 +257,10 @@ namespace {
   }
 
   template<typename TypeTraits>
-  typename TypeTraits::PartitionedHypergraph map(typename TypeTraits::Hypergraph& hypergraph,
-                                                 ds::StaticGraph& graph,
-                                                 Context& context) {
+  typename TypeTraits::PartitionedHypergraph map_in_session(typename TypeTraits::Hypergraph& hypergraph,
+                                                            ds::StaticGraph& graph,
+                                                            Context& context,
+                                                            Session* session) {
     using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
     const bool is_graph = PartitionedHypergraph::TYPE == MULTILEVEL_GRAPH_PARTITIONING ||
                           PartitionedHypergraph::TYPE == N_LEVEL_GRAPH_PARTITIONING;
@@ -126,11 +272,13 @@ namespace {
           context.partition.instance_type = lib::get_instance_type(hg);
           context.partition.partition_type = to_partition_c_type(
             context.partition.preset_type, context.partition.instance_type);
-          lib::prepare_context(context);
+          lib::prepare_context(context, session);
           context.partition.num_vcycles = 0;
           context.partition.objective = Objective::steiner_tree;
           TargetGraph target_graph(graph.copy(parallel_tag_t { }));
-          return Partitioner<TypeTraits>::partition(hypergraph, context, &target_graph);
+          return lib::execute(session, context, [&] {
+            return Partitioner<TypeTraits>::partition(hypergraph, context, &target_graph);
+          });
         } else {
           WARNING(lib::incompatibility_description(hg));
         }
@@ -143,18 +291,21 @@ namespace {
   }
 
   template<typename TypeTraits>
-  void improve(typename TypeTraits::PartitionedHypergraph& partitioned_hg,
-               Context& context,
-               const size_t num_vcycles) {
+  void improve_in_session(typename TypeTraits::PartitionedHypergraph& partitioned_hg,
+                          Context& context,
+                          const size_t num_vcycles,
+                          Session* session) {
     if ( lib::check_if_all_relavant_parameters_are_set(context) ) {
       mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(partitioned_hg);
       if ( lib::check_compatibility(phg, lib::get_preset_c_type(context.partition.preset_type)) ) {
         context.partition.instance_type = lib::get_instance_type(phg);
         context.partition.partition_type = to_partition_c_type(
           context.partition.preset_type, context.partition.instance_type);
-        lib::prepare_context(context);
+        lib::prepare_context(context, session);
         context.partition.num_vcycles = num_vcycles;
-        Partitioner<TypeTraits>::partitionVCycle(partitioned_hg, context);
+        lib::execute(session, context, [&] {
+          Partitioner<TypeTraits>::partitionVCycle(partitioned_hg, context);
+        });
       } else {
         WARNING(lib::incompatibility_description(phg));
       }
@@ -162,27 +313,95 @@ namespace {
   }
 
   template<typename TypeTraits>
-  void improveMapping(typename TypeTraits::PartitionedHypergraph& partitioned_hg,
-                      ds::StaticGraph& graph,
-                      Context& context,
-                      const size_t num_vcycles) {
+  void improve_mapping_in_session(typename TypeTraits::PartitionedHypergraph& partitioned_hg,
+                                  ds::StaticGraph& graph,
+                                  Context& context,
+                                  const size_t num_vcycles,
+                                  Session* session) {
     if ( lib::check_if_all_relavant_parameters_are_set(context) ) {
       mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(partitioned_hg);
       if ( lib::check_compatibility(phg, lib::get_preset_c_type(context.partition.preset_type)) ) {
         context.partition.instance_type = lib::get_instance_type(phg);
         context.partition.partition_type = to_partition_c_type(
           context.partition.preset_type, context.partition.instance_type);
-        lib::prepare_context(context);
+        lib::prepare_context(context, session);
         context.partition.num_vcycles = num_vcycles;
         context.partition.objective = Objective::steiner_tree;
         TargetGraph target_graph(graph.copy(parallel_tag_t { }));
         partitioned_hg.setTargetGraph(&target_graph);
-        Partitioner<TypeTraits>::partitionVCycle(partitioned_hg, context, &target_graph);
+        lib::execute(session, context, [&] {
+          Partitioner<TypeTraits>::partitionVCycle(partitioned_hg, context, &target_graph);
+        });
       } else {
         WARNING(lib::incompatibility_description(phg));
       }
     }
   }
+  template<typename TypeTraits>
+  typename TypeTraits::PartitionedHypergraph partition(typename TypeTraits::Hypergraph& hypergraph,
+                                                       Context& context) {
+    return partition_in_session<TypeTraits>(hypergraph, context, nullptr);
+  }
+
+  template<typename TypeTraits>
+  typename TypeTraits::PartitionedHypergraph map(typename TypeTraits::Hypergraph& hypergraph,
+                                                 ds::StaticGraph& graph,
+                                                 Context& context) {
+    return map_in_session<TypeTraits>(hypergraph, graph, context, nullptr);
+  }
+
+  template<typename TypeTraits>
+  void improve(typename TypeTraits::PartitionedHypergraph& partitioned_hg,
+               Context& context,
+               const size_t num_vcycles) {
+    improve_in_session<TypeTraits>(partitioned_hg, context, num_vcycles, nullptr);
+  }
+
+  template<typename TypeTraits>
+  void improveMapping(typename TypeTraits::PartitionedHypergraph& partitioned_hg,
+                      ds::StaticGraph& graph,
+                      Context& context,
+                      const size_t num_vcycles) {
+    improve_mapping_in_session<TypeTraits>(partitioned_hg, graph, context, num_vcycles, nullptr);
+  }
+
+  // ! Calls within a session work on a copy of the context, such that
+  // ! the same context can be shared by several sessions
+  template<typename TypeTraits>
+  typename TypeTraits::PartitionedHypergraph session_partition(Session& session,
+                                                               typename TypeTraits::Hypergraph& hypergraph,
+                                                               const Context& context) {
+    Context session_context(context);
+    return partition_in_session<TypeTraits>(hypergraph, session_context, &session);
+  }
+
+  template<typename TypeTraits>
+  typename TypeTraits::PartitionedHypergraph session_map(Session& session,
+                                                         typename TypeTraits::Hypergraph& hypergraph,
+                                                         ds::StaticGraph& graph,
+                                                         const Context& context) {
+    Context session_context(context);
+    return map_in_session<TypeTraits>(hypergraph, graph, session_context, &session);
+  }
+
+  template<typename TypeTraits>
+  void session_improve(Session& session,
+                       typename TypeTraits::PartitionedHypergraph& partitioned_hg,
+                       const Context& context,
+                       const size_t num_vcycles) {
+    Context session_context(context);
+    improve_in_session<TypeTraits>(partitioned_hg, session_context, num_vcycles, &session);
+  }
+
+  template<typename TypeTraits>
+  void session_improve_mapping(Session& session,
+                               typename TypeTraits::PartitionedHypergraph& partitioned_hg,
+                               ds::StaticGraph& graph,
+                               const Context& context,
+                               const size_t num_vcycles) {
+    Context session_context(context);
+    improve_mapping_in_session<TypeTraits>(partitioned_hg, graph, session_context, num_vcycles, &session);
+  }
 }
 
 PYBIND11_MODULE(mtkahypar, m) {
@@ -308,6 +527,43 @@ PYBIND11_MODULE(mtkahypar, m) {
   using Graph = ds::StaticGraph;
   using GraphFactory = typename Graph::Factory;
   py::class_<Graph>(m, "Graph")
+    .def(py::init<>([](const HypernodeID num_nodes,
+                       const HyperedgeID num_edges,
+                       const py::array& edges) {
+        return construct_graph(num_nodes, num_edges, edges, nullptr, nullptr);
+      }), R"pbdoc(
+Construct an unweighted graph from a NumPy array.
+
+:param num_nodes: Number of nodes
+:param num_edges: Number of edges
+:param edges: NumPy array of shape (num_edges, 2) with an integer data type containing all edges
+          )pbdoc",
+      py::arg("num_nodes"),
+      py::arg("num_edges"),
+      py::arg("edges"))
+    .def(py::init<>([](const HypernodeID num_nodes,
+                       const HyperedgeID num_edges,
+                       const py::array& edges,
+                       const NumpyArray<HypernodeWeight>& node_weights,
+                       const NumpyArray<HyperedgeWeight>& edge_weights) {
+        check_size(node_weights, num_nodes, "node_weights");
+        check_size(edge_weights, num_edges, "edge_weights");
+        return construct_graph(num_nodes, num_edges, edges,
+          node_weights.data(), edge_weights.data());
+      }), R"pbdoc(
+Construct a weighted graph from NumPy arrays.
+
+:param num_nodes: Number of nodes
+:param num_edges: Number of edges
+:param edges: NumPy array of shape (num_edges, 2) with an integer data type containing all edges
+:param node_weights: Weights of all nodes
+:param edge_weights: Weights of all edges
+          )pbdoc",
+      py::arg("num_nodes"),
+      py::arg("num_edges"),
+      py::arg("edges"),
+      py::arg("node_weights"),
+      py::arg("edge_weights"))
     .def(py::init<>([](const HypernodeID num_nodes,
                        const HyperedgeID num_edges,
                        const vec<std::pair<HypernodeID,HypernodeID>>& edges) {
@@ -346,6 +602,7 @@ Construct a weighted graph.
       py::arg("edge_weights"))
     .def(py::init<>([](const std::string& file_name,
                       const FileFormat file_format) {
+        py::gil_scoped_release release;
         return io::readInputFile<Graph>(file_name, file_format, true);
       }), "Reads a graph from a file (supported file formats are METIS and HMETIS)",
       py::arg("filename"), py::arg("format"))
@@ -406,7 +663,7 @@ Construct a weighted graph.
       py::arg("node"), py::arg("lambda"))
     .def("partition", &partition<StaticGraphTypeTraits>,
       "Partitions the graph with the parameters given in the corresponding context",
-      py::arg("context"))
+      py::call_guard<py::gil_scoped_release>(), py::arg("context"))
     .def("mapOntoGraph", &map<StaticGraphTypeTraits>,
       R"pbdoc(
   Maps a (hyper)graph onto a target graph with the configuration specified in the partitioning context.
@@ -416,13 +673,61 @@ Construct a weighted graph.
   that spans a subset of the nodes (in our case the hyperedges) on the target graph. This objective function
   is able to acurately model wire-lengths in VLSI design or communication costs in a distributed system where some
   processors do not communicate directly with each other or different speeds.
-          )pbdoc", py::arg("target_graph"), py::arg("context"));
+          )pbdoc", py::call_guard<py::gil_scoped_release>(), py::arg("target_graph"), py::arg("context"));
 
   // ####################### Hypergraph #######################
 
   using Hypergraph = ds::StaticHypergraph;
   using HypergraphFactory = typename Hypergraph::Factory;
   py::class_<Hypergraph>(m, "Hypergraph")
+    .def(py::init<>([](const HypernodeID num_hypernodes,
+                       const HyperedgeID num_hyperedges,
+                       const py::array& hyperedge_indices,
+                       const py::array& hyperedges) {
+        return construct_hypergraph(num_hypernodes, num_hyperedges,
+          hyperedge_indices, hyperedges, nullptr, nullptr);
+      }), R"pbdoc(
+Construct an unweighted hypergraph from NumPy arrays in CSR format.
+
+:param num_hypernodes: Number of nodes
+:param num_hyperedges: Number of hyperedges
+:param hyperedge_indices: NumPy array with num_hyperedges + 1 entries containing the start
+  position of each hyperedge in hyperedges (e.g., [0,2,5,...])
+:param hyperedges: NumPy array with an integer data type containing the pins of all hyperedges
+  (e.g., [0,1,0,2,3,...])
+          )pbdoc",
+      py::arg("num_hypernodes"),
+      py::arg("num_hyperedges"),
+      py::arg("hyperedge_indices"),
+      py::arg("hyperedges"))
+    .def(py::init<>([](const HypernodeID num_hypernodes,
+                       const HyperedgeID num_hyperedges,
+                       const py::array& hyperedge_indices,
+                       const py::array& hyperedges,
+                       const NumpyArray<HypernodeWeight>& node_weights,
+                       const NumpyArray<HyperedgeWeight>& hyperedge_weights) {
+        check_size(node_weights, num_hypernodes, "node_weights");
+        check_size(hyperedge_weights, num_hyperedges, "hyperedge_weights");
+        return construct_hypergraph(num_hypernodes, num_hyperedges,
+          hyperedge_indices, hyperedges, node_weights.data(), hyperedge_weights.data());
+      }), R"pbdoc(
+Construct a weighted hypergraph from NumPy arrays in CSR format.
+
+:param num_hypernodes: Number of nodes
+:param num_hyperedges: Number of hyperedges
+:param hyperedge_indices: NumPy array with num_hyperedges + 1 entries containing the start
+  position of each hyperedge in hyperedges (e.g., [0,2,5,...])
+:param hyperedges: NumPy array with an integer data type containing the pins of all hyperedges
+  (e.g., [0,1,0,2,3,...])
+:param node_weights: Weights of all hypernodes
+:param hyperedge_weights: Weights of all hyperedges
+          )pbdoc",
+      py::arg("num_hypernodes"),
+      py::arg("num_hyperedges"),
+      py::arg("hyperedge_indices"),
+      py::arg("hyperedges"),
+      py::arg("node_weights"),
+      py::arg("hyperedge_weights"))
     .def(py::init<>([](const HypernodeID num_hypernodes,
                        const HyperedgeID num_hyperedges,
                        const vec<vec<HypernodeID>>& hyperedges) {
@@ -462,6 +767,7 @@ Construct a weighted hypergraph.
       py::arg("hyperedge_weights"))
     .def(py::init<>([](const std::string& file_name,
                        const FileFormat file_format) {
+        py::gil_scoped_release release;
         return io::readInputFile<Hypergraph>(file_name, file_format, true);
       }), "Reads a hypergraph from a file (supported file formats are METIS and HMETIS)",
       py::arg("filename"), py::arg("format"))
@@ -517,10 +823,10 @@ Construct a weighted hypergraph.
       py::arg("hyperedge"), py::arg("lambda"))
     .def("partition", &partition<StaticHypergraphTypeTraits>,
       "Partitions the hypergraph with the parameters given in the corresponding context",
-      py::arg("context"))
+      py::call_guard<py::gil_scoped_release>(), py::arg("context"))
     .def("partitionIntoLargeK", &partition<LargeKHypergraphTypeTraits>,
       "Partitions the hypergraph into a large number of blocks with the parameters given in the corresponding context",
-      py::arg("context"))
+      py::call_guard<py::gil_scoped_release>(), py::arg("context"))
     .def("mapOntoGraph", &map<StaticHypergraphTypeTraits>,
       R"pbdoc(
   Maps a (hyper)graph onto a target graph with the configuration specified in the partitioning context.
@@ -530,24 +836,28 @@ Construct a weighted hypergraph.
   that spans a subset of the nodes (in our case the hyperedges) on the target graph. This objective function
   is able to acurately model wire-lengths in VLSI design or communication costs in a distributed system where some
   processors do not communicate directly with each other or different speeds.
-          )pbdoc", py::arg("target_graph"), py::arg("context"));
+          )pbdoc", py::call_guard<py::gil_scoped_release>(), py::arg("target_graph"), py::arg("context"));
 
   // ####################### Partitioned Graph #######################
 
   using PartitionedGraph = typename StaticGraphTypeTraits::PartitionedHypergraph;
   py::class_<PartitionedGraph>(m, "PartitionedGraph")
+    .def(py::init<>([](Graph& graph,
+                       const PartitionID num_blocks,
+                       const NumpyArray<PartitionID>& partition) {
+        return create_partitioned_hypergraph<PartitionedGraph>(graph, num_blocks, partition);
+      }), R"pbdoc(
+Construct a partitioned graph from a NumPy array.
+
+:param graph: graph object
+:param num_blocks: number of block in which the graph should be partitioned into
+:param partition: NumPy array containing the block ID of each node
+          )pbdoc",
+      py::arg("graph"), py::arg("num_blocks"), py::arg("partition"))
     .def(py::init<>([](Graph& graph,
                        const PartitionID num_blocks,
                        const vec<PartitionID>& partition) {
-        PartitionedGraph partitioned_graph(num_blocks, graph, parallel_tag_t { });
-        partitioned_graph.doParallelForAllNodes([&](const HypernodeID& hn) {
-          if ( partition[hn] < 0 || partition[hn] >= num_blocks ) {
-            ERR("Invalid block ID for node" << hn << "( block ID =" << partition[hn] << ")");
-          }
-          partitioned_graph.setOnlyNodePart(hn, partition[hn]);
-        });
-        partitioned_graph.initializePartition();
-        return partitioned_graph;
+        return create_partitioned_hypergraph<PartitionedGraph>(graph, num_blocks, partition.data());
       }), R"pbdoc(
 Construct a partitioned graph.
 
@@ -561,15 +871,7 @@ Construct a partitioned graph.
                        const std::string& partition_file) {
         std::vector<PartitionID> partition;
         io::readPartitionFile(partition_file, partition);
-        PartitionedGraph partitioned_graph(num_blocks, graph, mt_kahypar::parallel_tag_t { });
-        partitioned_graph.doParallelForAllNodes([&](const HypernodeID& hn) {
-          if ( partition[hn] < 0 || partition[hn] >= num_blocks ) {
-            ERR("Invalid block ID for node" << hn << "( block ID =" << partition[hn] << ")");
-          }
-          partitioned_graph.setOnlyNodePart(hn, partition[hn]);
-        });
-        partitioned_graph.initializePartition();
-        return partitioned_graph;
+        return create_partitioned_hypergraph<PartitionedGraph>(graph, num_blocks, partition.data());
       }), R"pbdoc(
 Construct a partitioned graph.
 
@@ -584,6 +886,8 @@ Construct a partitioned graph.
       "Weight of the corresponding block", py::arg("block"))
     .def("blockID", &PartitionedGraph::partID,
       "Block to which the corresponding node is assigned", py::arg("node"))
+    .def("blockIDs", &block_ids<PartitionedGraph>,
+      "Read-only NumPy view on the block IDs of all nodes")
     .def("isIncidentToCutEdge", &PartitionedGraph::isBorderNode,
       "Returns true, if the corresponding node is incident to at least one cut edge",
       py::arg("node"))
@@ -621,30 +925,34 @@ Construct a partitioned graph.
                                     const std::string& partition_file) {
         io::writePartitionFile(partitioned_graph, partition_file);
       }, "Writes the partition to a file",
-      py::arg("partition_file"))
+      py::call_guard<py::gil_scoped_release>(), py::arg("partition_file"))
     .def("improvePartition", &improve<StaticGraphTypeTraits>,
       "Improves the partition using the iterated multilevel cycle technique (V-cycles)",
-      py::arg("context"), py::arg("num_vcycles"))
+      py::call_guard<py::gil_scoped_release>(), py::arg("context"), py::arg("num_vcycles"))
     .def("improveMapping", &improveMapping<StaticGraphTypeTraits>,
       "Improves a mapping onto a graph using the iterated multilevel cycle technique (V-cycles)",
-      py::arg("target_graph"), py::arg("context"), py::arg("num_vcycles"));
+      py::call_guard<py::gil_scoped_release>(), py::arg("target_graph"), py::arg("context"), py::arg("num_vcycles"));
 
   // ####################### Partitioned Hypergraph #######################
 
   using PartitionedHypergraph = typename StaticHypergraphTypeTraits::PartitionedHypergraph;
   py::class_<PartitionedHypergraph>(m, "PartitionedHypergraph")
+    .def(py::init<>([](Hypergraph& hypergraph,
+                       const PartitionID num_blocks,
+                       const NumpyArray<PartitionID>& partition) {
+        return create_partitioned_hypergraph<PartitionedHypergraph>(hypergraph, num_blocks, partition);
+      }), R"pbdoc(
+Construct a partitioned hypergraph from a NumPy array.
+
+:param hypergraph: hypergraph object
+:param num_blocks: number of block in which the hypergraph should be partitioned into
+:param partition: NumPy array containing the block ID of each node
+          )pbdoc",
+      py::arg("hypergraph"), py::arg("num_blocks"), py::arg("partition"))
     .def(py::init<>([](Hypergraph& hypergraph,
                        const PartitionID num_blocks,
                        const vec<PartitionID>& partition) {
-        PartitionedHypergraph partitioned_hg(num_blocks, hypergraph, parallel_tag_t { });
-        partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
-          if ( partition[hn] < 0 || partition[hn] >= num_blocks ) {
-            ERR("Invalid block ID for node" << hn << "( block ID =" << partition[hn] << ")");
-          }
-          partitioned_hg.setOnlyNodePart(hn, partition[hn]);
-        });
-        partitioned_hg.initializePartition();
-        return partitioned_hg;
+        return create_partitioned_hypergraph<PartitionedHypergraph>(hypergraph, num_blocks, partition.data());
       }), R"pbdoc(
 Construct a partitioned hypergraph.
 
@@ -658,15 +966,7 @@ Construct a partitioned hypergraph.
                        const std::string& partition_file) {
         std::vector<PartitionID> partition;
         io::readPartitionFile(partition_file, partition);
-        PartitionedHypergraph partitioned_hg(num_blocks, hypergraph, parallel_tag_t { });
-        partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
-          if ( partition[hn] < 0 || partition[hn] >= num_blocks ) {
-            ERR("Invalid block ID for node" << hn << "( block ID =" << partition[hn] << ")");
-          }
-          partitioned_hg.setOnlyNodePart(hn, partition[hn]);
-        });
-        partitioned_hg.initializePartition();
-        return partitioned_hg;
+        return create_partitioned_hypergraph<PartitionedHypergraph>(hypergraph, num_blocks, partition.data());
       }), R"pbdoc(
 Construct a partitioned hypergraph.
 
@@ -681,6 +981,8 @@ Construct a partitioned hypergraph.
       "Weight of the corresponding block", py::arg("block"))
     .def("blockID", &PartitionedHypergraph::partID,
       "Block to which the corresponding node is assigned", py::arg("node"))
+    .def("blockIDs", &block_ids<PartitionedHypergraph>,
+      "Read-only NumPy view on the block IDs of all nodes")
     .def("isIncidentToCutEdge", &PartitionedHypergraph::isBorderNode,
       "Returns true, if the corresponding node is incident to at least one cut hyperedge",
       py::arg("node"))
@@ -729,30 +1031,34 @@ Construct a partitioned hypergraph.
                                     const std::string& partition_file) {
         io::writePartitionFile(partitioned_hg, partition_file);
       }, "Writes the partition to a file",
-      py::arg("partition_file"))
+      py::call_guard<py::gil_scoped_release>(), py::arg("partition_file"))
     .def("improvePartition", &improve<StaticHypergraphTypeTraits>,
       "Improves the partition using the iterated multilevel cycle technique (V-cycles)",
-      py::arg("context"), py::arg("num_vcycles"))
+      py::call_guard<py::gil_scoped_release>(), py::arg("context"), py::arg("num_vcycles"))
     .def("improveMapping", &improveMapping<StaticHypergraphTypeTraits>,
       "Improves a mapping onto a graph using the iterated multilevel cycle technique (V-cycles)",
-      py::arg("target_graph"), py::arg("context"), py::arg("num_vcycles"));
+      py::call_guard<py::gil_scoped_release>(), py::arg("target_graph"), py::arg("context"), py::arg("num_vcycles"));
 
  // ####################### Partitioned Hypergraph #######################
 
   using SparsePartitionedHypergraph = typename LargeKHypergraphTypeTraits::PartitionedHypergraph;
   py::class_<SparsePartitionedHypergraph>(m, "SparsePartitionedHypergraph")
+    .def(py::init<>([](Hypergraph& hypergraph,
+                       const PartitionID num_blocks,
+                       const NumpyArray<PartitionID>& partition) {
+        return create_partitioned_hypergraph<SparsePartitionedHypergraph>(hypergraph, num_blocks, partition);
+      }), R"pbdoc(
+Construct a partitioned hypergraph from a NumPy array.
+
+:param hypergraph: hypergraph object
+:param num_blocks: number of block in which the hypergraph should be partitioned into
+:param partition: NumPy array containing the block ID of each node
+          )pbdoc",
+      py::arg("hypergraph"), py::arg("num_blocks"), py::arg("partition"))
     .def(py::init<>([](Hypergraph& hypergraph,
                        const PartitionID num_blocks,
                        const vec<PartitionID>& partition) {
-        SparsePartitionedHypergraph partitioned_hg(num_blocks, hypergraph, parallel_tag_t { });
-        partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
-          if ( partition[hn] < 0 || partition[hn] >= num_blocks ) {
-            ERR("Invalid block ID for node" << hn << "( block ID =" << partition[hn] << ")");
-          }
-          partitioned_hg.setOnlyNodePart(hn, partition[hn]);
-        });
-        partitioned_hg.initializePartition();
-        return partitioned_hg;
+        return create_partitioned_hypergraph<SparsePartitionedHypergraph>(hypergraph, num_blocks, partition.data());
       }), R"pbdoc(
 Construct a partitioned hypergraph.
 
@@ -766,15 +1072,7 @@ Construct a partitioned hypergraph.
                        const std::string& partition_file) {
         std::vector<PartitionID> partition;
         io::readPartitionFile(partition_file, partition);
-        SparsePartitionedHypergraph partitioned_hg(num_blocks, hypergraph, parallel_tag_t { });
-        partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
-          if ( partition[hn] < 0 || partition[hn] >= num_blocks ) {
-            ERR("Invalid block ID for node" << hn << "( block ID =" << partition[hn] << ")");
-          }
-          partitioned_hg.setOnlyNodePart(hn, partition[hn]);
-        });
-        partitioned_hg.initializePartition();
-        return partitioned_hg;
+        return create_partitioned_hypergraph<SparsePartitionedHypergraph>(hypergraph, num_blocks, partition.data());
       }), R"pbdoc(
 Construct a partitioned hypergraph.
 
@@ -789,6 +1087,8 @@ Construct a partitioned hypergraph.
       "Weight of the corresponding block", py::arg("block"))
     .def("blockID", &SparsePartitionedHypergraph::partID,
       "Block to which the corresponding node is assigned", py::arg("node"))
+    .def("blockIDs", &block_ids<SparsePartitionedHypergraph>,
+      "Read-only NumPy view on the block IDs of all nodes")
     .def("isIncidentToCutEdge", &SparsePartitionedHypergraph::isBorderNode,
       "Returns true, if the corresponding node is incident to at least one cut hyperedge",
       py::arg("node"))
@@ -829,9 +1129,54 @@ Construct a partitioned hypergraph.
                                     const std::string& partition_file) {
         io::writePartitionFile(partitioned_hg, partition_file);
       }, "Writes the partition to a file",
-      py::arg("partition_file"))
+      py::call_guard<py::gil_scoped_release>(), py::arg("partition_file"))
     .def("improve", &improve<LargeKHypergraphTypeTraits>,
       "Improves the partition using the iterated multilevel cycle technique (V-cycles)",
+      py::call_guard<py::gil_scoped_release>(), py::arg("context"), py::arg("num_vcycles"));
+
+  // ####################### Session #######################
+
+  py::class_<Session>(m, "Session")
+    .def(py::init<size_t>(), R"pbdoc(
+  Creates a new session. A session owns a task arena with the given number of threads
+  as well as its own timer and statistics. Sessions can be used from different Python threads.
+  Since the random number generators are shared by all sessions and reseeded for each call,
+  the partitioning calls of all sessions are serialized.
+  The number of threads is bounded by the number of threads of the thread pool.
+          )pbdoc", py::arg("num_threads"))
+    .def("numThreads", &Session::numThreads,
+      "Number of threads used by the session")
+    .def("partition", &session_partition<StaticGraphTypeTraits>,
+      "Partitions the graph with the parameters given in the corresponding context",
+      py::call_guard<py::gil_scoped_release>(), py::arg("graph"), py::arg("context"))
+    .def("partition", &session_partition<StaticHypergraphTypeTraits>,
+      "Partitions the hypergraph with the parameters given in the corresponding context",
+      py::call_guard<py::gil_scoped_release>(), py::arg("hypergraph"), py::arg("context"))
+    .def("partitionIntoLargeK", &session_partition<LargeKHypergraphTypeTraits>,
+      "Partitions the hypergraph into a large number of blocks with the parameters given in the corresponding context",
+      py::call_guard<py::gil_scoped_release>(), py::arg("hypergraph"), py::arg("context"))
+    .def("mapOntoGraph", &session_map<StaticGraphTypeTraits>,
+      "Maps the graph onto a target graph with the configuration specified in the partitioning context",
+      py::call_guard<py::gil_scoped_release>(), py::arg("graph"), py::arg("target_graph"), py::arg("context"))
+    .def("mapOntoGraph", &session_map<StaticHypergraphTypeTraits>,
+      "Maps the hypergraph onto a target graph with the configuration specified in the partitioning context",
+      py::call_guard<py::gil_scoped_release>(), py::arg("hypergraph"), py::arg("target_graph"), py::arg("context"))
+    .def("improvePartition", &session_improve<StaticGraphTypeTraits>,
+      "Improves the partition using the iterated multilevel cycle technique (V-cycles)",
+      py::call_guard<py::gil_scoped_release>(), py::arg("partitioned_graph"), py::arg("context"), py::arg("num_vcycles"))
+    .def("improvePartition", &session_improve<StaticHypergraphTypeTraits>,
+      "Improves the partition using the iterated multilevel cycle technique (V-cycles)",
+      py::call_guard<py::gil_scoped_release>(), py::arg("partitioned_hypergraph"), py::arg("context"), py::arg("num_vcycles"))
+    .def("improvePartition", &session_improve<LargeKHypergraphTypeTraits>,
+      "Improves the partition using the iterated multilevel cycle technique (V-cycles)",
+      py::call_guard<py::gil_scoped_release>(), py::arg("partitioned_hypergraph"), py::arg("context"), py::arg("num_vcycles"))
+    .def("improveMapping", &session_improve_mapping<StaticGraphTypeTraits>,
+      "Improves a mapping onto a target graph using the iterated multilevel cycle technique (V-cycles)",
+      py::call_guard<py::gil_scoped_release>(), py::arg("partitioned_graph"), py::arg("target_graph"),
+      py::arg("context"), py::arg("num_vcycles"))
+    .def("improveMapping", &session_improve_mapping<StaticHypergraphTypeTraits>,
+      "Improves a mapping onto a target graph using the iterated multilevel cycle technique (V-cycles)",
+      py::call_guard<py::gil_scoped_release>(), py::arg("partitioned_hypergraph"), py::arg("target_graph"),
       py::arg("context"), py::arg("num_vcycles"));
 
 
@@ -28,7 +28,9 @@ import unittest
 import os
 import multiprocessing
 import math
+import threading
 
+import numpy as np
 import mtkahypar
 
 mydir = os.path.dirname(os.path.realpath(__file__))
@@ -228,6 +230,68 @@ class MainTest(unittest.TestCase):
     self.assertEqual(hypergraph.numEdges(), 98274)
     self.assertEqual(hypergraph.totalWeight(), 32768)
 
+  def test_construct_graph_from_numpy_array(self):
+    graph = mtkahypar.Graph(5, 6, np.array([[0,1],[0,2],[1,2],[1,3],[2,3],[3,4]], dtype=np.int64))
+
+    self.assertEqual(graph.numNodes(), 5)
+    self.assertEqual(graph.numEdges(), 6)
+    self.assertEqual(graph.nodeDegree(1), 3)
+    self.assertEqual(graph.nodeDegree(4), 1)
+
+  def test_construct_weighted_graph_from_numpy_arrays(self):
+    graph = mtkahypar.Graph(5, 6, np.array([[0,1],[0,2],[1,2],[1,3],[2,3],[3,4]], dtype=np.uint32),
+      np.array([1,2,3,4,5]), np.array([1,2,3,4,5,6]))
+
+    self.assertEqual(graph.totalWeight(), 15)
+    self.assertEqual(graph.nodeWeight(3), 4)
+    self.assertEqual(graph.edgeWeight(0), 1)
+
+  def test_construct_hypergraph_from_numpy_arrays(self):
+    for dtype in [np.int8, np.int32, np.uint32, np.int64, np.uint64]:
+      hypergraph = mtkahypar.Hypergraph(7, 4, np.array([0,2,6,9,12]),
+        np.array([0,2,0,1,3,4,3,4,6,2,5,6], dtype=dtype))
+
+      self.assertEqual(hypergraph.numNodes(), 7)
+      self.assertEqual(hypergraph.numEdges(), 4)
+      self.assertEqual(hypergraph.numPins(), 12)
+      self.assertEqual(hypergraph.edgeSize(1), 4)
+      self.assertEqual(hypergraph.nodeDegree(6), 2)
+
+  def test_construct_weighted_hypergraph_from_numpy_arrays(self):
+    hypergraph = mtkahypar.Hypergraph(7, 4, np.array([0,2,6,9,12]),
+      np.array([0,2,0,1,3,4,3,4,6,2,5,6]), np.array([1,2,3,4,5,6,7]), np.array([1,2,3,4]))
+
+    self.assertEqual(hypergraph.totalWeight(), 28)
+    self.assertEqual(hypergraph.edgeWeight(3), 4)
+
+  def test_construct_hypergraph_from_invalid_numpy_arrays(self):
+    with self.assertRaises(ValueError):
+      mtkahypar.Hypergraph(7, 4, np.array([0,2,6,9]), np.array([0,2,0,1,3,4,3,4,6,2,5,6]))
+    with self.assertRaises(TypeError):
+      mtkahypar.Hypergraph(7, 4, np.array([0,2,6,9,12]), np.zeros(12, dtype=np.float64))
+    with self.assertRaises(ValueError):
+      mtkahypar.Hypergraph(7, 4, np.array([0,6,2,9,12]), np.array([0,2,0,1,3,4,3,4,6,2,5,6]))
+    with self.assertRaises(ValueError):
+      mtkahypar.Hypergraph(7, 4, np.array([0,2,6,9,12]), np.array([0,2,0,1,3,4,3,4,7,2,5,6]))
+    for dtype in [np.int8, np.int32, np.int64]:
+      with self.assertRaises(ValueError):
+        mtkahypar.Hypergraph(7, 4, np.array([0,2,6,9,12]),
+          np.array([0,2,0,1,3,-1,3,4,6,2,5,6], dtype=dtype))
+
+  def test_construct_graph_from_invalid_numpy_array(self):
+    with self.assertRaises(ValueError):
+      mtkahypar.Graph(5, 6, np.array([[0,1],[0,2],[1,2],[1,3],[2,3],[3,5]], dtype=np.int64))
+    with self.assertRaises(ValueError):
+      mtkahypar.Graph(5, 6, np.array([[0,1],[0,2],[1,2],[1,-3],[2,3],[3,4]], dtype=np.int32))
+
+  def test_block_ids_as_numpy_array(self):
+    hypergraph = mtkahypar.Hypergraph(7, 4, [[0,2],[0,1,3,4],[3,4,6],[2,5,6]])
+    partitioned_hg = mtkahypar.PartitionedHypergraph(hypergraph, 3, np.array([0,0,0,1,1,1,2]))
+
+    block_ids = partitioned_hg.blockIDs()
+    self.assertTrue(np.array_equal(block_ids, np.array([0,0,0,1,1,1,2])))
+    self.assertFalse(block_ids.flags.writeable)
+
   def test_for_graph_if_all_nodes_in_correct_block(self):
     graph = mtkahypar.Graph(5, 6, [(0,1),(0,2),(1,2),(1,3),(2,3),(3,4)])
     partitioned_graph = mtkahypar.PartitionedGraph(graph, 3, [0,1,1,2,2])
@@ -510,6 +574,45 @@ class MainTest(unittest.TestCase):
     if os.path.isfile(mydir + "/test_partition.part3"):
       os.remove(mydir + "/test_partition.part3")
 
+  def test_partitions_in_a_session(self):
+    session = mtkahypar.Session(2)
+    self.assertLessEqual(session.numThreads(), 2)
+    context = mtkahypar.Context()
+    context.loadPreset(mtkahypar.PresetType.DEFAULT)
+    context.setPartitioningParameters(4, 0.03, mtkahypar.Objective.KM1, 42)
+    context.logging = logging
+    hypergraph = mtkahypar.Hypergraph(
+      mydir + "/test_instances/ibm01.hgr", mtkahypar.FileFormat.HMETIS)
+    partitioned_hg = session.partition(hypergraph, context)
+    self.assertLessEqual(partitioned_hg.imbalance(), 0.03)
+    objective_before = partitioned_hg.km1()
+    session.improvePartition(partitioned_hg, context, 1)
+    self.assertLessEqual(partitioned_hg.km1(), objective_before)
+
+  def test_partitions_concurrently_in_several_sessions(self):
+    context = mtkahypar.Context()
+    context.loadPreset(mtkahypar.PresetType.DEFAULT)
+    context.setPartitioningParameters(4, 0.03, mtkahypar.Objective.CUT, 42)
+    context.logging = logging
+    results = [None] * 4
+
+    def run(i):
+      # Partitioning temporarily modifies the input, so each session gets its own graph
+      graph = mtkahypar.Graph(
+        mydir + "/test_instances/delaunay_n15.graph", mtkahypar.FileFormat.METIS)
+      session = mtkahypar.Session(1)
+      results[i] = session.partition(graph, context)
+
+    threads = [threading.Thread(target=run, args=(i,)) for i in range(len(results))]
+    for thread in threads:
+      thread.start()
+    for thread in threads:
+      thread.join()
+
+    for partitioned_graph in results:
+      self.assertLessEqual(partitioned_graph.imbalance(), 0.03)
+      self.assertGreater(partitioned_graph.cut(), 0)
+
   class GraphPartitioner(unittest.TestCase):
 
     def __init__(self, preset_type, num_blocks, epsilon, objective, force_logging):
@@ -144,6 +144,23 @@ TEST_F(ADynamicHypergraph, VerifiesPinsOfHyperedges) {
     { {0, 2}, {0, 1, 3, 4}, {3, 4, 6}, {2, 5, 6} });
 }
 
+TEST_F(ADynamicHypergraph, ConstructsFromAdjacencyArray) {
+  const std::vector<size_t> hyperedge_indices = { 0, 2, 6, 9, 12 };
+  const std::vector<unsigned long> hyperedges = { 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 };
+  const std::vector<HyperedgeWeight> hyperedge_weights = { 1, 2, 3, 4 };
+  auto hg = DynamicHypergraphFactory::construct(7, 4,
+    hyperedge_indices.data(), hyperedges.data(), hyperedge_weights.data());
+  ASSERT_EQ(7, hg.initialNumNodes());
+  ASSERT_EQ(4, hg.initialNumEdges());
+  ASSERT_EQ(12, hg.initialNumPins());
+  ASSERT_EQ(4, hg.maxEdgeSize());
+  ASSERT_EQ(3, hg.edgeWeight(2));
+  verifyPins(hg, { 0, 1, 2, 3 },
+    { {0, 2}, {0, 1, 3, 4}, {3, 4, 6}, {2, 5, 6} });
+  verifyIncidentNets(hg, 0, { 0, 1 });
+  verifyIncidentNets(hg, 6, { 2, 3 });
+}
+
 TEST_F(ADynamicHypergraph, VerifiesVertexWeights) {
   for ( const HypernodeID& hn : hypergraph.nodes() ) {
     ASSERT_EQ(1, hypergraph.nodeWeight(hn));
@@ -275,6 +292,21 @@ TEST_F(ADynamicHypergraph, ComparesStatsIfCopiedSequential) {
   ASSERT_EQ(hypergraph.maxEdgeSize(), copy_hg.maxEdgeSize());
 }
 
+TEST_F(ADynamicHypergraph, KeepsNumberOfPinsAndTotalDegreeThatExceedThe32BitRange) {
+  const size_t num_pins = static_cast<size_t>(std::numeric_limits<uint32_t>::max()) + 12;
+  const size_t total_degree = num_pins + 1;
+  hypergraph.setInitialNumPinsAndTotalVertexDegree(num_pins, total_degree);
+  ASSERT_EQ(num_pins, hypergraph.initialNumPins());
+  ASSERT_EQ(total_degree, hypergraph.initialTotalVertexDegree());
+
+  DynamicHypergraph copy_par = hypergraph.copy(parallel_tag_t());
+  ASSERT_EQ(num_pins, copy_par.initialNumPins());
+  ASSERT_EQ(total_degree, copy_par.initialTotalVertexDegree());
+  DynamicHypergraph copy_seq = hypergraph.copy();
+  ASSERT_EQ(num_pins, copy_seq.initialNumPins());
+  ASSERT_EQ(total_degree, copy_seq.initialTotalVertexDegree());
+}
+
 TEST_F(ADynamicHypergraph, ComparesIncidentNetsIfCopiedParallel) {
   DynamicHypergraph copy_hg = hypergraph.copy(parallel_tag_t());
   verifyIncidentNets(copy_hg, 0, { 0, 1 });
@@ -159,6 +159,20 @@ TYPED_TEST(APartitionedHypergraph, HasCorrectPartWeightsIfOnlyOneThreadPerformsM
   ASSERT_EQ(2, this->partitioned_hypergraph.partWeight(2));
 }
 
+TYPED_TEST(APartitionedHypergraph, UsesNonUnitNodeWeightsForBalanceChecks) {
+  this->partitioned_hypergraph.setNodeWeight(0, 3);
+  ASSERT_FALSE(this->partitioned_hypergraph.hasUnitNodeWeights());
+  ASSERT_EQ(3, this->partitioned_hypergraph.nodeWeight(0));
+  ASSERT_EQ(5, this->partitioned_hypergraph.partWeight(0));
+
+  ASSERT_FALSE(this->partitioned_hypergraph.changeNodePart(0, 0, 1, 4, []{}, [](const SyncronizedEdgeUpdate&) { }));
+  ASSERT_EQ(5, this->partitioned_hypergraph.partWeight(0));
+  ASSERT_EQ(2, this->partitioned_hypergraph.partWeight(1));
+  ASSERT_TRUE(this->partitioned_hypergraph.changeNodePart(0, 0, 1, 5, []{}, [](const SyncronizedEdgeUpdate&) { }));
+  ASSERT_EQ(2, this->partitioned_hypergraph.partWeight(0));
+  ASSERT_EQ(5, this->partitioned_hypergraph.partWeight(1));
+}
+
 TYPED_TEST(APartitionedHypergraph, PerformsConcurrentMovesWhereAllSucceed) {
   executeConcurrent([&] {
     ASSERT_TRUE(this->partitioned_hypergraph.changeNodePart(0, 0, 1));
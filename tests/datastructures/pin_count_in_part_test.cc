@@ -31,6 +31,7 @@
 
 #include "gmock/gmock.h"
 #include "tbb/task_group.h"
+#include "tbb/parallel_for.h"
 
 #include "mt-kahypar/datastructures/pin_count_in_part.h"
 #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
@@ -807,6 +808,93 @@ TYPED_TEST(APinCountDataStructure, MakesASnapshot2) {
   EXPECT_EQ(0, snapshot_2.pinCountInPart(7));
 }
 
+TYPED_TEST(APinCountDataStructure, StoresPinCountsOfLargeHyperedges_k8_Max1000) {
+  const HyperedgeID num_hyperedges = 10;
+  const PartitionID k = 8;
+  const HypernodeID max_value = 1000;
+  this->initialize(num_hyperedges, k, max_value);
+
+  this->pin_count.setPinCountInPart(3, 1, 5);
+  this->pin_count.setPinCountInPart(3, 2, 700);
+  this->pin_count.setPinCountInPart(4, 7, 255);
+  this->pin_count.incrementPinCountInPart(4, 7);
+  this->pin_count.decrementPinCountInPart(3, 2);
+  ASSERT_EQ(5, this->pin_count.pinCountInPart(3, 1));
+  ASSERT_EQ(699, this->pin_count.pinCountInPart(3, 2));
+  ASSERT_EQ(256, this->pin_count.pinCountInPart(4, 7));
+  ASSERT_EQ(0, this->pin_count.pinCountInPart(5, 7));
+}
+
+TEST(APinCountInPart, PromotesHyperedgesWithLargePinCounts) {
+  PinCountInPart pin_count(10, 16, 1000);
+  pin_count.setPinCountInPart(2, 0, 3);
+  pin_count.setPinCountInPart(2, 3, 255);
+  ASSERT_FALSE(pin_count.isLarge(2));
+  ASSERT_EQ(256, pin_count.incrementPinCountInPart(2, 3));
+  ASSERT_TRUE(pin_count.isLarge(2));
+  ASSERT_EQ(1, pin_count.numLargeHyperedges());
+  ASSERT_EQ(3, pin_count.pinCountInPart(2, 0));
+  ASSERT_EQ(255, pin_count.decrementPinCountInPart(2, 3));
+  ASSERT_TRUE(pin_count.isLarge(2));
+  ASSERT_FALSE(pin_count.isLarge(1));
+}
+
+TEST(APinCountInPart, DoesNotPromoteHyperedgesIfMaxValueIsSmall) {
+  PinCountInPart pin_count(10, 4, 200);
+  pin_count.setPinCountInPart(2, 3, 200);
+  ASSERT_FALSE(pin_count.isLarge(2));
+  ASSERT_EQ(0, pin_count.numLargeHyperedges());
+}
+
+TEST(APinCountInPart, DoesNotPromoteHyperedgesIfPackedEntriesDoNotSaveMemory) {
+  // Four 10-bit entries fit into a single 64-bit value
+  PinCountInPart pin_count(10, 4, 1000);
+  pin_count.setPinCountInPart(2, 3, 900);
+  ASSERT_EQ(901, pin_count.incrementPinCountInPart(2, 3));
+  ASSERT_FALSE(pin_count.isLarge(2));
+  ASSERT_EQ(0, pin_count.numLargeHyperedges());
+  ASSERT_EQ(10 * UL(1), PinCountInPart::num_elements(10, 4, 1000));
+}
+
+TEST(APinCountInPart, MakesASnapshotOfALargeHyperedge) {
+  PinCountInPart pin_count(10, 16, 1000);
+  pin_count.setPinCountInPart(2, 1, 10);
+  pin_count.setPinCountInPart(2, 2, 900);
+  PinCountSnapshot& snapshot = pin_count.snapshot(2);
+  EXPECT_EQ(0, snapshot.pinCountInPart(0));
+  EXPECT_EQ(10, snapshot.pinCountInPart(1));
+  EXPECT_EQ(900, snapshot.pinCountInPart(2));
+  EXPECT_EQ(0, snapshot.pinCountInPart(3));
+  EXPECT_EQ(901, snapshot.incrementPinCountInPart(2));
+}
+
+TEST(APinCountInPart, ResetsLargeHyperedges) {
+  PinCountInPart pin_count(10, 16, 1000);
+  pin_count.setPinCountInPart(2, 2, 900);
+  pin_count.setPinCountInPart(5, 0, 300);
+  ASSERT_EQ(2, pin_count.numLargeHyperedges());
+  pin_count.reset();
+  ASSERT_EQ(0, pin_count.numLargeHyperedges());
+  ASSERT_FALSE(pin_count.isLarge(2));
+  ASSERT_EQ(0, pin_count.pinCountInPart(2, 2));
+  ASSERT_EQ(0, pin_count.pinCountInPart(5, 0));
+}
+
+TEST(APinCountInPart, PromotesHyperedgesConcurrently) {
+  const HyperedgeID num_hyperedges = 1000;
+  PinCountInPart pin_count(num_hyperedges, 16, 1000);
+  tbb::parallel_for(UL(0), UL(num_hyperedges), [&](const size_t he) {
+    for ( HypernodeID i = 0; i < he % 500; ++i ) {
+      pin_count.incrementPinCountInPart(he, he % 16);
+    }
+  });
+
+  for ( HyperedgeID he = 0; he < num_hyperedges; ++he ) {
+    ASSERT_EQ(he % 500, pin_count.pinCountInPart(he, he % 16));
+    ASSERT_EQ(he % 500 > 255, pin_count.isLarge(he));
+  }
+}
+
 
 #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
 
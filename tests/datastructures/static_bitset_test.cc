@@ -29,6 +29,8 @@
 
 #include "gmock/gmock.h"
 
+#include "tbb/parallel_for.h"
+
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 #include "mt-kahypar/datastructures/static_bitset.h"
 
@@ -142,5 +144,19 @@ TEST(AStaticBitset, PerformsXOROperation2) {
   verify_iterator(res_bitset, { 0, 25, 85 });
 }
 
+TEST(ABitset, SetsEachBitExactlyOnceIfSetConcurrently) {
+  Bitset bits(1000);
+  std::atomic<size_t> num_successful_sets(0);
+  tbb::parallel_for(UL(0), UL(10000), [&](const size_t i) {
+    if ( bits.atomicSet(i % 1000) ) {
+      ++num_successful_sets;
+    }
+  });
+  ASSERT_EQ(1000, num_successful_sets.load());
+  for ( size_t i = 0; i < 1000; ++i ) {
+    ASSERT_TRUE(bits.isSet(i));
+  }
+}
+
 }  // namespace ds
 }  // namespace mt_kahypar
@@ -49,6 +49,16 @@ TEST_F(AStaticGraph, HasCorrectStats) {
   ASSERT_EQ(2,  hypergraph.maxEdgeSize());
 }
 
+TEST_F(AStaticGraph, TracksUnitWeights) {
+  ASSERT_TRUE(hypergraph.hasUnitNodeWeights());
+  ASSERT_TRUE(hypergraph.hasUnitEdgeWeights());
+  hypergraph.setEdgeWeight(0, 3);
+  ASSERT_TRUE(hypergraph.hasUnitNodeWeights());
+  ASSERT_FALSE(hypergraph.hasUnitEdgeWeights());
+  StaticGraph copy_hg = hypergraph.copy();
+  ASSERT_FALSE(copy_hg.hasUnitEdgeWeights());
+}
+
 TEST_F(AStaticGraph, HasCorrectInitialNodeIterator) {
   HypernodeID expected_hn = 0;
   for ( const HypernodeID& hn : hypergraph.nodes() ) {
@@ -109,6 +119,18 @@ TEST_F(AStaticGraph, VerifiesPinsOfHyperedges) {
     { {1, 2}, {1, 4}, {2, 3}, {4, 5}, {4, 6}, {5, 6} });
 }
 
+TEST_F(AStaticGraph, ConstructsFromEdgeArray) {
+  const std::vector<unsigned long> edges = { 1, 2, 2, 3, 1, 4, 4, 5, 4, 6, 5, 6 };
+  StaticGraph graph = StaticGraphFactory::construct_from_graph_edges(
+    7, 6, edges.data(), nullptr, nullptr, true);
+  ASSERT_EQ(7, graph.initialNumNodes());
+  ASSERT_EQ(12, graph.initialNumEdges());
+  verifyPins(graph, { 0, 1, 3, 6, 7, 9 },
+    { {1, 2}, {1, 4}, {2, 3}, {4, 5}, {4, 6}, {5, 6} });
+  verifyIncidentNets(graph, 2, { 2, 3 });
+  verifyIncidentNets(graph, 6, { 10, 11 });
+}
+
 TEST_F(AStaticGraph, VerifiesVertexWeights) {
   for ( const HypernodeID& hn : hypergraph.nodes() ) {
     ASSERT_EQ(1, hypergraph.nodeWeight(hn));
@@ -129,6 +129,73 @@ TEST_F(AStaticHypergraph, VerifiesPinsOfHyperedges) {
     { {0, 2}, {0, 1, 3, 4}, {3, 4, 6}, {2, 5, 6} });
 }
 
+TEST_F(AStaticHypergraph, ConstructsFromAdjacencyArray) {
+  const std::vector<size_t> hyperedge_indices = { 0, 2, 6, 9, 12 };
+  const std::vector<unsigned long> hyperedges = { 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 };
+  const std::vector<HyperedgeWeight> hyperedge_weights = { 1, 2, 3, 4 };
+  auto hg = StaticHypergraphFactory::construct(7, 4,
+    hyperedge_indices.data(), hyperedges.data(), hyperedge_weights.data());
+  ASSERT_EQ(7, hg.initialNumNodes());
+  ASSERT_EQ(4, hg.initialNumEdges());
+  ASSERT_EQ(12, hg.initialNumPins());
+  ASSERT_EQ(4, hg.maxEdgeSize());
+  ASSERT_EQ(3, hg.edgeWeight(2));
+  verifyPins(hg, { 0, 1, 2, 3 },
+    { {0, 2}, {0, 1, 3, 4}, {3, 4, 6}, {2, 5, 6} });
+  verifyIncidentNets(hg, 0, { 0, 1 });
+  verifyIncidentNets(hg, 6, { 2, 3 });
+}
+
+TEST_F(AStaticHypergraph, HasUnitWeightsIfConstructedWithoutWeights) {
+  ASSERT_TRUE(hypergraph.hasUnitNodeWeights());
+  ASSERT_TRUE(hypergraph.hasUnitEdgeWeights());
+  StaticHypergraph copy_hg = hypergraph.copy(parallel_tag_t());
+  ASSERT_TRUE(copy_hg.hasUnitNodeWeights());
+  ASSERT_TRUE(copy_hg.hasUnitEdgeWeights());
+}
+
+TEST_F(AStaticHypergraph, HasNoUnitEdgeWeightsIfConstructedWithEdgeWeights) {
+  const std::vector<size_t> hyperedge_indices = { 0, 2, 6, 9, 12 };
+  const std::vector<unsigned long> hyperedges = { 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 };
+  const std::vector<HyperedgeWeight> hyperedge_weights = { 1, 2, 3, 4 };
+  auto hg = StaticHypergraphFactory::construct(7, 4,
+    hyperedge_indices.data(), hyperedges.data(), hyperedge_weights.data());
+  ASSERT_TRUE(hg.hasUnitNodeWeights());
+  ASSERT_FALSE(hg.hasUnitEdgeWeights());
+}
+
+TEST_F(AStaticHypergraph, LosesUnitWeightsIfWeightsAreModified) {
+  hypergraph.setNodeWeight(0, 1);
+  hypergraph.setEdgeWeight(0, 1);
+  ASSERT_TRUE(hypergraph.hasUnitNodeWeights());
+  ASSERT_TRUE(hypergraph.hasUnitEdgeWeights());
+  hypergraph.setNodeWeight(0, 2);
+  hypergraph.setEdgeWeight(0, 2);
+  ASSERT_FALSE(hypergraph.hasUnitNodeWeights());
+  ASSERT_FALSE(hypergraph.hasUnitEdgeWeights());
+}
+
+TEST_F(AStaticHypergraph, LosesUnitWeightsIfWeightsAreModifiedInParallel) {
+  tbb::parallel_for(ID(0), hypergraph.initialNumNodes(), [&](const HypernodeID hn) {
+    hypergraph.setNodeWeight(hn, hn % 2 == 0 ? 2 : 1);
+  });
+  tbb::parallel_for(ID(0), hypergraph.initialNumEdges(), [&](const HyperedgeID he) {
+    hypergraph.setEdgeWeight(he, he % 2 == 0 ? 2 : 1);
+  });
+  ASSERT_FALSE(hypergraph.hasUnitNodeWeights());
+  ASSERT_FALSE(hypergraph.hasUnitEdgeWeights());
+  StaticHypergraph moved_hg(std::move(hypergraph));
+  ASSERT_FALSE(moved_hg.hasUnitNodeWeights());
+  ASSERT_FALSE(moved_hg.hasUnitEdgeWeights());
+}
+
+TEST_F(AStaticHypergraph, HasNoUnitWeightsAfterContraction) {
+  parallel::scalable_vector<HypernodeID> c_mapping = {0, 0, 1, 2, 2, 3, 3};
+  StaticHypergraph c_hypergraph = hypergraph.contract(c_mapping);
+  ASSERT_FALSE(c_hypergraph.hasUnitNodeWeights());
+  ASSERT_FALSE(c_hypergraph.hasUnitEdgeWeights());
+}
+
 TEST_F(AStaticHypergraph, VerifiesVertexWeights) {
   for ( const HypernodeID& hn : hypergraph.nodes() ) {
     ASSERT_EQ(1, hypergraph.nodeWeight(hn));
@@ -27,7 +27,9 @@
 
 #include "gmock/gmock.h"
 
+#include <cmath>
 #include <thread>
+#include <vector>
 
 #include "tbb/parallel_invoke.h"
 
@@ -665,6 +667,100 @@ namespace mt_kahypar {
     });
   }
 
+  TEST_F(APartitioner, PartitionsConcurrentlyInSeveralSessions) {
+    mt_kahypar_load_preset(context, DEFAULT);
+    mt_kahypar_set_partitioning_parameters(context, 4, 0.03, KM1, 0);
+    mt_kahypar_set_context_parameter(context, VERBOSE, "0");
+    hypergraph = mt_kahypar_read_hypergraph_from_file(HYPERGRAPH_FILE, DEFAULT, HMETIS);
+
+    // Partitioning temporarily modifies the input, so each session gets its own hypergraph
+    const size_t num_sessions = 3;
+    std::vector<mt_kahypar_partitioned_hypergraph_t> partitions(num_sessions);
+    std::vector<std::thread> threads;
+    for ( size_t i = 0; i < num_sessions; ++i ) {
+      threads.emplace_back([&, i] {
+        mt_kahypar_session_t* session = mt_kahypar_session_new(2);
+        mt_kahypar_hypergraph_t hg = mt_kahypar_read_hypergraph_from_file(HYPERGRAPH_FILE, DEFAULT, HMETIS);
+        partitions[i] = mt_kahypar_session_partition(session, hg, context);
+        mt_kahypar_free_hypergraph(hg);
+        mt_kahypar_free_session(session);
+      });
+    }
+    for ( std::thread& thread : threads ) {
+      thread.join();
+    }
+
+    const mt_kahypar_hypernode_weight_t max_block_weight =
+      std::floor(1.03 * std::ceil(mt_kahypar_hypergraph_weight(hypergraph) / 4.0));
+    for ( mt_kahypar_partitioned_hypergraph_t& phg : partitions ) {
+      ASSERT_EQ(MULTILEVEL_HYPERGRAPH_PARTITIONING, phg.type);
+      std::vector<mt_kahypar_hypernode_weight_t> block_weights(4);
+      mt_kahypar_get_block_weights(phg, block_weights.data());
+      for ( const mt_kahypar_hypernode_weight_t weight : block_weights ) {
+        ASSERT_LE(weight, max_block_weight);
+      }
+      ASSERT_GT(mt_kahypar_km1(phg), 0);
+      mt_kahypar_free_partitioned_hypergraph(phg);
+    }
+  }
+
+  TEST_F(APartitioner, ImprovesPartitionWithinASession) {
+    Partition(HYPERGRAPH_FILE, HMETIS, DEFAULT, 4, 0.03, KM1, false);
+    mt_kahypar_session_t* session = mt_kahypar_session_new(1);
+    ASSERT_EQ(1, mt_kahypar_session_num_threads(session));
+
+    mt_kahypar_hyperedge_weight_t before = mt_kahypar_km1(partitioned_hg);
+    mt_kahypar_session_improve_partition(session, partitioned_hg, context, 1);
+    mt_kahypar_hyperedge_weight_t after = mt_kahypar_km1(partitioned_hg);
+    ASSERT_LE(after, before);
+    mt_kahypar_free_session(session);
+  }
+
+  TEST_F(APartitioner, PartitionsABatchOfHypergraphsAndGraphs) {
+    mt_kahypar_load_preset(context, DEFAULT);
+    mt_kahypar_set_partitioning_parameters(context, 4, 0.03, KM1, 0);
+    mt_kahypar_set_context_parameter(context, VERBOSE, "0");
+
+    std::vector<mt_kahypar_hypergraph_t> batch;
+    for ( size_t i = 0; i < 3; ++i ) {
+      batch.push_back(mt_kahypar_read_hypergraph_from_file(HYPERGRAPH_FILE, DEFAULT, HMETIS));
+      batch.push_back(mt_kahypar_read_hypergraph_from_file(GRAPH_FILE, DEFAULT, METIS));
+    }
+    std::vector<mt_kahypar_partitioned_hypergraph_t> partitions(batch.size());
+    mt_kahypar_partition_batch(batch.data(), batch.size(), context, partitions.data());
+
+    for ( size_t i = 0; i < batch.size(); ++i ) {
+      ASSERT_EQ(i % 2 == 0 ? MULTILEVEL_HYPERGRAPH_PARTITIONING : MULTILEVEL_GRAPH_PARTITIONING,
+        partitions[i].type);
+      const mt_kahypar_hypernode_weight_t max_block_weight =
+        std::floor(1.03 * std::ceil(mt_kahypar_hypergraph_weight(batch[i]) / 4.0));
+      std::vector<mt_kahypar_hypernode_weight_t> block_weights(4);
+      mt_kahypar_get_block_weights(partitions[i], block_weights.data());
+      for ( const mt_kahypar_hypernode_weight_t weight : block_weights ) {
+        ASSERT_LE(weight, max_block_weight);
+      }
+      mt_kahypar_free_partitioned_hypergraph(partitions[i]);
+      mt_kahypar_free_hypergraph(batch[i]);
+    }
+  }
+
+  TEST_F(APartitioner, DoesNotPartitionABatchWithAnIncompatibleHypergraph) {
+    mt_kahypar_load_preset(context, DEFAULT);
+    mt_kahypar_set_partitioning_parameters(context, 4, 0.03, KM1, 0);
+    mt_kahypar_set_context_parameter(context, VERBOSE, "0");
+
+    std::vector<mt_kahypar_hypergraph_t> batch;
+    batch.push_back(mt_kahypar_read_hypergraph_from_file(HYPERGRAPH_FILE, DEFAULT, HMETIS));
+    batch.push_back(mt_kahypar_read_hypergraph_from_file(HYPERGRAPH_FILE, HIGHEST_QUALITY, HMETIS));
+    std::vector<mt_kahypar_partitioned_hypergraph_t> partitions(batch.size());
+    mt_kahypar_partition_batch(batch.data(), batch.size(), context, partitions.data());
+
+    for ( size_t i = 0; i < batch.size(); ++i ) {
+      ASSERT_EQ(NULLPTR_PARTITION, partitions[i].type);
+      mt_kahypar_free_hypergraph(batch[i]);
+    }
+  }
+
   TEST_F(APartitioner, ChecksIfDeterministicPresetProducesSameResultsForHypergraphs) {
     Partition(HYPERGRAPH_FILE, HMETIS, DETERMINISTIC, 8, 0.03, KM1, false);
     const double objective_1 = mt_kahypar_km1(partitioned_hg);
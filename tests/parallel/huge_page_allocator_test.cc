@@ -0,0 +1,160 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include <cstring>
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/parallel/huge_page_allocator.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+namespace parallel {
+
+static constexpr size_t MB = UL(1) << 20;
+
+class AHugePageAllocator : public Test {
+ public:
+  AHugePageAllocator() :
+    allocator(HugePageAllocator::instance()) { }
+
+  ~AHugePageAllocator() {
+    allocator.configure(HugePageAllocator::Mode::disabled);
+    allocator.release_cached_memory();
+  }
+
+  HugePageAllocator& allocator;
+};
+
+TEST_F(AHugePageAllocator, UsesScalableAllocatorIfDisabled) {
+  allocator.configure(HugePageAllocator::Mode::disabled);
+  const size_t num_allocations_before = allocator.num_huge_page_allocations();
+  char* data = static_cast<char*>(allocator.allocate(4 * MB));
+  std::memset(data, 1, 4 * MB);
+  allocator.free(data);
+  ASSERT_EQ(num_allocations_before, allocator.num_huge_page_allocations());
+}
+
+TEST_F(AHugePageAllocator, UsesScalableAllocatorForSmallAllocations) {
+  allocator.configure(HugePageAllocator::Mode::transparent);
+  const size_t num_allocations_before = allocator.num_huge_page_allocations();
+  char* data = static_cast<char*>(allocator.allocate(1024));
+  std::memset(data, 1, 1024);
+  allocator.free(data);
+  ASSERT_EQ(num_allocations_before, allocator.num_huge_page_allocations());
+}
+
+TEST_F(AHugePageAllocator, AlignsTransparentHugePageAllocations) {
+  allocator.configure(HugePageAllocator::Mode::transparent);
+  const size_t num_allocations_before = allocator.num_huge_page_allocations();
+  char* data = static_cast<char*>(allocator.allocate(5 * MB, true));
+  ASSERT_EQ(num_allocations_before + 1, allocator.num_huge_page_allocations());
+  ASSERT_EQ(0, reinterpret_cast<size_t>(data) % ( 2 * MB ));
+  for ( size_t i = 0; i < 5 * MB; i += 4096 ) {
+    ASSERT_EQ(0, data[i]);
+  }
+  allocator.free(data);
+}
+
+TEST_F(AHugePageAllocator, ReusesFreedAllocations) {
+  allocator.configure(HugePageAllocator::Mode::transparent);
+  char* data = static_cast<char*>(allocator.allocate(8 * MB));
+  std::memset(data, 1, 8 * MB);
+  allocator.free(data);
+
+  const size_t num_reused_before = allocator.num_reused_allocations();
+  char* reused_data = static_cast<char*>(allocator.allocate(6 * MB, true));
+  ASSERT_EQ(data, reused_data);
+  ASSERT_EQ(num_reused_before + 1, allocator.num_reused_allocations());
+  for ( size_t i = 0; i < 6 * MB; i += 4096 ) {
+    ASSERT_EQ(0, reused_data[i]);
+  }
+  allocator.free(reused_data);
+}
+
+TEST_F(AHugePageAllocator, ReusesAllocationsFreedWithTheirSize) {
+  allocator.configure(HugePageAllocator::Mode::transparent);
+  void* data = allocator.allocate(8 * MB);
+  allocator.free(data, 8 * MB);
+
+  const size_t num_reused_before = allocator.num_reused_allocations();
+  void* reused_data = allocator.allocate(8 * MB);
+  ASSERT_EQ(data, reused_data);
+  ASSERT_EQ(num_reused_before + 1, allocator.num_reused_allocations());
+  allocator.free(reused_data, 8 * MB);
+}
+
+TEST_F(AHugePageAllocator, FreesSmallAllocationsWithTheirSize) {
+  allocator.configure(HugePageAllocator::Mode::transparent);
+  char* data = static_cast<char*>(allocator.allocate(1024, true));
+  ASSERT_EQ(0, data[0]);
+  allocator.free(data, 1024);
+}
+
+TEST_F(AHugePageAllocator, DoesNotReuseAllocationsThatAreTooSmall) {
+  allocator.configure(HugePageAllocator::Mode::transparent);
+  void* data = allocator.allocate(4 * MB);
+  allocator.free(data);
+
+  const size_t num_reused_before = allocator.num_reused_allocations();
+  void* other_data = allocator.allocate(16 * MB);
+  ASSERT_EQ(num_reused_before, allocator.num_reused_allocations());
+  allocator.free(other_data);
+}
+
+TEST_F(AHugePageAllocator, DoesNotReuseAllocationsThatAreMuchLarger) {
+  allocator.configure(HugePageAllocator::Mode::transparent);
+  void* data = allocator.allocate(16 * MB);
+  allocator.free(data);
+
+  const size_t num_reused_before = allocator.num_reused_allocations();
+  void* other_data = allocator.allocate(4 * MB);
+  ASSERT_EQ(num_reused_before, allocator.num_reused_allocations());
+  allocator.free(other_data);
+}
+
+TEST_F(AHugePageAllocator, DoesNotCacheAllocationsIfCacheIsFull) {
+  allocator.configure(HugePageAllocator::Mode::transparent, 0);
+  void* data = allocator.allocate(4 * MB);
+  allocator.free(data);
+
+  const size_t num_reused_before = allocator.num_reused_allocations();
+  void* other_data = allocator.allocate(4 * MB);
+  ASSERT_EQ(num_reused_before, allocator.num_reused_allocations());
+  allocator.free(other_data);
+}
+
+TEST_F(AHugePageAllocator, FallsBackIfNoExplicitHugePagesAreReserved) {
+  allocator.configure(HugePageAllocator::Mode::explicit_2mb);
+  char* data = static_cast<char*>(allocator.allocate(4 * MB, true));
+  ASSERT_NE(nullptr, data);
+  std::memset(data, 1, 4 * MB);
+  allocator.free(data);
+}
+
+}  // namespace parallel
+}  // namespace mt_kahypar
@@ -26,7 +26,9 @@
 
 #include "gmock/gmock.h"
 
+#include "mt-kahypar/definitions.h"
 #include <mt-kahypar/parallel/work_stack.h>
+#include <algorithm>
 #include <thread>
 
 using ::testing::Test;
@@ -115,5 +117,109 @@ TEST(WorkContainer, WorkStealingWorks) {
   ASSERT_EQ(steals + own_pops, m);
 }
 
+TEST(WorkContainer, StealsHalfOfTheRemainingElements) {
+  WorkContainer<int> cdc(2);
+  for (int i = 0; i < 100; ++i) {
+    cdc.safe_push(i, 0);
+  }
+
+  int element = -1;
+  ASSERT_TRUE(cdc.try_pop(element, 1));
+  ASSERT_EQ(0, element);
+  // thread 1 buffers the remaining stolen elements locally
+  ASSERT_EQ(50, cdc.tls_queues[0].front.load());
+  ASSERT_EQ(99, cdc.unsafe_size());
+  for (int i = 1; i < 50; ++i) {
+    ASSERT_TRUE(cdc.try_pop(element, 1));
+    ASSERT_EQ(i, element);
+  }
+  ASSERT_TRUE(cdc.try_pop(element, 0));
+  ASSERT_EQ(50, element);
+}
+
+TEST(WorkContainer, SortByKeyGroupsElements) {
+  WorkContainer<int> cdc(1);
+  const std::vector<int> elements = { 5, 2, 8, 1, 4, 7 };
+  for (const int el : elements) {
+    cdc.safe_push(el, 0);
+  }
+  cdc.sort_by_key([&](const int el) { return el % 2; });
+
+  const std::vector<int> expected = { 2, 8, 4, 5, 1, 7 };
+  for (const int el : expected) {
+    int dest = -1;
+    ASSERT_TRUE(cdc.try_pop(dest, 0));
+    ASSERT_EQ(el, dest);
+  }
+}
+
+TEST(WorkContainer, ReleasesUnconsumedStolenElements) {
+  WorkContainer<int> cdc(2);
+  for (int i = 0; i < 100; ++i) {
+    cdc.safe_push(i, 0);
+  }
+
+  int element = -1;
+  ASSERT_TRUE(cdc.try_pop(element, 1));
+  ASSERT_EQ(0, element);
+  // thread 1 stops after one element and hands back the rest of its stolen range
+  cdc.release_stolen_elements(1);
+  ASSERT_EQ(99, cdc.unsafe_size());
+
+  std::vector<int> popped;
+  while (cdc.try_pop(element, 0)) {
+    popped.push_back(element);
+  }
+  std::sort(popped.begin(), popped.end());
+  ASSERT_EQ(99, popped.size());
+  for (int i = 1; i < 100; ++i) {
+    ASSERT_EQ(i, popped[i - 1]);
+  }
+  ASSERT_EQ(0, cdc.unsafe_size());
+}
+
+TEST(WorkContainer, PopsEachElementExactlyOnceWithManyThieves) {
+  const size_t num_threads = 16;
+  const int m = 1 << 16;
+  WorkContainer<int> cdc(num_threads);
+  // only a few threads own elements such that most elements are stolen
+  for (int i = 0; i < m; ++i) {
+    cdc.safe_push(i, i % 4);
+  }
+
+  std::vector<CAtomic<int>> num_pops(m);
+  for (CAtomic<int>& counter : num_pops) {
+    counter.store(0);
+  }
+  std::vector<std::thread> threads;
+  for (size_t thread_id = 0; thread_id < num_threads; ++thread_id) {
+    threads.emplace_back([&, thread_id] {
+      int element = 0;
+      // every other thread stops early and releases its stolen elements
+      size_t num_local_pops = 0;
+      while (cdc.try_pop(element, thread_id)) {
+        num_pops[element].fetch_add(1, std::memory_order_relaxed);
+        if (thread_id % 2 == 1 && ++num_local_pops == 100) {
+          break;
+        }
+      }
+      cdc.release_stolen_elements(thread_id);
+    });
+  }
+  for (std::thread& t : threads) {
+    t.join();
+  }
+
+  // drain elements released after the other threads terminated
+  int element = 0;
+  while (cdc.try_pop(element, 0)) {
+    num_pops[element].fetch_add(1, std::memory_order_relaxed);
+  }
+  for (int i = 0; i < m; ++i) {
+    ASSERT_EQ(1, num_pops[i].load()) << V(i);
+  }
+  ASSERT_EQ(0, cdc.unsafe_size());
+}
+
 }  // namespace parallel
 }  // namespace mt_kahypar
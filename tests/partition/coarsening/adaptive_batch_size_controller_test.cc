@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/partition/coarsening/adaptive_batch_size_controller.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+class AAdaptiveBatchSizeController : public Test {
+ public:
+  AAdaptiveBatchSizeController() :
+    context(),
+    metrics({ 1000, 0.0 }) {
+    context.shared_memory.num_threads = 4;
+    context.refinement.max_batch_size = 100;
+    context.refinement.min_border_vertices_per_thread = 0;
+    context.refinement.adaptive_batch_size.enabled = true;
+    context.refinement.adaptive_batch_size.scaling_factor = 2.0;
+    context.refinement.adaptive_batch_size.max_multiplier = 4;
+  }
+
+  // ! Simulates a localized search that improves the objective function by gain
+  void refine(AdaptiveBatchSizeController& controller, const HyperedgeWeight gain) {
+    controller.execute(controller.minNumBorderVertices(), metrics, [&] {
+      metrics.quality -= gain;
+    });
+  }
+
+  Context context;
+  Metrics metrics;
+};
+
+TEST_F(AAdaptiveBatchSizeController, InitializesThresholdWithMaxBatchSize) {
+  AdaptiveBatchSizeController controller(context);
+  ASSERT_EQ(UL(100), controller.minNumBorderVertices());
+}
+
+TEST_F(AAdaptiveBatchSizeController, InitializesThresholdWithMinBorderVerticesPerThread) {
+  context.refinement.min_border_vertices_per_thread = 50;
+  AdaptiveBatchSizeController controller(context);
+  ASSERT_EQ(UL(200), controller.minNumBorderVertices());
+}
+
+TEST_F(AAdaptiveBatchSizeController, KeepsThresholdIfDisabled) {
+  context.refinement.adaptive_batch_size.enabled = false;
+  AdaptiveBatchSizeController controller(context);
+  refine(controller, 0);
+  refine(controller, 0);
+  ASSERT_EQ(UL(100), controller.minNumBorderVertices());
+}
+
+TEST_F(AAdaptiveBatchSizeController, IncreasesThresholdIfRefinementFindsNoImprovement) {
+  AdaptiveBatchSizeController controller(context);
+  refine(controller, 0);
+  ASSERT_EQ(UL(200), controller.minNumBorderVertices());
+  refine(controller, 0);
+  ASSERT_EQ(UL(400), controller.minNumBorderVertices());
+}
+
+TEST_F(AAdaptiveBatchSizeController, DoesNotIncreaseThresholdAboveMaxMultiplier) {
+  AdaptiveBatchSizeController controller(context);
+  for ( size_t i = 0; i < 5; ++i ) {
+    refine(controller, 0);
+  }
+  ASSERT_EQ(UL(400), controller.minNumBorderVertices());
+}
+
+TEST_F(AAdaptiveBatchSizeController, DecreasesThresholdIfRefinementFindsImprovement) {
+  AdaptiveBatchSizeController controller(context);
+  refine(controller, 0);
+  refine(controller, 0);
+  ASSERT_EQ(UL(400), controller.minNumBorderVertices());
+  refine(controller, 10);
+  ASSERT_EQ(UL(200), controller.minNumBorderVertices());
+  ASSERT_EQ(990, metrics.quality);
+}
+
+TEST_F(AAdaptiveBatchSizeController, DecreasesThresholdBelowInitialValue) {
+  AdaptiveBatchSizeController controller(context);
+  refine(controller, 10);
+  ASSERT_EQ(UL(50), controller.minNumBorderVertices());
+  refine(controller, 1000);
+  ASSERT_EQ(UL(25), controller.minNumBorderVertices());
+}
+
+TEST_F(AAdaptiveBatchSizeController, DoesNotDecreaseThresholdBelowMaxMultiplier) {
+  AdaptiveBatchSizeController controller(context);
+  for ( HyperedgeWeight gain = 10; gain <= 100000; gain *= 10 ) {
+    refine(controller, gain);
+  }
+  ASSERT_EQ(UL(25), controller.minNumBorderVertices());
+}
+
+TEST_F(AAdaptiveBatchSizeController, DoesNotDecreaseThresholdBelowNumberOfThreads) {
+  context.refinement.max_batch_size = 8;
+  AdaptiveBatchSizeController controller(context);
+  for ( HyperedgeWeight gain = 10; gain <= 100000; gain *= 10 ) {
+    refine(controller, gain);
+  }
+  ASSERT_EQ(UL(4), controller.minNumBorderVertices());
+}
+
+}  // namespace mt_kahypar
@@ -100,7 +100,10 @@ class ACoarsener : public Test {
     context.shared_memory.original_num_threads = std::thread::hardware_concurrency();
     context.shared_memory.num_threads = std::thread::hardware_concurrency();
     context.setupPartWeights(hypergraph.totalWeight());
+    initializeCoarsener();
+  }
 
+  void initializeCoarsener() {
     uncoarseningData = std::make_unique<UncoarseningData<TypeTraits>>(
       PRESET != PresetType::default_preset, hypergraph, context);
 
@@ -110,6 +113,16 @@ class ACoarsener : public Test {
     uncoarsener = std::make_unique<Uncoarsener>(hypergraph, context, *uncoarseningData, nullptr);
   }
 
+  // ! Replaces the hypergraph with a copy of the given hypergraph and
+  // ! creates a new coarsener and uncoarsener for it
+  void resetHypergraph(const Hypergraph& input) {
+    uncoarsener.reset();
+    coarsener.reset();
+    uncoarseningData.reset();
+    hypergraph = input.copy();
+    initializeCoarsener();
+  }
+
   void assignPartitionIDs(PartitionedHypergraph& phg) {
     for (const HypernodeID& hn : phg.nodes()) {
       PartitionID part_id = 0;
@@ -161,6 +174,43 @@ class ACoarsener : public Test {
     ASSERT_THAT(currentNumEdges(coarsener->coarsestHypergraph()), Eq(num_hyperedges));
   }
 
+  // ! Checks that uncontracting the batch uncontraction hierarchy of the coarsened
+  // ! hypergraph restores each contracted vertex exactly once and only after its
+  // ! representative, and returns the number of contractions
+  HypernodeID verifyContractionForest() {
+    vec<bool> is_enabled(hypergraph.initialNumNodes(), false);
+    HypernodeID num_enabled = 0;
+    for ( const HypernodeID& hn : hypergraph.nodes() ) {
+      is_enabled[hn] = true;
+      ++num_enabled;
+    }
+
+    HypernodeID num_contractions = 0;
+    auto versioned_batches = hypergraph.createBatchUncontractionHierarchy(context.refinement.max_batch_size);
+    while ( !versioned_batches.empty() ) {
+      BatchVector& batches = versioned_batches.back();
+      while ( !batches.empty() ) {
+        const Batch& batch = batches.back();
+        for ( const Memento& memento : batch ) {
+          EXPECT_TRUE(is_enabled[memento.u]);
+          EXPECT_FALSE(is_enabled[memento.v]);
+        }
+        for ( const Memento& memento : batch ) {
+          is_enabled[memento.v] = true;
+          ++num_contractions;
+        }
+        batches.pop_back();
+      }
+      versioned_batches.pop_back();
+    }
+
+    for ( const HypernodeID& hn : hypergraph.nodes() ) {
+      EXPECT_TRUE(is_enabled[hn]);
+    }
+    EXPECT_EQ(hypergraph.initialNumNodes(), num_enabled + num_contractions);
+    return num_contractions;
+  }
+
   Hypergraph hypergraph;
   Context context;
   std::unique_ptr<UncoarseningData<TypeTraits>> uncoarseningData;
@@ -146,6 +146,51 @@ TEST_F(ANLevelCoarsener, ProjectsPartitionBackToOriginalHypergraph) {
     ASSERT_EQ(part_id, partitioned_hypergraph.partID(hn));
   }
 }
+
+TEST_F(ANLevelCoarsener, ContractsInRoundsDownToContractionLimit) {
+  context.coarsening.contraction_limit = 4;
+  context.coarsening.nlevel_round_size = 3;
+  doCoarsening();
+  const HypernodeID num_nodes = currentNumNodes(coarsener->coarsestHypergraph());
+  ASSERT_GE(num_nodes, 4);
+  ASSERT_LT(num_nodes, 16);
+}
+
+TEST_F(ANLevelCoarsener, ReachesTheContractionLimitInRoundsAndWithTheInterleavedScheme) {
+  using Hypergraph = typename DynamicHypergraphTypeTraits::Hypergraph;
+  const Hypergraph input = hypergraph.copy();
+  context.coarsening.contraction_limit = 4;
+  // A round size of zero selects the interleaved scheme
+  for ( const size_t round_size : { 0, 1, 3, 16 } ) {
+    resetHypergraph(input);
+    context.coarsening.nlevel_round_size = round_size;
+    doCoarsening();
+    const HypernodeID num_nodes = currentNumNodes(coarsener->coarsestHypergraph());
+    ASSERT_EQ(context.coarsening.contraction_limit, num_nodes) << V(round_size);
+    ASSERT_TRUE(hypergraph.verifyIncidenceArrayAndIncidentNets()) << V(round_size);
+    ASSERT_EQ(16 - num_nodes, verifyContractionForest()) << V(round_size);
+  }
+}
+
+TEST_F(ANLevelCoarsener, ProjectsPartitionBackToOriginalHypergraphIfContractedInRounds) {
+  using PartitionedHypergraph = typename DynamicHypergraphTypeTraits::PartitionedHypergraph;
+  context.coarsening.contraction_limit = 4;
+  context.coarsening.nlevel_round_size = 3;
+  context.refinement.label_propagation.algorithm = LabelPropagationAlgorithm::do_nothing;
+  context.refinement.fm.algorithm = FMAlgorithm::do_nothing;
+  context.refinement.flows.algorithm = FlowAlgorithm::do_nothing;
+  context.type = ContextType::initial_partitioning;
+  doCoarsening();
+  PartitionedHypergraph& coarsest_partitioned_hypergraph =
+    utils::cast<PartitionedHypergraph>(coarsener->coarsestPartitionedHypergraph());
+  assignPartitionIDs(coarsest_partitioned_hypergraph);
+  PartitionedHypergraph partitioned_hypergraph = uncoarsener->uncoarsen();
+  ASSERT_EQ(16, partitioned_hypergraph.initialNumNodes());
+  for ( const HypernodeID& hn : partitioned_hypergraph.nodes() ) {
+    PartitionID part_id = 0;
+    ASSERT_EQ(part_id, partitioned_hypergraph.partID(hn));
+  }
+}
 #endif
 
 }  // namespace mt_kahypar
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/coarsening/policies/rating_score_policy.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+#ifdef KAHYPAR_ENABLE_EXPERIMENTAL_FEATURES
+using Hypergraph = ds::StaticHypergraph;
+using HypergraphFactory = typename Hypergraph::Factory;
+
+class AAlgebraicDistanceScore : public Test {
+ public:
+  AAlgebraicDistanceScore() :
+    // Two dense clusters {0,1,2,3,4} and {5,6,7,8,9} connected by hyperedge 10.
+    // All hyperedges have the same size, so only the algebraic distance differs.
+    hypergraph(HypergraphFactory::construct(10, 11,
+      { { 0, 1, 2 }, { 1, 2, 3 }, { 2, 3, 4 }, { 0, 3, 4 }, { 0, 1, 4 },
+        { 5, 6, 7 }, { 6, 7, 8 }, { 7, 8, 9 }, { 5, 8, 9 }, { 5, 6, 9 },
+        { 3, 4, 5 } })),
+    context(),
+    score() {
+    context.partition.seed = 42;
+    context.partition.ignore_hyperedge_size_threshold = 1000;
+    context.coarsening.rating.algebraic_distance_num_vectors = 5;
+    context.coarsening.rating.algebraic_distance_num_iterations = 20;
+    context.coarsening.rating.algebraic_distance_omega = 0.5;
+  }
+
+  Hypergraph hypergraph;
+  Context context;
+  AlgebraicDistanceScore score;
+};
+
+TEST_F(AAlgebraicDistanceScore, PrefersHyperedgesWithinDenseClusters) {
+  score.initialize(hypergraph, context);
+  const RatingType bridge_score = score.score(10, 1, hypergraph.edgeSize(10));
+  // Hyperedges that do not contain one of the vertices incident to the bridge
+  for ( const HyperedgeID he : { 0, 6, 7 } ) {
+    ASSERT_GT(score.score(he, 1, hypergraph.edgeSize(he)), bridge_score);
+  }
+}
+
+TEST_F(AAlgebraicDistanceScore, IsBoundedByScaledHeavyEdgeScore) {
+  score.initialize(hypergraph, context);
+  HeavyEdgeScore heavy_edge_score;
+  for ( const HyperedgeID& he : hypergraph.edges() ) {
+    const HyperedgeWeight weight = hypergraph.edgeWeight(he);
+    const HypernodeID size = hypergraph.edgeSize(he);
+    ASSERT_LE(score.score(he, weight, size), 100.0 * heavy_edge_score.score(he, weight, size));
+    ASSERT_GE(score.score(he, weight, size), heavy_edge_score.score(he, weight, size) / 1.01);
+  }
+}
+
+TEST_F(AAlgebraicDistanceScore, IsDeterministic) {
+  score.initialize(hypergraph, context);
+  AlgebraicDistanceScore other_score;
+  other_score.initialize(hypergraph, context);
+  for ( const HyperedgeID& he : hypergraph.edges() ) {
+    const HypernodeID size = hypergraph.edgeSize(he);
+    ASSERT_DOUBLE_EQ(score.score(he, 1, size), other_score.score(he, 1, size));
+  }
+}
+
+#endif
+
+}  // namespace mt_kahypar
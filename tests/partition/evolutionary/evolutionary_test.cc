@@ -0,0 +1,180 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <chrono>
+#include <thread>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/command_line_options.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/evolutionary.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/partitioner.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+  using TypeTraits = StaticHypergraphTypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+  using Individual = evolutionary::Individual;
+  using HypergraphPool = evolutionary::HypergraphPool<Hypergraph>;
+}
+
+class AEvolutionaryAlgorithm : public Test {
+
+ public:
+  AEvolutionaryAlgorithm() :
+    hypergraph(),
+    context() {
+    parseIniToContext(context, "../config/default_preset.ini");
+    context.partition.graph_filename = "../tests/instances/contracted_unweighted_ibm01.hgr";
+    context.partition.mode = Mode::direct;
+    context.partition.preset_type = PresetType::default_preset;
+    context.partition.instance_type = InstanceType::hypergraph;
+    context.partition.partition_type = PartitionedHypergraph::TYPE;
+    context.partition.objective = Objective::km1;
+    context.partition.gain_policy = GainPolicy::km1;
+    context.partition.epsilon = 0.03;
+    context.partition.k = 4;
+    context.partition.verbose_output = false;
+    context.shared_memory.num_threads = std::thread::hardware_concurrency();
+
+    hypergraph = io::readInputFile<Hypergraph>(
+      context.partition.graph_filename, FileFormat::hMetis, true);
+  }
+
+  // ! Partitions the hypergraph once, which also sets up the context
+  Individual partitionFirstIndividual() {
+    PartitionedHypergraph phg = Partitioner<TypeTraits>::partition(hypergraph, context);
+    Individual individual;
+    individual.partition.assign(hypergraph.initialNumNodes(), kInvalidPartition);
+    for ( const HypernodeID& hn : hypergraph.nodes() ) {
+      individual.partition[hn] = phg.partID(hn);
+    }
+    individual.objective = metrics::quality(phg, context);
+    individual.imbalance = metrics::imbalance(phg, context);
+    individual.is_balanced = metrics::isBalanced(phg, context);
+    hypergraph.reset();
+    return individual;
+  }
+
+  void verifyIndividual(const Individual& individual) {
+    ASSERT_EQ(hypergraph.initialNumNodes(), individual.partition.size());
+    PartitionedHypergraph phg(context.partition.k, hypergraph, parallel_tag_t());
+    for ( const HypernodeID& hn : hypergraph.nodes() ) {
+      const PartitionID block = individual.partition[hn];
+      ASSERT_GE(block, 0);
+      ASSERT_LT(block, context.partition.k);
+      phg.setOnlyNodePart(hn, block);
+    }
+    phg.initializePartition();
+    ASSERT_EQ(metrics::quality(phg, context), individual.objective);
+    ASSERT_EQ(metrics::isBalanced(phg, context), individual.is_balanced);
+  }
+
+  Hypergraph hypergraph;
+  Context context;
+};
+
+TEST_F(AEvolutionaryAlgorithm, CreatesAnInitialPopulation) {
+  vec<Individual> population(4);
+  population[0] = partitionFirstIndividual();
+  HypergraphPool hypergraph_pool(hypergraph);
+  Evolutionary<TypeTraits>::createInitialPopulation(hypergraph_pool, context,
+    nullptr, std::chrono::high_resolution_clock::now(), population);
+
+  ASSERT_EQ(4, population.size());
+  for ( const Individual& individual : population ) {
+    verifyIndividual(individual);
+  }
+}
+
+TEST_F(AEvolutionaryAlgorithm, StopsCreatingTheInitialPopulationIfTimeLimitIsReached) {
+  vec<Individual> population(4);
+  population[0] = partitionFirstIndividual();
+  context.partition.time_limit = 1;
+  context.evolutionary.dynamic_population_amount_of_time = 0.5;
+  HypergraphPool hypergraph_pool(hypergraph);
+  // The time budget for the initial population has already elapsed
+  Evolutionary<TypeTraits>::createInitialPopulation(hypergraph_pool, context, nullptr,
+    std::chrono::high_resolution_clock::now() - std::chrono::seconds(1), population);
+
+  ASSERT_EQ(1, population.size());
+  verifyIndividual(population[0]);
+}
+
+TEST_F(AEvolutionaryAlgorithm, EncodesTheBlocksOfBothParentsForCombine) {
+  const PartitionID k = context.partition.k;
+  vec<PartitionID> parent_1(hypergraph.initialNumNodes());
+  vec<PartitionID> parent_2(hypergraph.initialNumNodes());
+  for ( const HypernodeID& hn : hypergraph.nodes() ) {
+    parent_1[hn] = hn % k;
+    parent_2[hn] = ( hn / k ) % k;
+  }
+
+  Evolutionary<TypeTraits>::setCommunityIDsOfParents(hypergraph, parent_1, &parent_2, k);
+  for ( const HypernodeID& hn : hypergraph.nodes() ) {
+    ASSERT_EQ(parent_1[hn] + k * parent_2[hn], hypergraph.communityID(hn));
+    // The V-cycle uses the community IDs modulo k as initial partition
+    ASSERT_EQ(parent_1[hn], hypergraph.communityID(hn) % k);
+  }
+  // Two nodes are in the same community iff both parents assign them to the same block
+  for ( HypernodeID u = 0; u < 2 * static_cast<HypernodeID>(k * k); ++u ) {
+    for ( HypernodeID v = 0; v < 2 * static_cast<HypernodeID>(k * k); ++v ) {
+      ASSERT_EQ(parent_1[u] == parent_1[v] && parent_2[u] == parent_2[v],
+                hypergraph.communityID(u) == hypergraph.communityID(v));
+    }
+  }
+}
+
+TEST_F(AEvolutionaryAlgorithm, UsesTheBlocksOfTheParentForMutation) {
+  const PartitionID k = context.partition.k;
+  vec<PartitionID> parent(hypergraph.initialNumNodes());
+  for ( const HypernodeID& hn : hypergraph.nodes() ) {
+    parent[hn] = hn % k;
+  }
+
+  Evolutionary<TypeTraits>::setCommunityIDsOfParents(hypergraph, parent, nullptr, k);
+  for ( const HypernodeID& hn : hypergraph.nodes() ) {
+    ASSERT_EQ(parent[hn], hypergraph.communityID(hn));
+  }
+}
+
+TEST_F(AEvolutionaryAlgorithm, ComputesABalancedPartition) {
+  context.evolutionary.population_size = 3;
+  context.evolutionary.num_generations = 2;
+  PartitionedHypergraph phg = Partitioner<TypeTraits>::partition(hypergraph, context);
+  ASSERT_TRUE(metrics::isBalanced(phg, context));
+  ASSERT_TRUE(parallel::MemoryPool::instance().is_unused_memory_allocations_activated());
+}
+
+}  // namespace mt_kahypar
@@ -508,5 +508,144 @@ TEST_F(AInitialPartitioningDataContainer, AppliesBestPartitionToHypergraphInPara
   ASSERT_EQ(1, partitioned_hypergraph.partID(6));
 }
 
+TEST_F(AInitialPartitioningDataContainer, SelectsEachAlgorithmOnceDuringPortfolioWarmup) {
+  context.initial_partitioning.use_portfolio_racing = true;
+  context.initial_partitioning.use_adaptive_ip_runs = true;
+  context.initial_partitioning.min_adaptive_ip_runs = 1;
+  context.initial_partitioning.enabled_ip_algos.assign(
+    static_cast<size_t>(InitialPartitioningAlgorithm::UNDEFINED), false);
+  context.initial_partitioning.enabled_ip_algos[static_cast<size_t>(InitialPartitioningAlgorithm::random)] = true;
+  context.initial_partitioning.enabled_ip_algos[static_cast<size_t>(InitialPartitioningAlgorithm::bfs)] = true;
+  PartitionedHypergraph partitioned_hypergraph(
+    context.partition.k, hypergraph);
+  InitialPartitioningDataContainer<TypeTraits> ip_data(
+    partitioned_hypergraph, context, true);
+
+  ASSERT_TRUE(ip_data.is_portfolio_racing_enabled());
+  const InitialPartitioningAlgorithm first = ip_data.next_algorithm();
+  const InitialPartitioningAlgorithm second = ip_data.next_algorithm();
+  ASSERT_NE(first, second);
+  ASSERT_TRUE(first == InitialPartitioningAlgorithm::random || first == InitialPartitioningAlgorithm::bfs);
+  ASSERT_TRUE(second == InitialPartitioningAlgorithm::random || second == InitialPartitioningAlgorithm::bfs);
+}
+
+TEST_F(AInitialPartitioningDataContainer, CancelsRunsOfDominatedAlgorithmsInPortfolio) {
+  context.initial_partitioning.use_portfolio_racing = true;
+  context.initial_partitioning.use_adaptive_ip_runs = true;
+  context.initial_partitioning.min_adaptive_ip_runs = 1;
+  context.initial_partitioning.enabled_ip_algos.assign(
+    static_cast<size_t>(InitialPartitioningAlgorithm::UNDEFINED), false);
+  context.initial_partitioning.enabled_ip_algos[static_cast<size_t>(InitialPartitioningAlgorithm::random)] = true;
+  context.initial_partitioning.enabled_ip_algos[static_cast<size_t>(InitialPartitioningAlgorithm::bfs)] = true;
+  PartitionedHypergraph partitioned_hypergraph(
+    context.partition.k, hypergraph);
+  InitialPartitioningDataContainer<TypeTraits> ip_data(
+    partitioned_hypergraph, context, true);
+  PartitionedHypergraph& local_hg = ip_data.local_partitioned_hypergraph();
+  ip_data.next_algorithm();
+  ip_data.next_algorithm();
+
+  // Cut = 3
+  local_hg.setNodePart(0, 0);
+  local_hg.setNodePart(1, 0);
+  local_hg.setNodePart(2, 0);
+  local_hg.setNodePart(3, 0);
+  local_hg.setNodePart(4, 1);
+  local_hg.setNodePart(5, 1);
+  local_hg.setNodePart(6, 1);
+  ip_data.commit(InitialPartitioningAlgorithm::bfs);
+  ASSERT_FALSE(ip_data.should_cancel(InitialPartitioningAlgorithm::bfs));
+
+  // Cut = 2
+  local_hg.setNodePart(0, 0);
+  local_hg.setNodePart(1, 0);
+  local_hg.setNodePart(2, 0);
+  local_hg.setNodePart(3, 1);
+  local_hg.setNodePart(4, 1);
+  local_hg.setNodePart(5, 1);
+  local_hg.setNodePart(6, 1);
+  ip_data.commit(InitialPartitioningAlgorithm::random);
+  ASSERT_TRUE(ip_data.should_cancel(InitialPartitioningAlgorithm::bfs));
+  ASSERT_FALSE(ip_data.should_cancel(InitialPartitioningAlgorithm::random));
+  ASSERT_EQ(InitialPartitioningAlgorithm::random, ip_data.next_algorithm());
+
+  // Dominated runs are discarded
+  local_hg.setNodePart(0, 1);
+  ip_data.cancel(InitialPartitioningAlgorithm::bfs);
+  ASSERT_EQ(kInvalidPartition, local_hg.partID(0));
+
+  ip_data.apply();
+  ASSERT_EQ(2, metrics::quality(partitioned_hypergraph, context.partition.objective));
+}
+
+TEST_F(AInitialPartitioningDataContainer, NeverCancelsRunsOfTheBestAlgorithmInPortfolio) {
+  context.initial_partitioning.use_portfolio_racing = true;
+  context.initial_partitioning.use_adaptive_ip_runs = true;
+  context.initial_partitioning.min_adaptive_ip_runs = 1;
+  context.initial_partitioning.enabled_ip_algos.assign(
+    static_cast<size_t>(InitialPartitioningAlgorithm::UNDEFINED), false);
+  context.initial_partitioning.enabled_ip_algos[static_cast<size_t>(InitialPartitioningAlgorithm::random)] = true;
+  PartitionedHypergraph partitioned_hypergraph(
+    context.partition.k, hypergraph);
+  InitialPartitioningDataContainer<TypeTraits> ip_data(
+    partitioned_hypergraph, context, true);
+  PartitionedHypergraph& local_hg = ip_data.local_partitioned_hypergraph();
+
+  // Cut = 2
+  ip_data.next_algorithm();
+  local_hg.setNodePart(0, 0);
+  local_hg.setNodePart(1, 0);
+  local_hg.setNodePart(2, 0);
+  local_hg.setNodePart(3, 1);
+  local_hg.setNodePart(4, 1);
+  local_hg.setNodePart(5, 1);
+  local_hg.setNodePart(6, 1);
+  ip_data.commit(InitialPartitioningAlgorithm::random);
+
+  // Cut = 3 => average - 2 * stddev of the random runs exceeds the best quality
+  for ( size_t i = 0; i < 6; ++i ) {
+    ASSERT_EQ(InitialPartitioningAlgorithm::random, ip_data.next_algorithm());
+    local_hg.setNodePart(0, 0);
+    local_hg.setNodePart(1, 0);
+    local_hg.setNodePart(2, 0);
+    local_hg.setNodePart(3, 0);
+    local_hg.setNodePart(4, 1);
+    local_hg.setNodePart(5, 1);
+    local_hg.setNodePart(6, 1);
+    ip_data.commit(InitialPartitioningAlgorithm::random);
+  }
+  ASSERT_FALSE(ip_data.should_cancel(InitialPartitioningAlgorithm::random));
+  ASSERT_EQ(InitialPartitioningAlgorithm::random, ip_data.next_algorithm());
+}
+
+TEST_F(AInitialPartitioningDataContainer, ReusesLocalDataOfPreviousBipartitioningCall) {
+  InitialPartitioningDataContainer<TypeTraits>::release_workspaces();
+  PartitionedHypergraph partitioned_hypergraph(
+    context.partition.k, hypergraph);
+  PartitionedHypergraph* local_hg_of_first_call = nullptr;
+  {
+    InitialPartitioningDataContainer<TypeTraits> ip_data(
+      partitioned_hypergraph, context, true);
+    PartitionedHypergraph& local_hg = ip_data.local_partitioned_hypergraph();
+    local_hg.setNodePart(0, 0);
+    local_hg.setNodePart(1, 1);
+    local_hg_of_first_call = &local_hg;
+  }
+  ASSERT_EQ(UL(1), InitialPartitioningDataContainer<TypeTraits>::num_available_workspaces());
+
+  {
+    InitialPartitioningDataContainer<TypeTraits> ip_data(
+      partitioned_hypergraph, context, true);
+    PartitionedHypergraph& local_hg = ip_data.local_partitioned_hypergraph();
+    ASSERT_EQ(local_hg_of_first_call, &local_hg);
+    ASSERT_EQ(UL(0), InitialPartitioningDataContainer<TypeTraits>::num_available_workspaces());
+    for ( const HypernodeID& hn : local_hg.nodes() ) {
+      ASSERT_EQ(kInvalidPartition, local_hg.partID(hn));
+    }
+  }
+
+  InitialPartitioningDataContainer<TypeTraits>::release_workspaces();
+  ASSERT_EQ(UL(0), InitialPartitioningDataContainer<TypeTraits>::num_available_workspaces());
+}
 
 }  // namespace mt_kahypar
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <random>
+
+#include "mt-kahypar/datastructures/static_graph_factory.h"
+#include "mt-kahypar/partition/mapping/all_pair_shortest_path.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+using HyperedgeVector = parallel::scalable_vector<parallel::scalable_vector<HypernodeID>>;
+static constexpr HyperedgeWeight INF = std::numeric_limits<HyperedgeWeight>::max() / 3;
+
+ds::StaticGraph constructRandomGraph(const HypernodeID num_nodes,
+                                     const HyperedgeID num_edges,
+                                     const HyperedgeWeight max_edge_weight) {
+  std::mt19937 rng(420);
+  std::uniform_int_distribution<HypernodeID> node_dist(0, num_nodes - 1);
+  std::uniform_int_distribution<HyperedgeWeight> weight_dist(1, max_edge_weight);
+  HyperedgeVector edges;
+  vec<HyperedgeWeight> edge_weights;
+  while ( edges.size() < num_edges ) {
+    const HypernodeID u = node_dist(rng);
+    const HypernodeID v = node_dist(rng);
+    if ( u != v ) {
+      edges.push_back({ u, v });
+      edge_weights.push_back(weight_dist(rng));
+    }
+  }
+  return ds::StaticGraphFactory::construct(num_nodes, num_edges, edges, edge_weights.data());
+}
+
+// Same construction as in tools/hierarchical_process_graph_generator.cc
+void constructHierarchicalGraph(HyperedgeVector& edges,
+                                vec<HyperedgeWeight>& edge_weights,
+                                const HypernodeID core_start,
+                                const HypernodeID core_end,
+                                const vec<HypernodeID>& hierarchy,
+                                const vec<HyperedgeWeight>& costs,
+                                const size_t cur_level) {
+  if ( cur_level >= hierarchy.size() ) return;
+  const HypernodeID cores_per_node = ( core_end - core_start ) / hierarchy[cur_level];
+  for ( HypernodeID core_1 = core_start; core_1 < core_end; ++core_1 ) {
+    for ( HypernodeID core_2 = core_1 + 1; core_2 < core_end; ++core_2 ) {
+      if ( core_1 / cores_per_node != core_2 / cores_per_node ) {
+        edges.push_back({ core_1, core_2 });
+        edge_weights.push_back(costs[cur_level]);
+      }
+    }
+  }
+  for ( HypernodeID i = 0; i < hierarchy[cur_level]; ++i ) {
+    constructHierarchicalGraph(edges, edge_weights, core_start + i * cores_per_node,
+      core_start + ( i + 1 ) * cores_per_node, hierarchy, costs, cur_level + 1);
+  }
+}
+
+void verifyAgainstSequentialFloyd(const ds::StaticGraph& graph) {
+  const size_t n = graph.initialNumNodes();
+  vec<HyperedgeWeight> expected(n * n, INF);
+  vec<HyperedgeWeight> actual(n * n, INF);
+  AllPairShortestPath::computeSequential(graph, expected);
+  AllPairShortestPath::compute(graph, actual);
+  for ( size_t i = 0; i < n * n; ++i ) {
+    ASSERT_EQ(expected[i], actual[i]) << V(i % n) << V(i / n);
+  }
+}
+} // namespace
+
+TEST(AAllPairShortestPath, ComputesDistancesOfASmallGraph) {
+  // 0 --1-- 1 --2-- 2 --1-- 3
+  // |                       |
+  // ----------- 7 -----------
+  vec<HyperedgeWeight> edge_weights = { 1, 2, 1, 7 };
+  ds::StaticGraph graph = ds::StaticGraphFactory::construct(4, 4,
+    { { 0, 1 }, { 1, 2 }, { 2, 3 }, { 0, 3 } }, edge_weights.data());
+  vec<HyperedgeWeight> distances(16, INF);
+  AllPairShortestPath::compute(graph, distances);
+  ASSERT_EQ(0, distances[0 + 0 * 4]);
+  ASSERT_EQ(1, distances[0 + 1 * 4]);
+  ASSERT_EQ(3, distances[0 + 2 * 4]);
+  ASSERT_EQ(4, distances[0 + 3 * 4]);
+  ASSERT_EQ(2, distances[1 + 2 * 4]);
+  ASSERT_EQ(3, distances[1 + 3 * 4]);
+  ASSERT_EQ(4, distances[3 + 0 * 4]);
+}
+
+TEST(AAllPairShortestPath, ComputesSameDistancesAsSequentialFloydOnASparseGraph) {
+  verifyAgainstSequentialFloyd(constructRandomGraph(150, 300, 10));
+}
+
+TEST(AAllPairShortestPath, ComputesSameDistancesAsSequentialFloydOnADenseGraph) {
+  verifyAgainstSequentialFloyd(constructRandomGraph(200, 5000, 100));
+}
+
+TEST(AAllPairShortestPath, ComputesSameDistancesAsSequentialFloydOnADisconnectedGraph) {
+  verifyAgainstSequentialFloyd(constructRandomGraph(130, 40, 5));
+}
+
+TEST(AAllPairShortestPath, ComputesDistancesOfAHierarchicalProcessGraph) {
+  // 4 racks with 8 nodes each containing 6 cores
+  const vec<HypernodeID> hierarchy = { 4, 8, 6 };
+  const vec<HyperedgeWeight> costs = { 100, 10, 1 };
+  const HypernodeID n = 4 * 8 * 6;
+  HyperedgeVector edges;
+  vec<HyperedgeWeight> edge_weights;
+  constructHierarchicalGraph(edges, edge_weights, 0, n, hierarchy, costs, 0);
+  ds::StaticGraph graph = ds::StaticGraphFactory::construct(
+    n, edges.size(), edges, edge_weights.data());
+  verifyAgainstSequentialFloyd(graph);
+
+  vec<HyperedgeWeight> distances(n * n, INF);
+  AllPairShortestPath::compute(graph, distances);
+  for ( HypernodeID u = 0; u < n; ++u ) {
+    for ( HypernodeID v = 0; v < n; ++v ) {
+      const HyperedgeWeight expected = u == v ? 0 :
+        u / 48 != v / 48 ? 100 : ( u / 6 != v / 6 ? 10 : 1 );
+      ASSERT_EQ(expected, distances[u + v * n]);
+    }
+  }
+}
+
+}  // namespace mt_kahypar
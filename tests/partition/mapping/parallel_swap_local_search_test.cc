@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/datastructures/static_graph_factory.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/mapping/parallel_swap_local_search.h"
+#include "mt-kahypar/partition/mapping/target_graph.h"
+#include "mt-kahypar/utils/randomize.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+class AParallelSwapLocalSearch : public Test {
+
+ public:
+  using Hypergraph = ds::StaticHypergraph;
+  using PartitionedHypergraph = StaticPartitionedHypergraph;
+  using HyperedgeVector = vec<vec<HypernodeID>>;
+
+  AParallelSwapLocalSearch() :
+    hg(),
+    phg(),
+    target_graph(nullptr) {
+    utils::Randomize::instance().setSeed(42);
+
+    // 4x4 grid with unit edge weights
+    vec<HyperedgeWeight> edge_weights(24, 1);
+    target_graph = std::make_unique<TargetGraph>(
+      ds::StaticGraphFactory::construct(16, 24,
+        { { 0, 1 }, { 1, 2 }, { 2, 3 },
+          { 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 },
+          { 4, 5 }, { 5, 6 }, { 6, 7 },
+          { 4, 8 }, { 5, 9 }, { 6, 10 }, { 7, 11 },
+          { 8, 9 }, { 9, 10 }, { 10, 11 },
+          { 8, 12 }, { 9, 13 }, { 10, 14 }, { 11, 15 },
+          { 12, 13 }, { 13, 14 }, { 14, 15 } },
+          edge_weights.data()));
+    target_graph->precomputeDistances(4);
+
+    // Communication hypergraph: A ring of 16 processes with some additional hyperedges
+    HyperedgeVector edges;
+    for ( HypernodeID u = 0; u < 16; ++u ) {
+      edges.push_back({ u, ( u + 1 ) % 16 });
+    }
+    edges.push_back({ 0, 4, 8, 12 });
+    edges.push_back({ 2, 3, 5 });
+    edges.push_back({ 7, 9, 11, 13, 15 });
+    hg = Hypergraph::Factory::construct(16, edges.size(), edges);
+    phg = PartitionedHypergraph(16, hg, parallel_tag_t { });
+    phg.setTargetGraph(target_graph.get());
+  }
+
+  void assignRandomMapping() {
+    vec<PartitionID> blocks(16);
+    std::iota(blocks.begin(), blocks.end(), 0);
+    std::shuffle(blocks.begin(), blocks.end(), utils::Randomize::instance().getGenerator());
+    phg.resetPartition();
+    for ( const HypernodeID& hn : hg.nodes() ) {
+      phg.setOnlyNodePart(hn, blocks[hn]);
+    }
+    phg.initializePartition();
+  }
+
+  void verifyOneToOneMapping() {
+    vec<bool> used_blocks(16, false);
+    for ( const HypernodeID& hn : hg.nodes() ) {
+      const PartitionID block = phg.partID(hn);
+      ASSERT_NE(kInvalidPartition, block);
+      ASSERT_FALSE(used_blocks[block]);
+      used_blocks[block] = true;
+    }
+  }
+
+  Hypergraph hg;
+  PartitionedHypergraph phg;
+  std::unique_ptr<TargetGraph> target_graph;
+};
+
+TEST_F(AParallelSwapLocalSearch, ImprovesAMapping) {
+  HyperedgeWeight total_objective_before = 0;
+  HyperedgeWeight total_objective_after = 0;
+  for ( size_t i = 0; i < 5; ++i ) {
+    assignRandomMapping();
+    const HyperedgeWeight objective_before = metrics::quality(phg, Objective::steiner_tree);
+    ParallelSwapLocalSearch<PartitionedHypergraph>::improve(phg, *target_graph);
+    const HyperedgeWeight objective_after = metrics::quality(phg, Objective::steiner_tree);
+    ASSERT_LE(objective_after, objective_before);
+    verifyOneToOneMapping();
+    total_objective_before += objective_before;
+    total_objective_after += objective_after;
+  }
+  ASSERT_LT(total_objective_after, total_objective_before);
+}
+
+TEST_F(AParallelSwapLocalSearch, ProducesALocalOptimum) {
+  assignRandomMapping();
+  ParallelSwapLocalSearch<PartitionedHypergraph>::improve(phg, *target_graph);
+  const HyperedgeWeight objective = metrics::quality(phg, Objective::steiner_tree);
+  // A second call does not find an improvement anymore
+  ParallelSwapLocalSearch<PartitionedHypergraph>::improve(phg, *target_graph);
+  ASSERT_EQ(objective, metrics::quality(phg, Objective::steiner_tree));
+}
+
+TEST_F(AParallelSwapLocalSearch, DoesNotWorsenAGoodMapping) {
+  // Ring of 16 processes on a 4x4 grid
+  vec<PartitionID> ring = { 0, 1, 2, 3, 7, 6, 5, 4, 8, 9, 10, 11, 15, 14, 13, 12 };
+  phg.resetPartition();
+  for ( const HypernodeID& hn : hg.nodes() ) {
+    phg.setOnlyNodePart(hn, ring[hn]);
+  }
+  phg.initializePartition();
+  const HyperedgeWeight objective_before = metrics::quality(phg, Objective::steiner_tree);
+  ParallelSwapLocalSearch<PartitionedHypergraph>::improve(phg, *target_graph);
+  ASSERT_LE(metrics::quality(phg, Objective::steiner_tree), objective_before);
+  verifyOneToOneMapping();
+}
+
+TEST_F(AParallelSwapLocalSearch, ImprovesAMappingWithSampledCandidates) {
+  HyperedgeWeight total_objective_before = 0;
+  HyperedgeWeight total_objective_after = 0;
+  for ( size_t i = 0; i < 5; ++i ) {
+    assignRandomMapping();
+    const HyperedgeWeight objective_before = metrics::quality(phg, Objective::steiner_tree);
+    ParallelSwapLocalSearch<PartitionedHypergraph>::improve(phg, *target_graph, 2);
+    const HyperedgeWeight objective_after = metrics::quality(phg, Objective::steiner_tree);
+    ASSERT_LE(objective_after, objective_before);
+    verifyOneToOneMapping();
+    total_objective_before += objective_before;
+    total_objective_after += objective_after;
+  }
+  ASSERT_LT(total_objective_after, total_objective_before);
+}
+
+}  // namespace mt_kahypar
@@ -0,0 +1,168 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "tbb/parallel_for.h"
+
+#include "mt-kahypar/partition/mapping/steiner_tree_cache.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+uint64_t hashOf(const vec<PartitionID>& blocks) {
+  ds::Bitset bitset(128);
+  for ( const PartitionID block : blocks ) {
+    bitset.set(block);
+  }
+  return SteinerTreeCache::hash(ds::StaticBitset(bitset.numBlocks(), bitset.data()));
+}
+} // namespace
+
+TEST(ASteinerTreeCache, HasPowerOfTwoNumberOfBuckets) {
+  ASSERT_EQ(5, SteinerTreeCache(1).capacity());
+  ASSERT_EQ(80, SteinerTreeCache(100).capacity());
+  ASSERT_EQ(16 * 64, SteinerTreeCache(100).size_in_bytes());
+}
+
+TEST(ASteinerTreeCache, HashDependsOnlyOnTheConnectivitySet) {
+  ASSERT_EQ(hashOf({ 1, 5, 77 }), hashOf({ 77, 5, 1 }));
+  ASSERT_NE(hashOf({ 1, 5, 77 }), hashOf({ 1, 5, 78 }));
+  ASSERT_NE(hashOf({ 1, 5 }), hashOf({ 1, 5, 77 }));
+}
+
+TEST(ASteinerTreeCache, FindsInsertedEntries) {
+  SteinerTreeCache cache(1000, true);
+  HyperedgeWeight weight = 0;
+  ASSERT_FALSE(cache.find(hashOf({ 1, 2, 3 }), weight));
+  cache.insert(hashOf({ 1, 2, 3 }), 42);
+  cache.insert(hashOf({ 4, 5, 6 }), 17);
+  ASSERT_TRUE(cache.find(hashOf({ 1, 2, 3 }), weight));
+  ASSERT_EQ(42, weight);
+  ASSERT_TRUE(cache.find(hashOf({ 4, 5, 6 }), weight));
+  ASSERT_EQ(17, weight);
+  ASSERT_FALSE(cache.find(hashOf({ 1, 2, 4 }), weight));
+
+  const SteinerTreeCache::Stats stats = cache.stats();
+  ASSERT_EQ(2, stats.hits);
+  ASSERT_EQ(2, stats.misses);
+  ASSERT_EQ(2, stats.insertions);
+  ASSERT_EQ(0, stats.evictions);
+}
+
+TEST(ASteinerTreeCache, ComparesTheFullKey) {
+  // Single bucket, hashes only differ in their lower 32 bits
+  SteinerTreeCache cache(5);
+  HyperedgeWeight weight = 0;
+  cache.insert(UL(1) << 32, 42);
+  ASSERT_FALSE(cache.find(( UL(1) << 32 ) | 2, weight));
+  cache.insert(( UL(1) << 32 ) | 2, 17);
+  ASSERT_TRUE(cache.find(UL(1) << 32, weight));
+  ASSERT_EQ(42, weight);
+  ASSERT_TRUE(cache.find(( UL(1) << 32 ) | 2, weight));
+  ASSERT_EQ(17, weight);
+}
+
+TEST(ASteinerTreeCache, DoesNotCountStatsIfDisabled) {
+  SteinerTreeCache cache(1000);
+  HyperedgeWeight weight = 0;
+  cache.insert(hashOf({ 1, 2, 3 }), 42);
+  ASSERT_TRUE(cache.find(hashOf({ 1, 2, 3 }), weight));
+  ASSERT_FALSE(cache.find(hashOf({ 4, 5, 6 }), weight));
+  ASSERT_EQ(0, cache.stats().hits);
+  ASSERT_EQ(0, cache.stats().misses);
+}
+
+TEST(ASteinerTreeCache, EvictsEntriesIfFull) {
+  // Single bucket with 5 entries
+  SteinerTreeCache cache(5, true);
+  for ( uint64_t hash = 1; hash <= 5; ++hash ) {
+    cache.insert(hash << 32, hash);
+  }
+  ASSERT_EQ(0, cache.stats().evictions);
+
+  // Reference all entries except the first one
+  HyperedgeWeight weight = 0;
+  for ( uint64_t hash = 2; hash <= 5; ++hash ) {
+    ASSERT_TRUE(cache.find(hash << 32, weight));
+    ASSERT_EQ(hash, weight);
+  }
+
+  // CLOCK evicts the only entry without reference bit
+  cache.insert(UL(6) << 32, 6);
+  ASSERT_EQ(1, cache.stats().evictions);
+  ASSERT_FALSE(cache.find(UL(1) << 32, weight));
+  for ( uint64_t hash = 2; hash <= 6; ++hash ) {
+    ASSERT_TRUE(cache.find(hash << 32, weight));
+    ASSERT_EQ(hash, weight);
+  }
+}
+
+TEST(ASteinerTreeCache, EvictsInRoundRobinOrderWithoutReferences) {
+  // Single bucket with 5 entries. The clock hand passes more than 256 times
+  // through the bucket, which must not skew the round-robin order.
+  SteinerTreeCache cache(5, true);
+  const uint64_t num_insertions = 1000;
+  for ( uint64_t hash = 1; hash <= num_insertions; ++hash ) {
+    cache.insert(hash, hash);
+  }
+  ASSERT_EQ(num_insertions - 5, cache.stats().evictions);
+  HyperedgeWeight weight = 0;
+  for ( uint64_t hash = num_insertions - 4; hash <= num_insertions; ++hash ) {
+    ASSERT_TRUE(cache.find(hash, weight));
+    ASSERT_EQ(hash, weight);
+  }
+}
+
+TEST(ASteinerTreeCache, NeverExceedsItsCapacity) {
+  SteinerTreeCache cache(1 << 10, true);
+  const size_t num_entries = 1 << 16;
+  tbb::parallel_for(UL(0), num_entries, [&](const size_t i) {
+    const uint64_t hash = hashing::integer::hash64(i);
+    HyperedgeWeight weight = 0;
+    if ( !cache.find(hash, weight) ) {
+      cache.insert(hash, static_cast<HyperedgeWeight>(i));
+    }
+  });
+  const SteinerTreeCache::Stats stats = cache.stats();
+  ASSERT_EQ(num_entries, stats.insertions);
+  ASSERT_EQ(num_entries - cache.capacity(), stats.evictions);
+
+  // All remaining entries map to correct values
+  size_t num_found = 0;
+  for ( size_t i = 0; i < num_entries; ++i ) {
+    HyperedgeWeight weight = 0;
+    if ( cache.find(hashing::integer::hash64(i), weight) ) {
+      ASSERT_EQ(static_cast<HyperedgeWeight>(i), weight);
+      ++num_found;
+    }
+  }
+  ASSERT_EQ(cache.capacity(), num_found);
+}
+
+}  // namespace mt_kahypar
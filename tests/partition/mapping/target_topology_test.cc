@@ -0,0 +1,155 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/datastructures/static_graph_factory.h"
+#include "mt-kahypar/partition/mapping/target_topology.h"
+#include "mt-kahypar/partition/mapping/target_graph.h"
+#include "mt-kahypar/partition/mapping/set_enumerator.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+using HyperedgeVector = parallel::scalable_vector<parallel::scalable_vector<HypernodeID>>;
+
+// Explicit target graph as constructed by tools/hierarchical_process_graph_generator.cc
+TargetGraph constructHierarchicalTargetGraph(const vec<HypernodeID>& dimensions,
+                                             const vec<HyperedgeWeight>& costs) {
+  HypernodeID n = 1;
+  vec<HypernodeID> group_size;
+  for ( const HypernodeID a : dimensions ) {
+    group_size.push_back(n);
+    n *= a;
+  }
+  HyperedgeVector edges;
+  vec<HyperedgeWeight> edge_weights;
+  for ( HypernodeID u = 0; u < n; ++u ) {
+    for ( HypernodeID v = u + 1; v < n; ++v ) {
+      size_t level = dimensions.size() - 1;
+      while ( u / group_size[level] == v / group_size[level] ) --level;
+      edges.push_back({ u, v });
+      edge_weights.push_back(costs[level]);
+    }
+  }
+  return TargetGraph(ds::StaticGraphFactory::construct(
+    n, edges.size(), edges, edge_weights.data()));
+}
+} // namespace
+
+TEST(ATargetTopology, HasCorrectNumberOfBlocks) {
+  ASSERT_EQ(48, TargetTopology::hierarchy({ 4, 2, 6 }, { 1, 10, 100 }).numBlocks());
+  ASSERT_EQ(64, TargetTopology::torus({ 4, 4, 4 }).numBlocks());
+}
+
+TEST(ATargetTopology, ParsesDimensionsAndCosts) {
+  TargetTopology topology = TargetTopology::fromString(
+    TargetTopology::Type::hierarchy, "2:3:4", "1:5:20");
+  ASSERT_EQ(24, topology.numBlocks());
+  ASSERT_EQ(1, topology.distance(0, 1));
+  ASSERT_EQ(5, topology.distance(0, 2));
+  ASSERT_EQ(20, topology.distance(0, 6));
+}
+
+TEST(ATargetTopology, ComputesDistancesInAHierarchy) {
+  TargetTopology topology = TargetTopology::hierarchy({ 4, 2, 3 }, { 1, 10, 100 });
+  ASSERT_EQ(0, topology.distance(5, 5));
+  ASSERT_EQ(1, topology.distance(0, 3));
+  ASSERT_EQ(10, topology.distance(3, 4));
+  ASSERT_EQ(100, topology.distance(7, 8));
+  ASSERT_EQ(100, topology.distance(23, 0));
+}
+
+TEST(ATargetTopology, ComputesDistancesInATorus) {
+  TargetTopology topology = TargetTopology::torus({ 5, 4 }, { 1, 3 });
+  ASSERT_EQ(0, topology.distance(7, 7));
+  ASSERT_EQ(1, topology.distance(0, 1));
+  ASSERT_EQ(1, topology.distance(0, 4)); // wrap around
+  ASSERT_EQ(2, topology.distance(0, 2));
+  ASSERT_EQ(3, topology.distance(0, 5));
+  ASSERT_EQ(3, topology.distance(0, 15)); // wrap around
+  ASSERT_EQ(8, topology.distance(0, 12));
+}
+
+TEST(ATargetTopology, HasSameDistancesAsTheConstructedGraphOfATorus) {
+  TargetGraph target_graph(TargetTopology::torus({ 3, 4, 2 }, { 1, 2, 5 }));
+  TargetGraph explicit_graph(TargetTopology::torus({ 3, 4, 2 }, { 1, 2, 5 }).constructGraph());
+  target_graph.precomputeDistances(2);
+  explicit_graph.precomputeDistances(2);
+  for ( PartitionID i = 0; i < 24; ++i ) {
+    for ( PartitionID j = 0; j < 24; ++j ) {
+      ASSERT_EQ(explicit_graph.distance(i, j), target_graph.distance(i, j)) << V(i) << V(j);
+    }
+  }
+}
+
+TEST(ATargetTopology, ComputesOptimalSteinerTreesInAHierarchy) {
+  const vec<HypernodeID> dimensions = { 3, 2, 2 };
+  const vec<HyperedgeWeight> costs = { 1, 4, 9 };
+  TargetGraph target_graph(TargetTopology::hierarchy(dimensions, costs));
+  TargetGraph explicit_graph = constructHierarchicalTargetGraph(dimensions, costs);
+  target_graph.precomputeDistances(4);
+  explicit_graph.precomputeDistances(4);
+  for ( size_t m = 1; m <= 4; ++m ) {
+    SetEnumerator sets(12, m);
+    for ( const ds::StaticBitset& set : sets ) {
+      ASSERT_EQ(explicit_graph.distance(set), target_graph.distance(set));
+    }
+  }
+}
+
+TEST(ATargetTopology, ComputesLowerBoundOfSteinerTreesInATorus) {
+  TargetTopology topology = TargetTopology::torus({ 4, 3 });
+  TargetGraph explicit_graph(topology.constructGraph());
+  explicit_graph.precomputeDistances(3);
+  for ( size_t m = 1; m <= 3; ++m ) {
+    SetEnumerator sets(12, m);
+    for ( const ds::StaticBitset& set : sets ) {
+      const HyperedgeWeight weight = topology.distance(set);
+      ASSERT_LE(weight, explicit_graph.distance(set));
+      if ( m <= 2 ) {
+        ASSERT_EQ(explicit_graph.distance(set), weight);
+      }
+    }
+  }
+}
+
+TEST(ATargetTopology, ComputesWeightOfSetsInALargeHierarchy) {
+  // 32 racks with 16 nodes each containing 64 cores
+  TargetGraph target_graph(TargetTopology::hierarchy({ 64, 16, 32 }, { 1, 10, 100 }));
+  target_graph.precomputeDistances(10);
+  ASSERT_EQ(32768, target_graph.numBlocks());
+  ds::Bitset bitset(target_graph.numBlocks());
+  bitset.set(0); bitset.set(1); bitset.set(63);   // same node
+  bitset.set(64);                                 // same rack
+  bitset.set(1024); bitset.set(1025);             // other rack
+  bitset.set(32767);                              // last core
+  ASSERT_EQ(1 + 1 + 10 + 100 + 1 + 100, target_graph.distance(bitset));
+}
+
+}  // namespace mt_kahypar
@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "tbb/task_arena.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/command_line_options.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/partitioner_facade.h"
+#include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/delete.h"
+#include "mt-kahypar/utils/randomize.h"
+#include "mt-kahypar/utils/utilities.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+  using TypeTraits = StaticHypergraphTypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+}
+
+class ABatchPartitioner : public Test {
+
+ public:
+  ABatchPartitioner() :
+    filenames({ "../tests/instances/contracted_unweighted_ibm01.hgr",
+                "../tests/instances/test_instance.hgr",
+                "../tests/instances/karate_club.graph.hgr" }),
+    context() {
+    parseIniToContext(context, "../config/deterministic_preset.ini");
+    context.partition.mode = Mode::direct;
+    context.partition.preset_type = PresetType::deterministic;
+    context.partition.instance_type = InstanceType::hypergraph;
+    context.partition.partition_type = PartitionedHypergraph::TYPE;
+    context.partition.objective = Objective::km1;
+    context.partition.gain_policy = GainPolicy::km1;
+    context.partition.epsilon = 0.03;
+    context.partition.k = 4;
+    context.partition.seed = 42;
+    context.partition.verbose_output = false;
+    context.shared_memory.num_threads = 1;
+    context.shared_memory.original_num_threads = 1;
+    context.utility_id = utils::Utilities::instance().registerNewUtilityObjects();
+  }
+
+  mt_kahypar_hypergraph_t readHypergraph(const std::string& filename) {
+    return io::readInputFile(filename, context.partition.preset_type,
+      context.partition.instance_type, FileFormat::hMetis, true);
+  }
+
+  // ! Partitions the hypergraph with a single call to the partitioner
+  mt_kahypar_partitioned_hypergraph_t partitionSingle(mt_kahypar_hypergraph_t hypergraph) {
+    Context single_context(context);
+    utils::Randomize::instance().setSeed(single_context.partition.seed);
+    mt_kahypar_partitioned_hypergraph_t partitioned_hg { nullptr, NULLPTR_PARTITION };
+    tbb::task_arena arena(1);
+    arena.execute([&] {
+      partitioned_hg = PartitionerFacade::partition(hypergraph, single_context);
+    });
+    return partitioned_hg;
+  }
+
+  std::vector<std::string> filenames;
+  Context context;
+};
+
+TEST_F(ABatchPartitioner, ComputesTheSamePartitionsAsSinglePartitionerCalls) {
+  const size_t num_hypergraphs = filenames.size();
+  std::vector<mt_kahypar_hypergraph_t> hypergraphs;
+  for ( const std::string& filename : filenames ) {
+    hypergraphs.push_back(readHypergraph(filename));
+  }
+  std::vector<mt_kahypar_partitioned_hypergraph_t> partitioned_hgs(
+    num_hypergraphs, mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION });
+  PartitionerFacade::partitionBatch(hypergraphs.data(), num_hypergraphs, context, partitioned_hgs.data());
+
+  for ( size_t i = 0; i < num_hypergraphs; ++i ) {
+    mt_kahypar_hypergraph_t hypergraph = readHypergraph(filenames[i]);
+    mt_kahypar_partitioned_hypergraph_t expected_hg = partitionSingle(hypergraph);
+    ASSERT_NE(nullptr, partitioned_hgs[i].partitioned_hg);
+    ASSERT_NE(nullptr, expected_hg.partitioned_hg);
+    PartitionedHypergraph& phg = utils::cast<PartitionedHypergraph>(partitioned_hgs[i]);
+    PartitionedHypergraph& expected_phg = utils::cast<PartitionedHypergraph>(expected_hg);
+    ASSERT_EQ(expected_phg.initialNumNodes(), phg.initialNumNodes());
+    for ( const HypernodeID& hn : expected_phg.nodes() ) {
+      ASSERT_EQ(expected_phg.partID(hn), phg.partID(hn)) << filenames[i];
+    }
+    utils::delete_partitioned_hypergraph(expected_hg);
+    utils::delete_partitioned_hypergraph(partitioned_hgs[i]);
+    utils::delete_hypergraph(hypergraphs[i]);
+    utils::delete_hypergraph(hypergraph);
+  }
+}
+
+}  // namespace mt_kahypar
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/command_line_options.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/memory_budget.h"
+#include "mt-kahypar/partition/partitioner_facade.h"
+#include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/delete.h"
+#include "mt-kahypar/utils/utilities.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+  using TypeTraits = StaticHypergraphTypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+  static constexpr size_t MEGABYTE = 1024 * 1024;
+}
+
+class AMemoryBudget : public Test {
+
+ public:
+  AMemoryBudget() :
+    hypergraph(),
+    context() {
+    parseIniToContext(context, "../config/default_preset.ini");
+    context.partition.graph_filename = "../tests/instances/contracted_unweighted_ibm01.hgr";
+    context.partition.mode = Mode::direct;
+    context.partition.preset_type = PresetType::default_preset;
+    context.partition.instance_type = InstanceType::hypergraph;
+    context.partition.partition_type = PartitionedHypergraph::TYPE;
+    context.partition.objective = Objective::km1;
+    context.partition.gain_policy = GainPolicy::km1;
+    context.partition.epsilon = 0.03;
+    context.partition.k = 4;
+    context.partition.verbose_output = false;
+    context.shared_memory.num_threads = 2;
+    context.shared_memory.original_num_threads = 2;
+    context.utility_id = utils::Utilities::instance().registerNewUtilityObjects();
+
+    hypergraph = io::readInputFile<Hypergraph>(
+      context.partition.graph_filename, FileFormat::hMetis, true);
+  }
+
+  void verifyThatAlgorithmsAreUnchanged(const Context& input_context) {
+    ASSERT_EQ(input_context.preprocessing.community_detection.low_memory_contraction,
+              context.preprocessing.community_detection.low_memory_contraction);
+    ASSERT_EQ(input_context.refinement.fm.perform_moves_global,
+              context.refinement.fm.perform_moves_global);
+    ASSERT_EQ(input_context.refinement.fm.algorithm, context.refinement.fm.algorithm);
+    ASSERT_EQ(input_context.refinement.global_fm.use_global_fm,
+              context.refinement.global_fm.use_global_fm);
+    ASSERT_EQ(input_context.partition.partition_type, context.partition.partition_type);
+  }
+
+  Hypergraph hypergraph;
+  Context context;
+};
+
+TEST_F(AMemoryBudget, DoesNotChangeTheContextWithoutBudget) {
+  const Context input_context(context);
+  applyMemoryBudget(hypergraph, context);
+  verifyThatAlgorithmsAreUnchanged(input_context);
+  ASSERT_EQ(estimatePeakMemoryConsumption(hypergraph, input_context),
+            context.partition.predicted_peak_memory);
+}
+
+TEST_F(AMemoryBudget, DoesNotChangeTheContextIfTheEstimateFitsIntoTheBudget) {
+  const size_t estimate = estimatePeakMemoryConsumption(hypergraph, context);
+  context.partition.memory_budget = estimate / MEGABYTE + 1;
+  const Context input_context(context);
+  applyMemoryBudget(hypergraph, context);
+  verifyThatAlgorithmsAreUnchanged(input_context);
+  ASSERT_EQ(estimate, context.partition.predicted_peak_memory);
+}
+
+TEST_F(AMemoryBudget, SelectsLowerMemoryAlternativesIfTheBudgetIsTight) {
+  ASSERT_FALSE(context.preprocessing.community_detection.low_memory_contraction);
+  const size_t estimate = estimatePeakMemoryConsumption(hypergraph, context);
+  // Smaller than the input hypergraph, so it is not possible to satisfy the budget
+  context.partition.memory_budget = 1;
+  ASSERT_GT(estimate, MEGABYTE);
+  applyMemoryBudget(hypergraph, context);
+  ASSERT_TRUE(context.preprocessing.community_detection.low_memory_contraction);
+  ASSERT_LT(context.partition.predicted_peak_memory, estimate);
+  ASSERT_EQ(estimatePeakMemoryConsumption(hypergraph, context),
+            context.partition.predicted_peak_memory);
+}
+
+TEST_F(AMemoryBudget, DisablesFMRefinementIfTheGainCacheDominatesThePeakMemory) {
+  context.partition.k = 256;
+  ASSERT_FALSE(context.refinement.fm.perform_moves_global);
+  ASSERT_NE(FMAlgorithm::do_nothing, context.refinement.fm.algorithm);
+  const size_t estimate = estimatePeakMemoryConsumption(hypergraph, context);
+  context.partition.memory_budget = 1;
+  applyMemoryBudget(hypergraph, context);
+  ASSERT_TRUE(context.refinement.fm.perform_moves_global);
+  ASSERT_EQ(FMAlgorithm::do_nothing, context.refinement.fm.algorithm);
+  ASSERT_FALSE(context.refinement.global_fm.use_global_fm);
+  ASSERT_LT(context.partition.predicted_peak_memory, estimate);
+}
+
+TEST_F(AMemoryBudget, IsAppliedAndReportedWhenPartitioningThroughTheFacade) {
+  context.partition.memory_budget = 1;
+  mt_kahypar_partitioned_hypergraph_t partitioned_hg =
+    PartitionerFacade::partition(utils::hypergraph_cast(hypergraph), context);
+  ASSERT_NE(nullptr, partitioned_hg.partitioned_hg);
+  ASSERT_TRUE(context.preprocessing.community_detection.low_memory_contraction);
+  ASSERT_GT(context.partition.predicted_peak_memory, 0);
+
+  std::stringstream stats;
+  stats << utils::Utilities::instance().getStats(context.utility_id);
+  ASSERT_NE(std::string::npos, stats.str().find("predicted_peak_memory_mb"));
+  ASSERT_NE(std::string::npos, stats.str().find("actual_peak_memory_mb"));
+  utils::delete_partitioned_hypergraph(partitioned_hg);
+}
+
+}  // namespace mt_kahypar
@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <sstream>
+#include <thread>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/command_line_options.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/partitioner.h"
+#include "mt-kahypar/utils/utilities.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+  using TypeTraits = StaticHypergraphTypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+}
+
+class APartitioner : public Test {
+
+ public:
+  APartitioner() :
+    hypergraph(),
+    context(),
+    num_threads(std::max(std::thread::hardware_concurrency(), 2U)) {
+    parseIniToContext(context, "../config/default_preset.ini");
+    context.partition.graph_filename = "../tests/instances/contracted_unweighted_ibm01.hgr";
+    context.partition.mode = Mode::direct;
+    context.partition.preset_type = PresetType::default_preset;
+    context.partition.instance_type = InstanceType::hypergraph;
+    context.partition.partition_type = PartitionedHypergraph::TYPE;
+    context.partition.objective = Objective::km1;
+    context.partition.gain_policy = GainPolicy::km1;
+    context.partition.epsilon = 0.03;
+    context.partition.k = 4;
+    context.partition.verbose_output = false;
+    context.shared_memory.num_threads = num_threads;
+    context.shared_memory.original_num_threads = num_threads;
+    context.utility_id = utils::Utilities::instance().registerNewUtilityObjects();
+
+    hypergraph = io::readInputFile<Hypergraph>(
+      context.partition.graph_filename, FileFormat::hMetis, true);
+  }
+
+  bool usedSequentialFastPath() const {
+    std::stringstream stats;
+    stats << utils::Utilities::instance().getStats(context.utility_id);
+    return stats.str().find("sequential_fast_path=true") != std::string::npos;
+  }
+
+  void verifyPartition(const PartitionedHypergraph& phg) {
+    for ( const HypernodeID& hn : phg.nodes() ) {
+      ASSERT_GE(phg.partID(hn), 0);
+      ASSERT_LT(phg.partID(hn), context.partition.k);
+    }
+    ASSERT_TRUE(metrics::isBalanced(phg, context));
+    ASSERT_GT(metrics::quality(phg, context), 0);
+  }
+
+  Hypergraph hypergraph;
+  Context context;
+  const size_t num_threads;
+};
+
+TEST_F(APartitioner, IsParallelByDefault) {
+  ASSERT_EQ(0, context.shared_memory.sequential_pin_threshold);
+  PartitionedHypergraph phg = Partitioner<TypeTraits>::partition(hypergraph, context);
+  verifyPartition(phg);
+  ASSERT_FALSE(usedSequentialFastPath());
+}
+
+TEST_F(APartitioner, ComputesABalancedPartitionOnTheSequentialFastPath) {
+  context.shared_memory.sequential_pin_threshold = std::numeric_limits<size_t>::max();
+  PartitionedHypergraph phg = Partitioner<TypeTraits>::partition(hypergraph, context);
+  verifyPartition(phg);
+  ASSERT_TRUE(usedSequentialFastPath());
+}
+
+TEST_F(APartitioner, UsesTheSequentialFastPathIfTheNumberOfPinsEqualsTheThreshold) {
+  context.shared_memory.sequential_pin_threshold = hypergraph.initialNumPins();
+  PartitionedHypergraph phg = Partitioner<TypeTraits>::partition(hypergraph, context);
+  verifyPartition(phg);
+  ASSERT_TRUE(usedSequentialFastPath());
+}
+
+TEST_F(APartitioner, DoesNotUseTheSequentialFastPathIfTheNumberOfPinsExceedsTheThreshold) {
+  context.shared_memory.sequential_pin_threshold = hypergraph.initialNumPins() - 1;
+  PartitionedHypergraph phg = Partitioner<TypeTraits>::partition(hypergraph, context);
+  verifyPartition(phg);
+  ASSERT_FALSE(usedSequentialFastPath());
+}
+
+TEST_F(APartitioner, ComputesABalancedPartitionForAWeightedInputOnTheSequentialFastPath) {
+  hypergraph = io::readInputFile<Hypergraph>(
+    "../tests/instances/contracted_ibm01.hgr", FileFormat::hMetis, true);
+  context.partition.k = 8;
+  context.shared_memory.sequential_pin_threshold = hypergraph.initialNumPins();
+  PartitionedHypergraph phg = Partitioner<TypeTraits>::partition(hypergraph, context);
+  verifyPartition(phg);
+  ASSERT_TRUE(usedSequentialFastPath());
+}
+
+TEST_F(APartitioner, DoesNotChangeTheNumberOfThreadsOfTheCallerOnTheSequentialFastPath) {
+  context.shared_memory.sequential_pin_threshold = std::numeric_limits<size_t>::max();
+  const Context input_context(context);
+  PartitionedHypergraph phg = Partitioner<TypeTraits>::partition(hypergraph, context);
+  ASSERT_TRUE(usedSequentialFastPath());
+  ASSERT_EQ(num_threads, context.shared_memory.num_threads);
+  ASSERT_EQ(num_threads, context.shared_memory.original_num_threads);
+  ASSERT_EQ(input_context.partition.k, context.partition.k);
+  ASSERT_EQ(input_context.partition.seed, context.partition.seed);
+  ASSERT_EQ(input_context.shared_memory.sequential_pin_threshold,
+            context.shared_memory.sequential_pin_threshold);
+}
+
+TEST_F(APartitioner, DoesNotUseTheSequentialFastPathForTheDeterministicPreset) {
+  parseIniToContext(context, "../config/deterministic_preset.ini");
+  context.partition.preset_type = PresetType::deterministic;
+  context.partition.k = 4;
+  context.partition.epsilon = 0.03;
+  context.partition.verbose_output = false;
+  context.shared_memory.num_threads = num_threads;
+  context.shared_memory.original_num_threads = num_threads;
+  context.shared_memory.sequential_pin_threshold = std::numeric_limits<size_t>::max();
+  PartitionedHypergraph phg = Partitioner<TypeTraits>::partition(hypergraph, context);
+  verifyPartition(phg);
+  ASSERT_FALSE(usedSequentialFastPath());
+}
+
+}  // namespace mt_kahypar
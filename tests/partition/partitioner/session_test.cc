@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include "gmock/gmock.h"
+
+#include <thread>
+#include <vector>
+
+#include "tbb/enumerable_thread_specific.h"
+#include "tbb/parallel_for.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/session.h"
+#include "mt-kahypar/utils/randomize.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+  static constexpr size_t NUM_RANDOM_NUMBERS = 1000;
+
+  std::vector<int> drawRandomNumbers() {
+    std::vector<int> numbers;
+    for ( size_t i = 0; i < NUM_RANDOM_NUMBERS; ++i ) {
+      numbers.push_back(utils::Randomize::instance().getRandomInt(0, 1000000, 0));
+    }
+    return numbers;
+  }
+}
+
+class ASession : public Test {
+
+ public:
+  ASession() :
+    context() {
+    context.partition.seed = 42;
+  }
+
+  Context context;
+};
+
+TEST_F(ASession, BindsAllThreadsOfItsArenaToItsOwnRandomNumberGenerators) {
+  Session session(2);
+  utils::Randomize* global_rand = &utils::Randomize::instance();
+  tbb::enumerable_thread_specific<std::vector<utils::Randomize*>> used_rands;
+  session.execute(context, [&] {
+    tbb::parallel_for(UL(0), UL(10000), [&](const size_t) {
+      used_rands.local().push_back(&utils::Randomize::instance());
+    });
+  });
+
+  utils::Randomize* session_rand = used_rands.begin()->front();
+  ASSERT_NE(global_rand, session_rand);
+  for ( const std::vector<utils::Randomize*>& rands : used_rands ) {
+    for ( utils::Randomize* rand : rands ) {
+      ASSERT_EQ(session_rand, rand);
+    }
+  }
+  ASSERT_EQ(global_rand, &utils::Randomize::instance());
+}
+
+TEST_F(ASession, DrawsTheSameRandomNumbersForTheSameSeed) {
+  Session session(1);
+  const std::vector<int> expected = session.execute(context, drawRandomNumbers);
+  // Using the process-wide random number generators in between
+  // does not affect the random numbers of the session
+  utils::Randomize::instance().setSeed(context.partition.seed + 1);
+  drawRandomNumbers();
+  ASSERT_EQ(expected, session.execute(context, drawRandomNumbers));
+}
+
+TEST_F(ASession, DrawsTheSameRandomNumbersIfSeveralSessionsRunConcurrently) {
+  Session reference_session(1);
+  const std::vector<int> expected = reference_session.execute(context, drawRandomNumbers);
+
+  const size_t num_sessions = 4;
+  std::vector<std::vector<int>> numbers(num_sessions);
+  std::vector<std::thread> threads;
+  for ( size_t i = 0; i < num_sessions; ++i ) {
+    threads.emplace_back([&, i] {
+      Session session(1);
+      numbers[i] = session.execute(context, drawRandomNumbers);
+    });
+  }
+  for ( std::thread& thread : threads ) {
+    thread.join();
+  }
+
+  for ( size_t i = 0; i < num_sessions; ++i ) {
+    ASSERT_EQ(expected, numbers[i]) << V(i);
+  }
+}
+
+}  // namespace mt_kahypar
@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include <chrono>
+#include <thread>
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/partition/refinement/adaptive_refinement_controller.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+using Refiner = AdaptiveRefinementController::Refiner;
+
+class AAdaptiveRefinementController : public Test {
+ public:
+  AAdaptiveRefinementController() :
+    context(),
+    metrics({ 1000, 0.0 }) {
+    context.refinement.adaptive.enabled = true;
+    context.refinement.adaptive.min_relative_efficiency = 0.1;
+    context.refinement.adaptive.probe_interval = 3;
+  }
+
+  // ! Simulates a refinement level on which label propagation improves
+  // ! the objective function by lp_gain and FM by fm_gain
+  void refineLevel(AdaptiveRefinementController& controller,
+                   const HyperedgeWeight lp_gain,
+                   const HyperedgeWeight fm_gain) {
+    controller.startLevel();
+    executeIfEnabled(controller, Refiner::label_propagation, lp_gain);
+    executeIfEnabled(controller, Refiner::fm, fm_gain);
+    controller.finishLevel();
+  }
+
+  void executeIfEnabled(AdaptiveRefinementController& controller,
+                        const Refiner refiner,
+                        const HyperedgeWeight gain) {
+    if ( controller.shouldRun(refiner) ) {
+      controller.execute(refiner, metrics, [&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        metrics.quality -= gain;
+        return gain > 0;
+      });
+    }
+  }
+
+  Context context;
+  Metrics metrics;
+};
+
+TEST_F(AAdaptiveRefinementController, ExecutesAllRefinersOnFirstLevel) {
+  AdaptiveRefinementController controller(context);
+  controller.startLevel();
+  ASSERT_TRUE(controller.shouldRun(Refiner::label_propagation));
+  ASSERT_TRUE(controller.shouldRun(Refiner::fm));
+  ASSERT_TRUE(controller.shouldRun(Refiner::flows));
+}
+
+TEST_F(AAdaptiveRefinementController, ExecutesAllRefinersIfDisabled) {
+  context.refinement.adaptive.enabled = false;
+  AdaptiveRefinementController controller(context);
+  refineLevel(controller, 100, 0);
+  controller.startLevel();
+  ASSERT_TRUE(controller.shouldRun(Refiner::label_propagation));
+  ASSERT_TRUE(controller.shouldRun(Refiner::fm));
+}
+
+TEST_F(AAdaptiveRefinementController, SkipsRefinerWithoutImprovement) {
+  AdaptiveRefinementController controller(context);
+  refineLevel(controller, 100, 0);
+  ASSERT_EQ(900, metrics.quality);
+  controller.startLevel();
+  ASSERT_TRUE(controller.shouldRun(Refiner::label_propagation));
+  ASSERT_FALSE(controller.shouldRun(Refiner::fm));
+}
+
+TEST_F(AAdaptiveRefinementController, ExecutesSkippedRefinerAfterProbeInterval) {
+  AdaptiveRefinementController controller(context);
+  refineLevel(controller, 100, 0);
+  refineLevel(controller, 100, 0);
+  refineLevel(controller, 100, 0);
+  controller.startLevel();
+  ASSERT_TRUE(controller.shouldRun(Refiner::fm));
+}
+
+TEST_F(AAdaptiveRefinementController, ReenablesRefinerIfItBecomesEfficientAgain) {
+  AdaptiveRefinementController controller(context);
+  refineLevel(controller, 100, 0);
+  refineLevel(controller, 100, 0);
+  refineLevel(controller, 100, 0);
+  // FM is probed on this level and finds a large improvement
+  refineLevel(controller, 10, 500);
+  controller.startLevel();
+  ASSERT_TRUE(controller.shouldRun(Refiner::label_propagation));
+  ASSERT_TRUE(controller.shouldRun(Refiner::fm));
+}
+
+}  // namespace mt_kahypar
@@ -0,0 +1,206 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/partition/refinement/flows/graph_flow_cutter.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+class AGraphFlowCutter : public Test {
+ public:
+  AGraphFlowCutter() :
+    network(),
+    cutter(network, 42) { }
+
+  // ! Adds a path of n unit weight nodes between source and sink
+  void constructPath(const HypernodeID n, const HyperedgeWeight capacity) {
+    network.addNode(1);
+    for ( HypernodeID u = 1; u <= n + 1; ++u ) {
+      network.addNode(1);
+      network.addEdge(u - 1, u, capacity);
+    }
+    network.finalize();
+  }
+
+  bool run(const HypernodeID source, const HypernodeID sink) {
+    cutter.reset();
+    return cutter.enumerateCutsUntilBalancedOrFlowBoundExceeded(
+      source, sink, [] { return true; });
+  }
+
+  GraphFlowNetwork network;
+  GraphFlowCutter cutter;
+};
+
+TEST_F(AGraphFlowCutter, BuildsAdjacencyArray) {
+  network.addNode(1);
+  network.addNode(2);
+  network.addNode(3);
+  network.addEdge(0, 1, 4);
+  network.addEdge(1, 2, 5);
+  network.finalize();
+
+  ASSERT_EQ(3, network.numNodes());
+  ASSERT_EQ(4, network.numArcs());
+  ASSERT_EQ(6, network.totalWeight());
+  ASSERT_EQ(1, network.firstInvalidArc(0) - network.firstArc(0));
+  ASSERT_EQ(2, network.firstInvalidArc(1) - network.firstArc(1));
+  for ( HypernodeID u = 0; u < network.numNodes(); ++u ) {
+    for ( size_t a = network.firstArc(u); a < network.firstInvalidArc(u); ++a ) {
+      const size_t rev = network.reverse(a);
+      ASSERT_EQ(u, network.head(rev));
+      ASSERT_EQ(network.capacity(a), network.capacity(rev));
+    }
+  }
+}
+
+TEST_F(AGraphFlowCutter, ComputesMinimumCut) {
+  network.addNode(1);
+  network.addNode(1);
+  network.addNode(1);
+  network.addNode(1);
+  network.addEdge(0, 1, 3);
+  network.addEdge(1, 2, 1);
+  network.addEdge(2, 3, 3);
+  network.finalize();
+  cutter.setMaxBlockWeight(0, 2);
+  cutter.setMaxBlockWeight(1, 2);
+
+  ASSERT_TRUE(run(0, 3));
+  ASSERT_EQ(1, cutter.flowValue());
+  ASSERT_TRUE(cutter.isSource(0));
+  ASSERT_TRUE(cutter.isSource(1));
+  ASSERT_FALSE(cutter.isSource(2));
+  ASSERT_FALSE(cutter.isSource(3));
+  ASSERT_EQ(2, cutter.sourceWeight());
+  ASSERT_EQ(2, cutter.sinkWeight());
+}
+
+TEST_F(AGraphFlowCutter, PiercesUntilCutIsBalanced) {
+  constructPath(4, 1);
+  cutter.setMaxBlockWeight(0, 3);
+  cutter.setMaxBlockWeight(1, 3);
+
+  ASSERT_TRUE(run(0, 5));
+  ASSERT_EQ(1, cutter.flowValue());
+  ASSERT_EQ(3, cutter.sourceWeight());
+  ASSERT_EQ(3, cutter.sinkWeight());
+  ASSERT_TRUE(cutter.isSource(0));
+  ASSERT_TRUE(cutter.isSource(1));
+  ASSERT_TRUE(cutter.isSource(2));
+  ASSERT_FALSE(cutter.isSource(3));
+  ASSERT_FALSE(cutter.isSource(4));
+  ASSERT_FALSE(cutter.isSource(5));
+}
+
+TEST_F(AGraphFlowCutter, ChoosesCutClosestToSinkIfOnlyThisOneIsBalanced) {
+  // The minimum cut closest to the source only contains the source, while
+  // the minimum cut closest to the sink contains the sink and the heavy node 2
+  network.addNode(1);
+  network.addNode(1);
+  network.addNode(5);
+  network.addNode(1);
+  network.addEdge(0, 2, 2);
+  network.addEdge(2, 1, 4);
+  network.addEdge(0, 3, 1);
+  network.addEdge(3, 1, 1);
+  network.finalize();
+  cutter.setMaxBlockWeight(0, 2);
+  cutter.setMaxBlockWeight(1, 6);
+
+  ASSERT_TRUE(run(0, 1));
+  ASSERT_EQ(3, cutter.flowValue());
+  ASSERT_TRUE(cutter.isSource(0));
+  ASSERT_FALSE(cutter.isSource(1));
+  ASSERT_FALSE(cutter.isSource(2));
+  ASSERT_TRUE(cutter.isSource(3));
+}
+
+TEST_F(AGraphFlowCutter, ComputesBalancedCutsWithCutValueEqualToFlowValue) {
+  std::mt19937 prng(1);
+  for ( size_t i = 0; i < 50; ++i ) {
+    GraphFlowNetwork random_network;
+    const HypernodeID num_nodes = 20;
+    for ( HypernodeID u = 0; u < num_nodes; ++u ) {
+      random_network.addNode(1 + prng() % 3);
+    }
+    for ( HypernodeID u = 1; u < num_nodes; ++u ) {
+      // Spanning tree plus random edges
+      random_network.addEdge(prng() % u, u, 1 + prng() % 5);
+      const HypernodeID v = prng() % num_nodes;
+      if ( v != u ) {
+        random_network.addEdge(u, v, 1 + prng() % 5);
+      }
+    }
+    random_network.finalize();
+
+    GraphFlowCutter random_cutter(random_network, i);
+    const HypernodeWeight max_weight = random_network.totalWeight() / 2 + 3;
+    random_cutter.setMaxBlockWeight(0, max_weight);
+    random_cutter.setMaxBlockWeight(1, max_weight);
+    random_cutter.reset();
+    const bool success = random_cutter.enumerateCutsUntilBalancedOrFlowBoundExceeded(
+      0, num_nodes - 1, [] { return true; });
+    if ( success ) {
+      ASSERT_TRUE(random_cutter.isSource(0));
+      ASSERT_FALSE(random_cutter.isSource(num_nodes - 1));
+      HyperedgeWeight cut = 0;
+      HypernodeWeight source_weight = 0;
+      for ( HypernodeID u = 0; u < num_nodes; ++u ) {
+        source_weight += random_cutter.isSource(u) ? random_network.nodeWeight(u) : 0;
+        for ( size_t a = random_network.firstArc(u); a < random_network.firstInvalidArc(u); ++a ) {
+          if ( random_cutter.isSource(u) && !random_cutter.isSource(random_network.head(a)) ) {
+            cut += random_network.capacity(a);
+          }
+        }
+      }
+      ASSERT_EQ(random_cutter.flowValue(), cut);
+      ASSERT_EQ(random_cutter.sourceWeight(), source_weight);
+      ASSERT_LE(random_cutter.sourceWeight(), max_weight);
+      ASSERT_LE(random_cutter.sinkWeight(), max_weight);
+    }
+  }
+}
+
+TEST_F(AGraphFlowCutter, StopsIfFlowBoundIsExceeded) {
+  constructPath(2, 5);
+  cutter.setMaxBlockWeight(0, 2);
+  cutter.setMaxBlockWeight(1, 2);
+  cutter.setFlowBound(4);
+  ASSERT_FALSE(run(0, 3));
+}
+
+TEST_F(AGraphFlowCutter, FailsIfNoBalancedCutExists) {
+  constructPath(2, 1);
+  cutter.setMaxBlockWeight(0, 1);
+  cutter.setMaxBlockWeight(1, 1);
+  ASSERT_FALSE(run(0, 3));
+}
+
+}  // namespace mt_kahypar
@@ -124,6 +124,25 @@ void executeConcurrent(F f1, K f2) {
   });
 }
 
+template<typename PartitionedHypergraph>
+void verifyThatSubhypergraphContainsAllIncidentHyperedges(const PartitionedHypergraph& phg,
+                                                          const Subhypergraph& sub_hg) {
+  std::set<HyperedgeID> hes(sub_hg.hes.begin(), sub_hg.hes.end());
+  ASSERT_EQ(sub_hg.hes.size(), hes.size());
+  std::set<HyperedgeID> expected_hes;
+  for ( const HypernodeID& hn : sub_hg.nodes_of_block_0 ) {
+    for ( const HyperedgeID& he : phg.incidentEdges(hn) ) {
+      expected_hes.insert(he);
+    }
+  }
+  for ( const HypernodeID& hn : sub_hg.nodes_of_block_1 ) {
+    for ( const HyperedgeID& he : phg.incidentEdges(hn) ) {
+      expected_hes.insert(he);
+    }
+  }
+  ASSERT_EQ(expected_hes, hes);
+}
+
 void verifyThatVertexSetAreDisjoint(const Subhypergraph& sub_hg_1, const Subhypergraph& sub_hg_2) {
   std::set<HypernodeID> nodes;
   for ( const HypernodeID& hn : sub_hg_1.nodes_of_block_0 ) {
@@ -196,4 +215,69 @@ TEST_F(AProblemConstruction, GrowTwoFlowProblemAroundTwoBlocksSimultanously) {
   verifyThatVertexSetAreDisjoint(sub_hg_1, sub_hg_2);
 }
 
-}
\ No newline at end of file
+TEST_F(AProblemConstruction, GrowAnFlowProblemAroundTwoBlocksInParallel) {
+  ProblemConstruction<TypeTraits> constructor(
+    hg.initialNumNodes(), hg.initialNumEdges(), context);
+  FlowRefinerAdapter<TypeTraits> refiner(hg.initialNumEdges(), context);
+  QuotientGraph<TypeTraits> qg(hg.initialNumEdges(), context);
+  refiner.initialize(context.shared_memory.num_threads);
+  qg.initialize(phg);
+
+  max_part_weights.assign(context.partition.k, 400);
+  max_part_weights[2] = 300;
+  SearchID search_id = qg.requestNewSearch(refiner);
+  Subhypergraph sub_hg = constructor.construct(search_id, qg, phg, 4);
+
+  ASSERT_GT(sub_hg.numNodes(), 0);
+  verifyThatPartWeightsAreLessEqualToMaxPartWeight(sub_hg, search_id, qg);
+  verifyThatSubhypergraphContainsAllIncidentHyperedges(phg, sub_hg);
+}
+
+
+TEST_F(AProblemConstruction, GrowsTheSameFlowProblemForDifferentNumbersOfThreads) {
+  context.refinement.flows.alpha = 16;
+  ProblemConstruction<TypeTraits> constructor(
+    hg.initialNumNodes(), hg.initialNumEdges(), context);
+  FlowRefinerAdapter<TypeTraits> refiner(hg.initialNumEdges(), context);
+  QuotientGraph<TypeTraits> qg(hg.initialNumEdges(), context);
+  refiner.initialize(context.shared_memory.num_threads);
+  qg.initialize(phg);
+
+  SearchID search_id = qg.requestNewSearch(refiner);
+  const Subhypergraph expected = constructor.construct(search_id, qg, phg, 2);
+  ASSERT_GT(expected.numNodes(), 0);
+  verifyThatSubhypergraphContainsAllIncidentHyperedges(phg, expected);
+
+  for ( size_t num_threads = 3; num_threads <= 8; ++num_threads ) {
+    const Subhypergraph sub_hg = constructor.construct(search_id, qg, phg, num_threads);
+    ASSERT_EQ(expected.nodes_of_block_0, sub_hg.nodes_of_block_0) << V(num_threads);
+    ASSERT_EQ(expected.nodes_of_block_1, sub_hg.nodes_of_block_1) << V(num_threads);
+    ASSERT_EQ(expected.hes, sub_hg.hes) << V(num_threads);
+    ASSERT_EQ(expected.num_pins, sub_hg.num_pins) << V(num_threads);
+  }
+}
+
+TEST_F(AProblemConstruction, GrowsTheSameFlowProblemIfTheParallelSearchIsRepeated) {
+  context.refinement.flows.alpha = 16;
+  ProblemConstruction<TypeTraits> constructor(
+    hg.initialNumNodes(), hg.initialNumEdges(), context);
+  FlowRefinerAdapter<TypeTraits> refiner(hg.initialNumEdges(), context);
+  QuotientGraph<TypeTraits> qg(hg.initialNumEdges(), context);
+  refiner.initialize(context.shared_memory.num_threads);
+  qg.initialize(phg);
+
+  SearchID search_id = qg.requestNewSearch(refiner);
+  const Subhypergraph expected = constructor.construct(search_id, qg, phg, 4);
+  ASSERT_GT(expected.numNodes(), 0);
+
+  // Later searches reuse the task arena and the buffers of the first one
+  for ( size_t i = 0; i < 5; ++i ) {
+    const Subhypergraph sub_hg = constructor.construct(search_id, qg, phg, 4);
+    ASSERT_EQ(expected.nodes_of_block_0, sub_hg.nodes_of_block_0) << V(i);
+    ASSERT_EQ(expected.nodes_of_block_1, sub_hg.nodes_of_block_1) << V(i);
+    ASSERT_EQ(expected.hes, sub_hg.hes) << V(i);
+    ASSERT_EQ(expected.num_pins, sub_hg.num_pins) << V(i);
+  }
+}
+
+}
@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+#include "tbb/global_control.h"
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/datastructures/static_graph.h"
+#include "mt-kahypar/datastructures/static_graph_factory.h"
+#include "mt-kahypar/partition/mapping/all_pair_shortest_path.h"
+
+using namespace mt_kahypar;
+namespace po = boost::program_options;
+
+using HyperedgeVector = parallel::scalable_vector<parallel::scalable_vector<HypernodeID>>;
+using HighResClockTimepoint = std::chrono::time_point<std::chrono::high_resolution_clock>;
+
+// Same construction as in hierarchical_process_graph_generator.cc
+void construct_hierarchical_process_graph(HyperedgeVector& edges,
+                                          vec<HyperedgeWeight>& edge_weights,
+                                          const HypernodeID core_start,
+                                          const HypernodeID core_end,
+                                          const std::vector<HypernodeID>& hierarchy,
+                                          const std::vector<HyperedgeWeight>& costs,
+                                          const size_t cur_level) {
+  if ( cur_level >= hierarchy.size() ) return;
+
+  const HypernodeID num_nodes = core_end - core_start;
+  const HypernodeID a = hierarchy[cur_level];
+  const HypernodeID cores_per_node = num_nodes / a;
+  const HyperedgeWeight c = costs[cur_level];
+  for ( HypernodeID core_1 = core_start; core_1 < core_end; ++core_1 ) {
+    for ( HypernodeID core_2 = core_1 + 1; core_2 < core_end; ++core_2 ) {
+      if ( core_1 / cores_per_node != core_2 / cores_per_node ) {
+        edges.push_back({ core_1, core_2 });
+        edge_weights.push_back(c);
+      }
+    }
+  }
+
+  for ( HypernodeID i = 0; i < a; ++i ) {
+    const HypernodeID next_core_start = core_start + i * cores_per_node;
+    const HypernodeID next_core_end = core_start + ( i + 1 ) * cores_per_node;
+    construct_hierarchical_process_graph(edges, edge_weights,
+      next_core_start, next_core_end, hierarchy, costs, cur_level + 1);
+  }
+}
+
+template<typename F>
+double measure(const F& f) {
+  HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+  f();
+  HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}
+
+int main(int argc, char* argv[]) {
+  std::string hierarchy_str, costs_str;
+  HypernodeID max_num_nodes = 0;
+  int num_threads = 1;
+  bool run_sequential = true;
+  po::options_description options("Options");
+  options.add_options()
+    ("hierarchy",
+    po::value<std::string>(&hierarchy_str)->value_name("<string>")->default_value("4:8"),
+    "Data center hierarchy above the node level (e.g., 4:8 means 8 racks with 4 nodes each)")
+    ("communication-costs",
+    po::value<std::string>(&costs_str)->value_name("<string>")->default_value("1:10:100"),
+    "Communications costs (one more entry than in the hierarchy, innermost level first)")
+    ("max-nodes,n",
+    po::value<HypernodeID>(&max_num_nodes)->value_name("<uint32_t>")->default_value(4096),
+    "The number of cores per node is doubled until the process graph has more than n nodes")
+    ("threads,t",
+    po::value<int>(&num_threads)->value_name("<int>")->default_value(std::thread::hardware_concurrency()),
+    "Number of threads")
+    ("sequential",
+    po::value<bool>(&run_sequential)->value_name("<bool>")->default_value(true),
+    "If true, also runs the sequential version of Floyd's algorithm and compares the results");
+
+  po::variables_map cmd_vm;
+  po::store(po::parse_command_line(argc, argv, options), cmd_vm);
+  po::notify(cmd_vm);
+  tbb::global_control gc(tbb::global_control::max_allowed_parallelism, num_threads);
+
+  for ( size_t i = 0; i < hierarchy_str.size(); ++i )  {
+    hierarchy_str[i] = hierarchy_str[i] == ':' ? ' ' : hierarchy_str[i];
+  }
+  for ( size_t i = 0; i < costs_str.size(); ++i )  {
+    costs_str[i] = costs_str[i] == ':' ? ' ' : costs_str[i];
+  }
+
+  HypernodeID cur;
+  std::vector<HypernodeID> upper_hierarchy;
+  std::stringstream hierarchy_stream(hierarchy_str);
+  while ( hierarchy_stream >> cur ) {
+    upper_hierarchy.push_back(cur);
+  }
+  std::vector<HyperedgeWeight> costs;
+  std::stringstream costs_stream(costs_str);
+  while ( costs_stream >> cur ) {
+    costs.push_back(cur);
+  }
+  // The construction expects the outermost level first
+  std::reverse(upper_hierarchy.begin(), upper_hierarchy.end());
+  std::reverse(costs.begin(), costs.end());
+  if ( costs.size() != upper_hierarchy.size() + 1 ) {
+    std::cerr << "Number of communication costs must be one more than the size of the hierarchy" << std::endl;
+    return 1;
+  }
+
+  std::cout << std::setw(10) << "n" << std::setw(14) << "sequential[s]"
+            << std::setw(14) << "parallel[s]" << std::setw(10) << "speedup" << std::endl;
+  for ( HypernodeID cores_per_node = 2; ; cores_per_node *= 2 ) {
+    std::vector<HypernodeID> hierarchy = upper_hierarchy;
+    hierarchy.push_back(cores_per_node);
+    HypernodeID num_nodes = 1;
+    for ( const HypernodeID a : hierarchy ) {
+      num_nodes *= a;
+    }
+    if ( num_nodes > max_num_nodes ) break;
+
+    HyperedgeVector edges;
+    vec<HyperedgeWeight> edge_weights;
+    construct_hierarchical_process_graph(edges, edge_weights, 0, num_nodes, hierarchy, costs, 0);
+    ds::StaticGraph graph = ds::StaticGraphFactory::construct(
+      num_nodes, edges.size(), edges, edge_weights.data());
+
+    const size_t num_entries = static_cast<size_t>(num_nodes) * num_nodes;
+    vec<HyperedgeWeight> parallel_distances(num_entries, std::numeric_limits<HyperedgeWeight>::max() / 3);
+    const double parallel_time = measure([&] {
+      AllPairShortestPath::compute(graph, parallel_distances);
+    });
+
+    std::cout << std::setw(10) << num_nodes;
+    if ( run_sequential ) {
+      vec<HyperedgeWeight> sequential_distances(num_entries, std::numeric_limits<HyperedgeWeight>::max() / 3);
+      const double sequential_time = measure([&] {
+        AllPairShortestPath::computeSequential(graph, sequential_distances);
+      });
+      if ( sequential_distances != parallel_distances ) {
+        std::cerr << "Distances of parallel and sequential APSP differ!" << std::endl;
+        return 1;
+      }
+      std::cout << std::setw(14) << sequential_time << std::setw(14) << parallel_time
+                << std::setw(10) << ( sequential_time / parallel_time ) << std::endl;
+    } else {
+      std::cout << std::setw(14) << "-" << std::setw(14) << parallel_time
+                << std::setw(10) << "-" << std::endl;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,172 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/conversion.h"
+#include "mt-kahypar/partition/partitioner_facade.h"
+#include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/delete.h"
+#include "mt-kahypar/utils/randomize.h"
+#include "mt-kahypar/utils/utilities.h"
+
+using namespace mt_kahypar;
+namespace po = boost::program_options;
+
+using Hypergraph = ds::StaticHypergraph;
+using HypergraphFactory = typename Hypergraph::Factory;
+using HighResClockTimepoint = std::chrono::time_point<std::chrono::high_resolution_clock>;
+
+// Generates a random hypergraph where each hyperedge contains between
+// two and max_edge_size distinct nodes
+Hypergraph generateRandomHypergraph(const HypernodeID num_nodes,
+                                    const HyperedgeID num_edges,
+                                    const HypernodeID max_edge_size,
+                                    std::mt19937& gen) {
+  std::uniform_int_distribution<HypernodeID> node_dist(0, num_nodes - 1);
+  std::uniform_int_distribution<HypernodeID> size_dist(2, std::max(max_edge_size, ID(2)));
+  parallel::scalable_vector<parallel::scalable_vector<HypernodeID>> edges(num_edges);
+  for ( HyperedgeID he = 0; he < num_edges; ++he ) {
+    const HypernodeID size = std::min(size_dist(gen), num_nodes);
+    while ( edges[he].size() < size ) {
+      const HypernodeID hn = node_dist(gen);
+      if ( std::find(edges[he].begin(), edges[he].end(), hn) == edges[he].end() ) {
+        edges[he].push_back(hn);
+      }
+    }
+  }
+  return HypergraphFactory::construct(num_nodes, num_edges, edges);
+}
+
+double instancesPerSecond(const size_t num_instances,
+                          const HighResClockTimepoint& start,
+                          const HighResClockTimepoint& end) {
+  return num_instances / std::chrono::duration<double>(end - start).count();
+}
+
+int main(int argc, char* argv[]) {
+  size_t num_instances = 0;
+  HypernodeID num_nodes = 0;
+  HyperedgeID num_edges = 0;
+  HypernodeID max_edge_size = 0;
+  PartitionID k = 2;
+  size_t num_threads = 1;
+  int seed = 0;
+  po::options_description options("Options");
+  options.add_options()
+    ("instances,n",
+    po::value<size_t>(&num_instances)->value_name("<size_t>")->default_value(1000),
+    "Number of hypergraphs in the batch")
+    ("nodes",
+    po::value<HypernodeID>(&num_nodes)->value_name("<int>")->default_value(500),
+    "Number of nodes of each hypergraph")
+    ("edges",
+    po::value<HyperedgeID>(&num_edges)->value_name("<int>")->default_value(500),
+    "Number of hyperedges of each hypergraph")
+    ("max-edge-size",
+    po::value<HypernodeID>(&max_edge_size)->value_name("<int>")->default_value(8),
+    "Maximum size of a hyperedge")
+    ("blocks,k",
+    po::value<PartitionID>(&k)->value_name("<int>")->default_value(2),
+    "Number of blocks")
+    ("threads,t",
+    po::value<size_t>(&num_threads)->value_name("<size_t>")->default_value(std::thread::hardware_concurrency()),
+    "Number of threads")
+    ("seed",
+    po::value<int>(&seed)->value_name("<int>")->default_value(0),
+    "Seed for random number generator");
+
+  po::variables_map cmd_vm;
+  po::store(po::parse_command_line(argc, argv, options), cmd_vm);
+  po::notify(cmd_vm);
+
+  TBBInitializer::instance(num_threads);
+  utils::Randomize::instance().setSeed(seed);
+
+  std::mt19937 gen(seed);
+  std::vector<Hypergraph> hypergraphs;
+  std::vector<mt_kahypar_hypergraph_t> batch;
+  hypergraphs.reserve(num_instances);
+  for ( size_t i = 0; i < num_instances; ++i ) {
+    hypergraphs.emplace_back(generateRandomHypergraph(num_nodes, num_edges, max_edge_size, gen));
+    batch.push_back(utils::hypergraph_cast(hypergraphs.back()));
+  }
+
+  Context context(false);
+  context.load_default_preset();
+  context.partition.k = k;
+  context.partition.epsilon = 0.03;
+  context.partition.objective = Objective::km1;
+  context.partition.instance_type = InstanceType::hypergraph;
+  context.partition.partition_type = to_partition_c_type(
+    context.partition.preset_type, context.partition.instance_type);
+  context.partition.verbose_output = false;
+  context.shared_memory.original_num_threads = num_threads;
+  context.shared_memory.num_threads = num_threads;
+
+  std::vector<mt_kahypar_partitioned_hypergraph_t> partitioned_hgs(num_instances);
+  auto free_partitions = [&] {
+    for ( mt_kahypar_partitioned_hypergraph_t& phg : partitioned_hgs ) {
+      utils::delete_partitioned_hypergraph(phg);
+      phg = mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
+    }
+  };
+
+  // Partition each instance with all threads (same as calling mt_kahypar_partition(...))
+  HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+  for ( size_t i = 0; i < num_instances; ++i ) {
+    Context instance_context(context);
+    instance_context.utility_id = utils::Utilities::instance().registerNewUtilityObjects();
+    partitioned_hgs[i] = PartitionerFacade::partition(batch[i], instance_context);
+  }
+  HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+  const double single_throughput = instancesPerSecond(num_instances, start, end);
+  free_partitions();
+
+  // Partition all instances as a batch
+  start = std::chrono::high_resolution_clock::now();
+  PartitionerFacade::partitionBatch(batch.data(), num_instances, context, partitioned_hgs.data());
+  end = std::chrono::high_resolution_clock::now();
+  const double batch_throughput = instancesPerSecond(num_instances, start, end);
+  free_partitions();
+
+  std::cout << std::setw(12) << "mode" << std::setw(20) << "instances/sec" << std::endl;
+  std::cout << std::setw(12) << "single" << std::setw(20) << single_throughput << std::endl;
+  std::cout << std::setw(12) << "batch" << std::setw(20) << batch_throughput << std::endl;
+  std::cout << "Speedup: " << ( batch_throughput / single_throughput ) << std::endl;
+
+  TBBInitializer::instance().terminate();
+  return 0;
+}
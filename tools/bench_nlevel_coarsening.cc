@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+#include "tbb/task_arena.h"
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/factories.h"
+#include "mt-kahypar/partition/coarsening/coarsening_commons.h"
+#include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/randomize.h"
+
+using namespace mt_kahypar;
+namespace po = boost::program_options;
+
+using Hypergraph = ds::DynamicHypergraph;
+using HighResClockTimepoint = std::chrono::time_point<std::chrono::high_resolution_clock>;
+
+std::vector<size_t> parseList(std::string str) {
+  for ( size_t i = 0; i < str.size(); ++i )  {
+    str[i] = str[i] == ':' ? ' ' : str[i];
+  }
+  std::vector<size_t> values;
+  size_t cur;
+  std::stringstream stream(str);
+  while ( stream >> cur ) {
+    values.push_back(cur);
+  }
+  return values;
+}
+
+// Runs the n-level coarsener on a copy of the input hypergraph and returns
+// the running time and the number of nodes of the coarsest hypergraph
+std::pair<double, HypernodeID> coarsen(const Hypergraph& input, const Context& context) {
+  Hypergraph hypergraph = input.copy(parallel_tag_t());
+  UncoarseningData<DynamicHypergraphTypeTraits> uncoarsening_data(true, hypergraph, context);
+  std::unique_ptr<ICoarsener> coarsener = CoarsenerFactory::getInstance().createObject(
+    CoarseningAlgorithm::nlevel_coarsener, utils::hypergraph_cast(hypergraph),
+    context, uncoarsening::to_pointer(uncoarsening_data));
+  HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+  coarsener->coarsen();
+  HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+  return std::make_pair(std::chrono::duration<double>(end - start).count(),
+    coarsener->currentNumberOfNodes());
+}
+
+int main(int argc, char* argv[]) {
+  std::string hypergraph_file, threads_str, round_sizes_str;
+  PartitionID k = 2;
+  int seed = 0;
+  po::options_description options("Options");
+  options.add_options()
+    ("hypergraph,h",
+    po::value<std::string>(&hypergraph_file)->value_name("<string>")->required(),
+    "Hypergraph filename (hMetis format)")
+    ("blocks,k",
+    po::value<PartitionID>(&k)->value_name("<int>")->default_value(2),
+    "Number of blocks (determines the contraction limit)")
+    ("threads,t",
+    po::value<std::string>(&threads_str)->value_name("<string>")->default_value("1:2:4:8:16:32:64"),
+    "Number of threads (colon-separated list)")
+    ("round-sizes",
+    po::value<std::string>(&round_sizes_str)->value_name("<string>")->default_value("0:10000"),
+    "Values of c-nlevel-round-size (colon-separated list, 0 = rate and contract each vertex immediately)")
+    ("seed",
+    po::value<int>(&seed)->value_name("<int>")->default_value(0),
+    "Seed for random number generator");
+
+  po::variables_map cmd_vm;
+  po::store(po::parse_command_line(argc, argv, options), cmd_vm);
+  po::notify(cmd_vm);
+
+  const std::vector<size_t> threads = parseList(threads_str);
+  const std::vector<size_t> round_sizes = parseList(round_sizes_str);
+  size_t max_num_threads = 1;
+  for ( const size_t t : threads ) {
+    max_num_threads = std::max(max_num_threads, t);
+  }
+  TBBInitializer::instance(max_num_threads);
+  utils::Randomize::instance().setSeed(seed);
+
+  Context context;
+  context.load_highest_quality_preset();
+  context.partition.k = k;
+  context.partition.epsilon = 0.03;
+  context.partition.preset_type = PresetType::highest_quality;
+  context.partition.instance_type = InstanceType::hypergraph;
+  context.partition.partition_type = N_LEVEL_HYPERGRAPH_PARTITIONING;
+  context.partition.objective = Objective::km1;
+  context.partition.gain_policy = GainPolicy::km1;
+  context.partition.verbose_output = false;
+
+  Hypergraph hypergraph = io::readInputFile<Hypergraph>(hypergraph_file, FileFormat::hMetis, true);
+  context.setupPartWeights(hypergraph.totalWeight());
+  context.setupContractionLimit(hypergraph.totalWeight());
+  context.setupMaximumAllowedNodeWeight(hypergraph.totalWeight());
+
+  std::cout << std::setw(10) << "threads" << std::setw(12) << "round-size"
+            << std::setw(14) << "time[s]" << std::setw(10) << "speedup"
+            << std::setw(14) << "coarsest-n" << std::endl;
+  for ( const size_t round_size : round_sizes ) {
+    double sequential_time = 0.0;
+    for ( const size_t t : threads ) {
+      context.shared_memory.num_threads = t;
+      context.shared_memory.original_num_threads = t;
+      context.coarsening.nlevel_round_size = round_size;
+      std::pair<double, HypernodeID> result;
+      tbb::task_arena arena(static_cast<int>(t));
+      arena.execute([&] {
+        result = coarsen(hypergraph, context);
+      });
+      if ( sequential_time == 0.0 ) {
+        sequential_time = result.first;
+      }
+      std::cout << std::setw(10) << t << std::setw(12) << round_size
+                << std::setw(14) << result.first << std::setw(10) << ( sequential_time / result.first )
+                << std::setw(14) << result.second << std::endl;
+    }
+  }
+
+  TBBInitializer::instance().terminate();
+  return 0;
+}
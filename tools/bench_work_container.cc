@@ -0,0 +1,103 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/utils/randomize.h"
+#include "mt-kahypar/parallel/work_stack.h"
+
+using namespace mt_kahypar;
+namespace po = boost::program_options;
+
+using HighResClockTimepoint = std::chrono::time_point<std::chrono::high_resolution_clock>;
+
+// Measures the throughput of the work container used for the seed nodes of
+// the localized FM searches. Only a few threads own elements such that most
+// elements must be stolen.
+int main(int argc, char* argv[]) {
+  size_t num_threads = 0;
+  size_t num_elements = 0;
+  size_t num_owners = 0;
+
+  po::options_description options("Options");
+  options.add_options()
+    ("threads,t",
+    po::value<size_t>(&num_threads)->value_name("<size_t>")->default_value(std::thread::hardware_concurrency()),
+    "Number of threads")
+    ("elements,n",
+    po::value<size_t>(&num_elements)->value_name("<size_t>")->default_value(UL(1) << 24),
+    "Number of elements")
+    ("owners,o",
+    po::value<size_t>(&num_owners)->value_name("<size_t>")->default_value(4),
+    "Number of threads that initially own elements");
+
+  po::variables_map cmd_vm;
+  po::store(po::parse_command_line(argc, argv, options), cmd_vm);
+  po::notify(cmd_vm);
+  num_owners = std::max(UL(1), std::min(num_owners, num_threads));
+
+  WorkContainer<size_t> work_container(num_threads);
+  for ( size_t i = 0; i < num_elements; ++i ) {
+    work_container.safe_push(i, i % num_owners);
+  }
+
+  std::vector<CAtomic<uint8_t>> num_pops(num_elements);
+  for ( CAtomic<uint8_t>& counter : num_pops ) {
+    counter.store(0);
+  }
+  std::vector<std::thread> threads;
+  HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+  for ( size_t thread_id = 0; thread_id < num_threads; ++thread_id ) {
+    threads.emplace_back([&, thread_id] {
+      size_t element = 0;
+      while ( work_container.try_pop(element, thread_id) ) {
+        num_pops[element].fetch_add(1, std::memory_order_relaxed);
+      }
+    });
+  }
+  for ( std::thread& t : threads ) {
+    t.join();
+  }
+  HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+  const double time = std::chrono::duration<double>(end - start).count();
+
+  for ( size_t i = 0; i < num_elements; ++i ) {
+    if ( num_pops[i].load() != 1 ) {
+      std::cout << "Element " << i << " was popped " << static_cast<int>(num_pops[i].load()) << " times" << std::endl;
+      return 1;
+    }
+  }
+  std::cout << "Popped " << num_elements << " elements with " << num_threads << " threads in "
+            << time << " s (" << static_cast<double>(num_elements) / time << " elements/s)" << std::endl;
+  return 0;
+}
@@ -29,6 +29,9 @@
 #include <fstream>
 #include <iostream>
 #include <functional>
+#include <sstream>
+
+#include "tbb/global_control.h"
 
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/definitions.h"
@@ -53,6 +56,7 @@ using PartitionedHypergraph = ds::PartitionedHypergraph<Hypergraph, ds::Connecti
 
 int main(int argc, char* argv[]) {
   Context context;
+  std::string strategy_str, threads_str;
   po::options_description options("Options");
   options.add_options()
     ("hypergraph,h",
@@ -70,6 +74,17 @@ int main(int argc, char* argv[]) {
     ("seed,s",
      po::value<int>(&context.partition.seed)->value_name("<int>")->required(),
      "Random number seed")
+    ("one-to-one-mapping-strategy",
+     po::value<std::string>(&strategy_str)->value_name("<string>")->default_value("greedy_mapping"),
+     "Strategy for solving the one-to-one mapping problem:\n"
+     " - greedy_mapping\n"
+     " - parallel_local_search\n"
+     " - identity")
+    ("threads,t",
+     po::value<std::string>(&threads_str)->value_name("<string>")->default_value(
+       std::to_string(std::thread::hardware_concurrency())),
+     "Number of threads. To measure the scalability of the mapping algorithm, several thread counts\n"
+     "can be given separated by colons (e.g., 1:2:4:8). Outputs one result line per thread count.")
     ("verbose,v",
      po::value<bool>(&context.partition.verbose_output)->value_name("<bool>")->default_value(false),
      "Enables logging");
@@ -78,11 +93,24 @@ int main(int argc, char* argv[]) {
   po::store(po::parse_command_line(argc, argv, options), cmd_vm);
   po::notify(cmd_vm);
 
+  std::vector<size_t> num_threads;
+  for ( size_t i = 0; i < threads_str.size(); ++i )  {
+    threads_str[i] = threads_str[i] == ':' ? ' ' : threads_str[i];
+  }
+  std::stringstream threads_stream(threads_str);
+  size_t cur_num_threads;
+  while ( threads_stream >> cur_num_threads ) {
+    num_threads.push_back(cur_num_threads);
+  }
+  if ( num_threads.empty() ) {
+    ERR("No number of threads specified");
+  }
+
   // Setup context
   context.partition.objective = Objective::steiner_tree;
   context.partition.epsilon = 0.03;
-  context.shared_memory.num_threads = std::thread::hardware_concurrency();
-  context.mapping.strategy = OneToOneMappingStrategy::greedy_mapping;
+  context.shared_memory.num_threads = *std::max_element(num_threads.begin(), num_threads.end());
+  context.mapping.strategy = oneToOneMappingStrategyFromString(strategy_str);
   context.mapping.use_local_search = true;
   context.mapping.use_two_phase_approach = false;
   context.mapping.max_steiner_tree_size = 4;
@@ -128,36 +156,51 @@ int main(int argc, char* argv[]) {
     io::printPartitioningResults(partitioned_hg, context, "Input Partition");
   }
 
-  // Solve One-To-One Mapping Problem
-  HighResClockTimepoint start_2 = std::chrono::high_resolution_clock::now();
-  InitialMapping<StaticHypergraphTypeTraits>::mapToTargetGraph(
-    partitioned_hg, target_graph, context);
-  HighResClockTimepoint end_2 = std::chrono::high_resolution_clock::now();
-
-  std::chrono::duration<double> elapsed_seconds((end_2 - start_2) + (end_1 - start_1));
-  if ( context.partition.verbose_output ) {
-    io::printPartitioningResults(partitioned_hg, context, elapsed_seconds);
+  for ( const size_t threads : num_threads ) {
+    tbb::global_control gc(tbb::global_control::max_allowed_parallelism, threads);
+    // Restore input partition
+    partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+      const PartitionID from = partitioned_hg.partID(hn);
+      if ( from != partition[hn] ) {
+        partitioned_hg.changeNodePart(hn, from, partition[hn]);
+      }
+    });
+
+    // Solve One-To-One Mapping Problem
+    HighResClockTimepoint start_2 = std::chrono::high_resolution_clock::now();
+    InitialMapping<StaticHypergraphTypeTraits>::mapToTargetGraph(
+      partitioned_hg, target_graph, context);
+    HighResClockTimepoint end_2 = std::chrono::high_resolution_clock::now();
+
+    std::chrono::duration<double> elapsed_seconds((end_2 - start_2) + (end_1 - start_1));
+    std::chrono::duration<double> mapping_seconds(end_2 - start_2);
+    if ( context.partition.verbose_output ) {
+      io::printPartitioningResults(partitioned_hg, context, elapsed_seconds);
+    }
+
+    std::cout << "RESULT"
+              << " graph=" << context.partition.graph_filename.substr(
+                  context.partition.graph_filename.find_last_of('/') + 1)
+              << " partition_file=" << context.partition.graph_partition_filename.substr(
+                  context.partition.graph_partition_filename.find_last_of('/') + 1)
+              << " target_graph_file=" << context.mapping.target_graph_file.substr(
+                 context.mapping.target_graph_file.find_last_of('/') + 1)
+              << " objective=" << context.partition.objective
+              << " mapping_strategy=" << context.mapping.strategy
+              << " k=" << context.partition.k
+              << " epsilon=" << context.partition.epsilon
+              << " seed=" << context.partition.seed
+              << " num_threads=" << threads
+              << " imbalance=" << metrics::imbalance(partitioned_hg, context)
+              << " steiner_tree=" << metrics::quality(partitioned_hg, Objective::steiner_tree)
+              << " approximation_factor=" << metrics::approximationFactorForProcessMapping(partitioned_hg, context)
+              << " cut=" << metrics::quality(partitioned_hg, Objective::cut)
+              << " km1=" << metrics::quality(partitioned_hg, Objective::km1)
+              << " soed=" << metrics::quality(partitioned_hg, Objective::soed)
+              << " mappingTime=" << mapping_seconds.count()
+              << " totalPartitionTime=" << elapsed_seconds.count()
+              << std::endl;
   }
 
-  std::cout << "RESULT"
-            << " graph=" << context.partition.graph_filename.substr(
-                context.partition.graph_filename.find_last_of('/') + 1)
-            << " partition_file=" << context.partition.graph_partition_filename.substr(
-                context.partition.graph_partition_filename.find_last_of('/') + 1)
-            << " target_graph_file=" << context.mapping.target_graph_file.substr(
-               context.mapping.target_graph_file.find_last_of('/') + 1)
-            << " objective=" << context.partition.objective
-            << " k=" << context.partition.k
-            << " epsilon=" << context.partition.epsilon
-            << " seed=" << context.partition.seed
-            << " imbalance=" << metrics::imbalance(partitioned_hg, context)
-            << " steiner_tree=" << metrics::quality(partitioned_hg, Objective::steiner_tree)
-            << " approximation_factor=" << metrics::approximationFactorForProcessMapping(partitioned_hg, context)
-            << " cut=" << metrics::quality(partitioned_hg, Objective::cut)
-            << " km1=" << metrics::quality(partitioned_hg, Objective::km1)
-            << " soed=" << metrics::quality(partitioned_hg, Objective::soed)
-            << " totalPartitionTime=" << elapsed_seconds.count()
-            << std::endl;
-
   return 0;
 }